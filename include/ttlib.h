@@ -16,10 +16,16 @@
  */
 typedef enum _TestResult_t
 {	
+	// 테스트 제한 시간 초과
+	TestTimeout = -4,
+	// 테스트 프로세스 비정상 종료(병렬 실행 시 사용)
+	TestCrash = -3,
 	// 테스트 종료
 	TestExit = -2,
 	// 테스트 실패(매크로 함수 실행 결과에 사용)
 	TestFail = -1,
+	// 테스트 미실행
+	TestNotRun = 0,
 	// 테스트 성공
 	TestSuccess = 1,
 	// 테스트 실패(fatal, 테스트 종료)
@@ -30,6 +36,86 @@ typedef enum _TestResult_t
 	TestContinue
 } TestResult;
 
+/**
+ * @enum TestKind
+ * @brief 테스트 레코드의 종류를 지정하기 위한 열거형
+ */
+typedef enum _TestKind_t
+{
+	// 일반 테스트(TEST, TEST_TIMEOUT)
+	TestKindTest = 0,
+	// 벤치마크(BENCHMARK, 벤치마크 모드에서만 측정한다)
+	TestKindBenchmark,
+	// 퍼징 테스트(FUZZ_TEST, 퍼징 모드에서 libFuzzer 로 실행한다)
+	TestKindFuzz,
+	// 비동기 테스트(ASYNC_TEST, epoll 이벤트 루프에서 여러 개가 동시에 진행된다)
+	TestKindAsync
+} TestKind;
+
+/**
+ * @enum TestAsyncEvent
+ * @brief ASYNC_WATCH 로 기다릴 이벤트와 콜백 함수에 전달되는 이벤트를 지정하기 위한 열거형(비트 조합)
+ */
+typedef enum _TestAsyncEvent_t
+{
+	// 읽을 수 있음
+	TestAsyncRead = 0x1,
+	// 쓸 수 있음
+	TestAsyncWrite = 0x2,
+	// 오류 또는 연결 끊김(기다리지 않아도 전달된다)
+	TestAsyncHangup = 0x4,
+	// ASYNC_TIMER 의 시간이 지남(타이머 콜백 함수에만 전달된다)
+	TestAsyncTimer = 0x8
+} TestAsyncEvent;
+
+/**
+ * @enum TestOrder
+ * @brief 선택된 테스트들의 실행 순서를 지정하기 위한 열거형(상태 파일에 기록된 이전 실행 결과를 사용한다)
+ */
+typedef enum _TestOrder_t
+{
+	// 정의 순서(등록 순서)
+	TestOrderDefined = 0,
+	// 지난 실행에서 실패한 테스트, 기록이 없는 새 테스트, 성공한 테스트 순서
+	TestOrderFailedFirst,
+	// 지난 실행 시간이 긴 테스트부터(병렬 실행에서 작업자들이 비슷한 시간에 끝나도록)
+	TestOrderLongestFirst
+} TestOrder;
+
+/**
+ * @enum TestFixtureKind
+ * @brief 테스트 케이스 픽스처 함수의 종류를 지정하기 위한 열거형
+ */
+typedef enum _TestFixtureKind_t
+{
+	// 테스트 케이스의 테스트마다 테스트 함수 전에 실행(SETUP)
+	TestFixtureSetup = 0,
+	// 테스트 케이스의 테스트마다 테스트 함수 후에 실행(TEARDOWN)
+	TestFixtureTeardown,
+	// 테스트 케이스의 첫 번째 테스트 전에 한 번만 실행(SHARED_SETUP)
+	TestFixtureSharedSetup,
+	// 테스트 케이스의 마지막 테스트 후에 한 번만 실행(SHARED_TEARDOWN)
+	TestFixtureSharedTeardown
+} TestFixtureKind;
+
+/**
+ * @enum TestBaselineStatus
+ * @brief 벤치마크 측정 결과를 기준 결과(baseline)와 비교한 결과를 지정하기 위한 열거형
+ */
+typedef enum _TestBaselineStatus_t
+{
+	// 비교하지 않음(기준 결과 파일을 지정하지 않았거나 측정하지 못함)
+	TestBaselineNone = 0,
+	// 기준 결과가 없어 이번 측정 결과를 기준 결과로 기록
+	TestBaselineNew,
+	// 유의미한 차이 없음
+	TestBaselineUnchanged,
+	// 유의미하게 빨라짐
+	TestBaselineImproved,
+	// 유의미하게 느려짐(성능 저하, 테스트 실패로 기록)
+	TestBaselineRegressed
+} TestBaselineStatus;
+
 /**
  * @enum TestInitializationResult
  * @brief 함수 실행 결과에 대한 상태값을 지정하기 위한 열거형
@@ -57,61 +143,278 @@ typedef enum _testInitializationResult_t
 #define FALSE 0
 #endif
 
+// 리포터 출력 버퍼(TestSink) 크기
+#define TEST_SINK_BUFFER_SIZE (1024 * 1024)
+
+// 테스트 레코드를 모아 두는 링커 섹션 이름(__start_ttlib_tests, __stop_ttlib_tests 심볼로 범위를 얻는다)
+#define TEST_SECTION_NAME "ttlib_tests"
+
+// 테스트 레코드 포인터를 링커 섹션에 정의 순서대로 배치하기 위한 속성(GCC 는 최적화 시 전역 변수 순서를 바꾸므로 no_reorder 사용)
+#if defined(__GNUC__) && !defined(__clang__)
+#define TEST_SECTION_ATTRIBUTE __attribute__((used, no_reorder, section(TEST_SECTION_NAME), aligned(sizeof(void*))))
+#else
+#define TEST_SECTION_ATTRIBUTE __attribute__((used, section(TEST_SECTION_NAME), aligned(sizeof(void*))))
+#endif
+
+// 픽스처 레코드를 모아 두는 링커 섹션 이름(__start_ttlib_fixtures, __stop_ttlib_fixtures 심볼로 범위를 얻는다)
+#define TEST_FIXTURE_SECTION_NAME "ttlib_fixtures"
+
+// 픽스처 레코드 포인터를 링커 섹션에 배치하기 위한 속성
+#define TEST_FIXTURE_SECTION_ATTRIBUTE __attribute__((used, section(TEST_FIXTURE_SECTION_NAME), aligned(sizeof(void*))))
+
+// 테스트 데이터 파일 레코드를 모아 두는 링커 섹션 이름(__start_ttlib_data, __stop_ttlib_data 심볼로 범위를 얻는다)
+#define TEST_DATA_SECTION_NAME "ttlib_data"
+
+// 테스트 데이터 파일 레코드 포인터를 링커 섹션에 배치하기 위한 속성
+#define TEST_DATA_SECTION_ATTRIBUTE __attribute__((used, section(TEST_DATA_SECTION_NAME), aligned(sizeof(void*))))
+
 //////////////////////////////////////////////////////////////////////////////////
 /// Control Macro Functions
 //////////////////////////////////////////////////////////////////////////////////
 
-// 매크로 함수에서 매개변수가 함수일 경우, 한 번만 실행되도록 하기 위해 그 결과값을 저장하는 변수(상황에 맞게 사용)
-void *_actualPtr;
-void *_expectedPtr;
-int _actualint;
-int _expectedint;
-long _actuallong;
-long _expectedlong;
-long long _actuallonglong;
-long long _expectedlonglong;
-char *_actualStr;
-char *_expectedStr;
+// 매크로 함수에서 매개변수가 함수일 경우, 한 번만 실행되도록 하기 위해 그 결과값을 저장하는 변수들은
+// 테스트마다 생성되는 TestContext 객체에 있으며, 현재 스레드에서 실행 중인 테스트의 TestContext 객체는 _testContext 로 접근한다.
 
 // 테스트 진행을 위한 TestSuit 객체를 전역변수로 선언하기 위한 함수
 #define DECLARE_TEST() static TestSuitPtr _testSuit = NULL;
 
 // 테스트 함수를 설정하고 TestSuit 객체에 추가하기 위한 함수
-#define TEST(C, T, F) \
+// 테스트 정보는 정적 Test 레코드로 만들어지고, 그 주소가 링커 섹션(ttlib_tests)에 배치되어 자동으로 등록된다(힙 할당 없음).
+#define TEST(C, T, F) TEST_TIMEOUT(C, T, 0, F)
+
+// 제한 시간(밀리초)을 지정하여 테스트 함수를 설정하는 함수(0 이면 실행 옵션의 기본 제한 시간을 사용)
+// 제한 시간을 넘기면 테스트를 중단하고 TestTimeout 으로 기록한 뒤 다음 테스트를 실행한다.
+#define TEST_TIMEOUT(C, T, MS, F) \
 	TestResult _##C##_##T(TestSuitPtr testSuit) \
 { \
-	int failCount = 0; \
+	(void)testSuit; \
 	F; \
-	if(failCount > 0){ \
-		failCount = 0; \
-		testSuit->numberOfFailTests++; \
+	if(_testContext->failCount > 0){ \
 		return TestFail; \
 	} \
 	return TestSuccess; \
 } \
-void Test_##C##_##T() \
-{ \
-	if(AddTest(_testSuit, (Test){#C, #T, _##C##_##T}) == NULL) { \
-		puts("테스트 추가 실패"); \
-		exit(TestExit); \
-	} \
-}
+static const Test _test_##C##_##T = {#C, #T, _##C##_##T, MS, TestKindTest, __FILE__}; \
+static const TestPtr _testPtr_##C##_##T TEST_SECTION_ATTRIBUTE = &_test_##C##_##T;
 
-// TestSuit 객체를 새로 생성하는 함수
+// TestSuit 객체를 새로 생성하고, 현재 실행 파일(또는 공유 라이브러리)의 링커 섹션에 등록된 테스트들을 연결하는 함수
 #define CREATE_TESTSUIT() \
 	_testSuit = NewTestSuit(); \
 if (_testSuit == NULL) { \
 	printf("failed to create a test suit instance!\n"); \
 	exit(-1); \
-}
+} \
+RegisterTests(_testSuit, __start_ttlib_tests, __stop_ttlib_tests); \
+RegisterTestFixtures(_testSuit, __start_ttlib_fixtures, __stop_ttlib_fixtures); \
+RegisterTestData(_testSuit, __start_ttlib_data, __stop_ttlib_data);
+
+// 테스트 케이스(C)의 테스트마다 테스트 함수 전에 실행할 코드(F)를 지정하는 함수
+// 테스트 함수와 같은 TestContext 객체에서 실행되므로 EXPECT, ASSERT 매크로 함수를 사용할 수 있고, 실패하면 테스트 함수를 실행하지 않는다.
+#define SETUP(C, F) TEST_FIXTURE(C, Setup, TestFixtureSetup, F)
+
+// 테스트 케이스(C)의 테스트마다 테스트 함수 후에 실행할 코드(F)를 지정하는 함수(SETUP 이 실패해도 실행된다)
+#define TEARDOWN(C, F) TEST_FIXTURE(C, Teardown, TestFixtureTeardown, F)
+
+// 테스트 케이스(C)의 테스트들이 함께 사용할 데이터를 만드는 코드(F)를 지정하는 함수
+// 테스트 케이스의 테스트가 처음 실행될 때 한 번만 실행되며, 실행 시간과 메모리 할당은 테스트에 포함되지 않는다.
+// 실패하면 그 테스트 케이스의 테스트들은 테스트 함수를 실행하지 않고 실패로 기록된다.
+#define SHARED_SETUP(C, F) TEST_FIXTURE(C, SharedSetup, TestFixtureSharedSetup, F)
+
+// 테스트 케이스(C)의 선택된 테스트가 모두 끝난 뒤 공유 데이터를 정리하는 코드(F)를 지정하는 함수(마지막 테스트의 결과에 포함된다)
+#define SHARED_TEARDOWN(C, F) TEST_FIXTURE(C, SharedTeardown, TestFixtureSharedTeardown, F)
+
+// 픽스처 함수를 정의하고 그 레코드를 링커 섹션(ttlib_fixtures)에 배치하는 함수
+#define TEST_FIXTURE(C, N, K, F) \
+	static void _fixture_##C##_##N(void) \
+{ \
+	F; \
+} \
+static const TestFixture _testFixture_##C##_##N = {#C, _fixture_##C##_##N, K, __FILE__, __LINE__}; \
+static const TestFixturePtr _testFixturePtr_##C##_##N TEST_FIXTURE_SECTION_ATTRIBUTE = &_testFixture_##C##_##N;
+
+// 테스트(C.T)가 읽는 데이터 파일(P)을 선언하는 함수(결과 캐시(--cache)에서 파일 내용이 바뀌면 테스트를 다시 실행한다)
+// 한 테스트에 여러 번 선언할 수 있고, 상대 경로는 테스트를 실행하는 디렉터리 기준이다.
+#define TEST_DATA(C, T, P) TEST_DATA_AT(C, T, P, __LINE__)
 
-// 테스트 함수를 등록하기 위한 함수
-#define REGISTER_TESTS(X...) \
-	_testSuit->initializers = (TestSuitInitializer[]){ \
-		X, \
-		NULL};
+// TEST_DATA 의 줄 번호를 펼쳐 레코드 이름을 만들기 위한 함수
+#define TEST_DATA_AT(C, T, P, L) TEST_DATA_RECORD(C, T, P, L)
 
-// 모든 테스트 함수를 동작시키기 위한 함수
+// 테스트 데이터 파일 레코드를 정의하고 링커 섹션(ttlib_data)에 배치하는 함수
+#define TEST_DATA_RECORD(C, T, P, L) \
+static const TestData _testData_##C##_##T##_##L = {#C, #T, P}; \
+static const TestDataPtr _testDataPtr_##C##_##T##_##L TEST_DATA_SECTION_ATTRIBUTE = &_testData_##C##_##T##_##L;
+
+// 벤치마크를 정의하는 함수(F 는 측정 대상 코드로, 보정된 횟수만큼 반복 실행된다)
+// 벤치마크 모드(--benchmark)에서만 실행 시간을 측정하고, 그 밖에는 F 를 한 번만 실행하여 동작 여부만 검사한다.
+#define BENCHMARK(C, N, F) \
+	static void _benchmark_##C##_##N(long long _iterations) \
+{ \
+	long long _iteration = 0; \
+	for (; _iteration < _iterations; _iteration++) \
+	{ \
+		F; \
+	} \
+} \
+	TestResult _##C##_##N(TestSuitPtr testSuit) \
+{ \
+	(void)testSuit; \
+	RunBenchmark(_benchmark_##C##_##N); \
+	if(_testContext->failCount > 0){ \
+		return TestFail; \
+	} \
+	return TestSuccess; \
+} \
+static const Test _test_##C##_##N = {#C, #N, _##C##_##N, 0, TestKindBenchmark, __FILE__}; \
+static const TestPtr _testPtr_##C##_##N TEST_SECTION_ATTRIBUTE = &_test_##C##_##N;
+
+// 속성 기반 테스트를 정의하는 함수
+// G 는 GEN_ 함수로 입력 값을 만드는 변수 선언들이고(예: char *s = GEN_STRING(1, 64, NULL); char d = GEN_DELIMITER(NULL)),
+// F 는 그 입력에 대해 항상 성립해야 하는 속성을 EXPECT, ASSERT 매크로 함수로 검사하는 코드이다.
+// 실행 옵션의 입력 개수만큼 G 와 F 를 반복 실행하고, 실패하는 입력을 찾으면 같은 실패가 나는 가장 작은 입력으로 줄여 그 값과 재현용 seed 를 출력한다.
+// 만든 입력 값은 입력 하나를 실행할 때마다 해제되므로 F 에서 해제하지 않는다.
+#define PROPERTY(C, T, G, F) \
+	static void _property_##C##_##T(void) \
+{ \
+	G; \
+	F; \
+} \
+	TestResult _##C##_##T(TestSuitPtr testSuit) \
+{ \
+	(void)testSuit; \
+	RunProperty(_property_##C##_##T, __FILE__, __LINE__); \
+	if(_testContext->failCount > 0){ \
+		return TestFail; \
+	} \
+	return TestSuccess; \
+} \
+static const Test _test_##C##_##T = {#C, #T, _##C##_##T, 0, TestKindTest, __FILE__}; \
+static const TestPtr _testPtr_##C##_##T TEST_SECTION_ATTRIBUTE = &_test_##C##_##T;
+
+// 속성을 검사할 입력의 조건을 지정하는 함수(조건을 만족하지 않는 입력은 성공이나 실패로 세지 않고 버린다)
+#define PROPERTY_ASSUME(condition) \
+	if(!(condition)) { \
+		DiscardTestProperty(); \
+		return; }
+
+// min 이상 max 이하의 정수를 만드는 함수(0 에 가까운 값으로 줄어든다)
+#define GEN_INT(min, max) GenerateTestInt((long long)(min), (long long)(max))
+
+// alphabet 의 문자로 길이가 minLength 이상 maxLength 이하인 문자열을 만드는 함수(alphabet 이 NULL 이면 출력 가능한 ASCII 문자와 \t, \n 사용)
+#define GEN_STRING(minLength, maxLength, alphabet) GenerateTestString((int)(minLength), (int)(maxLength), alphabet)
+
+// 길이가 minLength 이상 maxLength 이하인 바이트 배열(TestBytes)을 만드는 함수
+#define GEN_BYTES(minLength, maxLength) GenerateTestBytes((int)(minLength), (int)(maxLength))
+
+// 길이가 0 이상 maxLength 이하인 문자열을 minCount 개 이상 maxCount 개 이하로 가진 문자열 배열(TestStrings, NULL 로 끝난다)을 만드는 함수
+#define GEN_STRINGS(minCount, maxCount, maxLength, alphabet) GenerateTestStrings((int)(minCount), (int)(maxCount), (int)(maxLength), alphabet)
+
+// delimiters 의 문자 중 하나를 고르는 함수(delimiters 가 NULL 이면 ",;|:/ \t\n" 사용)
+#define GEN_DELIMITER(delimiters) GenerateTestDelimiter(delimiters)
+
+// 구현과 기준 구현(예: libc 함수)의 결과를 대량의 입력으로 비교하는 차분 테스트를 정의하는 함수
+// G 와 F 는 PROPERTY 와 같고, F 에서 두 구현을 실행하여 EXPECT_SAME_ 매크로 함수로 결과를 비교한다.
+// 실행 옵션의 차분 테스트 입력 개수(기본 1000000 개)를 묶음 단위로 여러 스레드(기본 CPU 개수)에 나눠 검사하고,
+// 처음으로 결과가 달라진 입력을 같은 불일치가 나는 가장 작은 입력으로 줄여 두 결과와 함께 출력한다.
+#define DIFFERENTIAL(C, T, G, F) \
+	static void _property_##C##_##T(void) \
+{ \
+	G; \
+	F; \
+} \
+	TestResult _##C##_##T(TestSuitPtr testSuit) \
+{ \
+	(void)testSuit; \
+	RunDifferential(_property_##C##_##T, __FILE__, __LINE__); \
+	if(_testContext->failCount > 0){ \
+		return TestFail; \
+	} \
+	return TestSuccess; \
+} \
+static const Test _test_##C##_##T = {#C, #T, _##C##_##T, 0, TestKindTest, __FILE__}; \
+static const TestPtr _testPtr_##C##_##T TEST_SECTION_ATTRIBUTE = &_test_##C##_##T;
+
+// 퍼징 테스트를 정의하는 함수(D 는 입력 바이트 배열(const unsigned char *), S 는 입력 길이(size_t)의 매개변수 이름이고, F 는 그 입력으로 대상 코드를 실행하는 코드이다)
+// 보통 실행에서는 빈 입력과 코퍼스 디렉터리(--fuzz-corpus)에 저장된 입력 파일들로 F 를 한 번씩 실행하는 회귀 테스트이고,
+// -fsanitize=fuzzer 로 빌드하여 --fuzz=테스트케이스.테스트이름 으로 실행하면 libFuzzer 가 커버리지를 따라 만든 입력으로 F 를 계속 실행한다.
+#define FUZZ_TEST(C, T, D, S, F) \
+	static void _fuzz_##C##_##T(const unsigned char *D, size_t S) \
+{ \
+	(void)D; \
+	(void)S; \
+	F; \
+} \
+	TestResult _##C##_##T(TestSuitPtr testSuit) \
+{ \
+	(void)testSuit; \
+	RunFuzzTest(_fuzz_##C##_##T); \
+	if(_testContext->failCount > 0){ \
+		return TestFail; \
+	} \
+	return TestSuccess; \
+} \
+static const Test _test_##C##_##T = {#C, #T, _##C##_##T, 0, TestKindFuzz, __FILE__}; \
+static const TestPtr _testPtr_##C##_##T TEST_SECTION_ATTRIBUTE = &_test_##C##_##T;
+
+// 비동기 테스트를 정의하는 함수(F 는 소켓 등의 파일 디스크립터를 ASYNC_WATCH, ASYNC_TIMER 로 등록하고 돌아가는 시작 코드이다)
+// 등록한 파일 디스크립터가 준비되거나 타이머의 시간이 지나면 이벤트 루프가 콜백 함수를 호출하고, 콜백 함수에서 EXPECT, ASSERT 매크로 함수로 검사한다.
+// ASYNC_DONE 을 호출하거나 등록한 것이 하나도 남지 않으면(또는 ASSERT 가 실패하면) 테스트가 끝난다.
+// 순차 실행과 작업자 스레드 실행(-t)에서는 선택된 ASYNC_TEST 들을 다른 테스트보다 먼저 하나의 epoll 이벤트 루프에서 최대 --async-limit 개까지 동시에 진행한다.
+#define ASYNC_TEST(C, T, F) ASYNC_TEST_TIMEOUT(C, T, 0, F)
+
+// 제한 시간(밀리초)을 지정하여 비동기 테스트를 정의하는 함수(0 이면 실행 옵션의 기본 제한 시간을 사용, 시작부터 끝날 때까지의 시간)
+#define ASYNC_TEST_TIMEOUT(C, T, MS, F) \
+	static void _async_##C##_##T(void) \
+{ \
+	F; \
+} \
+	TestResult _##C##_##T(TestSuitPtr testSuit) \
+{ \
+	(void)testSuit; \
+	RunAsyncTest(_async_##C##_##T); \
+	if(_testContext->failCount > 0){ \
+		return TestFail; \
+	} \
+	return TestSuccess; \
+} \
+static const Test _test_##C##_##T = {#C, #T, _##C##_##T, MS, TestKindAsync, __FILE__}; \
+static const TestPtr _testPtr_##C##_##T TEST_SECTION_ATTRIBUTE = &_test_##C##_##T;
+
+// 파일 디스크립터(fd)가 이벤트(events, TestAsyncRead | TestAsyncWrite)에 준비될 때마다 callback(fd, 준비된 이벤트, data) 를 호출하도록 등록하는 함수
+// ASYNC_UNWATCH 전까지 유지되며(같은 fd 를 다시 등록하면 이벤트와 콜백 함수를 바꾼다), fd 를 닫기 전에 ASYNC_UNWATCH 해야 한다. 성공 시 0, 실패 시 -1 반환
+#define ASYNC_WATCH(fd, events, callback, data) WatchAsyncTestFd(fd, events, callback, data)
+
+// 등록한 파일 디스크립터(또는 ASYNC_TIMER 가 반환한 타이머 번호)의 감시를 해제하는 함수(fd 는 닫지 않는다)
+#define ASYNC_UNWATCH(fd) UnwatchAsyncTestFd(fd)
+
+// 지정한 시간(밀리초)이 지나면 callback(-1, TestAsyncTimer, data) 를 한 번 호출하도록 등록하는 함수(성공 시 타이머 번호, 실패 시 -1 반환)
+#define ASYNC_TIMER(milliseconds, callback, data) StartAsyncTestTimer(milliseconds, callback, data)
+
+// 현재 비동기 테스트를 끝내는 함수(남은 감시는 해제된다)
+#define ASYNC_DONE() FinishAsyncTest()
+
+// 컴파일러가 값을 계산하는 코드를 제거하지 못하도록 값을 사용한 것으로 표시하는 함수(벤치마크에서 사용)
+#define DO_NOT_OPTIMIZE(value) __asm__ __volatile__("" : : "r,m"(value) : "memory")
+
+// 컴파일러가 메모리 쓰기를 제거하거나 순서를 바꾸지 못하도록 하는 함수(벤치마크에서 사용, 주소가 노출된 메모리에만 적용된다)
+#define CLOBBER_MEMORY() __asm__ __volatile__("" : : : "memory")
+
+// 측정 대상 코드가 한 번에 처리하는 바이트 수를 지정하는 함수(초당 처리 바이트 수 계산에 사용)
+#define SET_BENCHMARK_BYTES(bytes) SetBenchmarkCounters((long long)(bytes), -1)
+
+// 측정 대상 코드가 한 번에 처리하는 항목 수를 지정하는 함수(초당 처리 항목 수 계산에 사용)
+#define SET_BENCHMARK_ITEMS(items) SetBenchmarkCounters(-1, (long long)(items))
+
+// (이전 버전 호환용) 테스트는 TEST 매크로 함수에서 자동으로 등록되므로 아무 동작도 하지 않는다.
+#define REGISTER_TESTS(X...)
+
+// 명령행 옵션(-j N 등)을 TestSuit 객체에 적용하기 위한 함수
+#define PARSE_TEST_OPTIONS(argc, argv) \
+	if (ParseTestOptions(_testSuit, argc, argv) == TestInitializationResultFail) { \
+	CLEAN_UP_TESTSUIT(); \
+	exit(-1); \
+}
+
+// 모든 테스트 함수를 동작시키기 위한 함수(모든 테스트가 성공하면 0, 실패한 테스트나 성능 저하 벤치마크가 있으면 1 반환)
 #define RUN_ALL_TESTS() RunAllTests(_testSuit)
 
 // TestSuit 객체를 삭제하는 함수
@@ -121,12 +424,16 @@ if (_testSuit == NULL) { \
 /// Print Macro Functions
 //////////////////////////////////////////////////////////////////////////////////
 
-// 테스트 실패 시 출력할 내용을 지정하는 함수
+// 테스트 실패 정보를 리포터에 전달하는 함수(출력 형식은 선택된 리포터가 결정한다)
+// 매크로 함수 이름, 파일 이름, 줄 번호, 포맷 문자열은 호출 위치마다 정적 기술자로 한 번만 만들고(모두 상수여야 한다),
+// 실패할 때는 기술자와 인자 값만 현재 스레드의 TestContext 에 바이너리로 기록한다. 메시지는 리포터에 전달할 때 포맷팅된다.
+// 실행 중에 정해지는 파일 이름 등으로 실패를 알리려면 ReportTestFailure 함수를 사용한다.
+// 테스트 본문이 다른 매크로 함수의 인자로 전달되므로 기술자 초기화의 쉼표가 괄호 밖에 나오지 않도록 문장 식으로 감싼다.
 #define PRINT_FAIL(functionName, fileName, lineNumber, format, ...) \
-	printf("(FAIL) ["functionName"] "format" (file:%s, line:%d)\n", __VA_ARGS__, fileName, lineNumber); \
-	failCount++; \
+	RecordTestFailure(({ static const TestFailureSite _failureSite = {functionName, fileName, lineNumber, format}; &_failureSite; }), format, __VA_ARGS__); \
+	_testContext->failCount++; \
 	if(functionName[0] == 'A') { \
-		SetExitTestSuit(_testSuit); }
+		_testContext->onGoing = TestExit; }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// Format Macros
@@ -140,6 +447,10 @@ if (_testSuit == NULL) { \
 #define NUM2_FORMAT_longlong "actual:%lld, expected:%lld"
 #define PTR_FORMAT "actual:%p, expected:%p"
 #define STR_FORMAT "actual:%s, expected:%s"
+#define SAME_FORMAT_int "implementation:%d, reference:%d"
+#define SAME_FORMAT_long "implementation:%ld, reference:%ld"
+#define SAME_FORMAT_longlong "implementation:%lld, reference:%lld"
+#define SAME_STR_FORMAT "implementation:\"%s\", reference:\"%s\""
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (EXPECT) NULL Macro Functions
@@ -148,13 +459,13 @@ if (_testSuit == NULL) { \
 
 // 실제 값이 NULL 인지 검사하는 함수
 #define EXPECT_NULL(actual) \
-	_actualPtr = actual; \
-	if(_actualPtr != NULL) { PRINT_FAIL("EXPECT_NULL", __FILE__, __LINE__, NULL_FORMAT, _actualPtr); }
+	_testContext->_actualPtr = actual; \
+	if(_testContext->_actualPtr != NULL) { PRINT_FAIL("EXPECT_NULL", __FILE__, __LINE__, NULL_FORMAT, _testContext->_actualPtr); }
 
 // 실제 값이 NULL 이 아닌지 검사하는 함수
 #define EXPECT_NOT_NULL(actual) \
-	_actualPtr = actual; \
-	if(_actualPtr == NULL) { PRINT_FAIL("EXPECT_NOT_NULL", __FILE__, __LINE__, NULL_FORMAT, _actualPtr); }
+	_testContext->_actualPtr = actual; \
+	if(_testContext->_actualPtr == NULL) { PRINT_FAIL("EXPECT_NOT_NULL", __FILE__, __LINE__, NULL_FORMAT, _testContext->_actualPtr); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (EXPECT) Pointer Macro Functions
@@ -163,15 +474,15 @@ if (_testSuit == NULL) { \
 
 // 실제 주소값과 기대하는 주소값이 같은지 검사하는 함수
 #define EXPECT_PTR_EQUAL(actual, expected) \
-	_actualPtr = actual; \
-	_expectedPtr = expected; \
-	if(_actualPtr != _expectedPtr) { PRINT_FAIL("EXPECT_PTR_EQUAL", __FILE__, __LINE__, PTR_FORMAT, _actualPtr, _expectedPtr); }
+	_testContext->_actualPtr = actual; \
+	_testContext->_expectedPtr = expected; \
+	if(_testContext->_actualPtr != _testContext->_expectedPtr) { PRINT_FAIL("EXPECT_PTR_EQUAL", __FILE__, __LINE__, PTR_FORMAT, _testContext->_actualPtr, _testContext->_expectedPtr); }
 
 // 실제 주소값과 기대하는 주소값이 다른지 검사하는 함수
 #define EXPECT_PTR_NOT_EQUAL(actual, expected) \
-	_actualPtr = actual; \
-	_expectedPtr = expected; \
-	if(_actualPtr == _expectedPtr) { PRINT_FAIL("EXPECT_PTR_NOT_EQUAL", __FILE__, __LINE__, PTR_FORMAT, _actualPtr, _expectedPtr); }
+	_testContext->_actualPtr = actual; \
+	_testContext->_expectedPtr = expected; \
+	if(_testContext->_actualPtr == _testContext->_expectedPtr) { PRINT_FAIL("EXPECT_PTR_NOT_EQUAL", __FILE__, __LINE__, PTR_FORMAT, _testContext->_actualPtr, _testContext->_expectedPtr); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (EXPECT) Number Macro Functions
@@ -180,49 +491,49 @@ if (_testSuit == NULL) { \
 
 // 실제 값과 기대하는 값이 같은지 검사하는 함수
 #define EXPECT_NUM_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type != _expected##type) { PRINT_FAIL("EXPECT_NUM_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type != _testContext->_expected##type) { PRINT_FAIL("EXPECT_NUM_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값과 기대하는 값이 다른지 검사하는 함수
 #define EXPECT_NUM_NOT_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type == _expected##type) { PRINT_FAIL("EXPECT_NUM_NOT_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type == _testContext->_expected##type) { PRINT_FAIL("EXPECT_NUM_NOT_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 작거나 같은지 검사하는 함수
 #define EXPECT_NUM_LESS_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type > _expected##type) { PRINT_FAIL("EXPECT_NUM_LESS_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type > _testContext->_expected##type) { PRINT_FAIL("EXPECT_NUM_LESS_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 작은지 검사하는 함수
 #define EXPECT_NUM_LESS_THAN(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type >= _expected##type) { PRINT_FAIL("EXPECT_NUM_LESS_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type >= _testContext->_expected##type) { PRINT_FAIL("EXPECT_NUM_LESS_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 크거나 같은지 검사하는 함수
 #define EXPECT_NUM_GREATER_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type < _expected##type) { PRINT_FAIL("EXPECT_NUM_GREATER_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type < _testContext->_expected##type) { PRINT_FAIL("EXPECT_NUM_GREATER_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 큰지 검사하는 함수
 #define EXPECT_NUM_GREATER_THAN(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type <= _expected##type) { PRINT_FAIL("EXPECT_NUM_GREATER_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type <= _testContext->_expected##type) { PRINT_FAIL("EXPECT_NUM_GREATER_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 지정한 숫자가 짝수인지 검사하는 함수
 #define EXPECT_NUM_EVEN(actual, type) \
-	_actual##type = actual; \
-	if(_actual##type % 2 != 0) { PRINT_FAIL("EXPECT_NUM_EVEN", __FILE__, __LINE__, NUM1_FORMAT_##type, _actual##type); }
+	_testContext->_actual##type = actual; \
+	if(_testContext->_actual##type % 2 != 0) { PRINT_FAIL("EXPECT_NUM_EVEN", __FILE__, __LINE__, NUM1_FORMAT_##type, _testContext->_actual##type); }
 
 // 지정한 숫자가 홀수인지 검사하는 함수
 #define EXPECT_NUM_ODD(actual, type) \
-	_actual##type = actual; \
-	if(_actual##type % 2 != 1) { PRINT_FAIL("EXPECT_NUM_ODD", __FILE__, __LINE__, NUM1_FORMAT_##type, _actual##type); }
+	_testContext->_actual##type = actual; \
+	if(_testContext->_actual##type % 2 != 1) { PRINT_FAIL("EXPECT_NUM_ODD", __FILE__, __LINE__, NUM1_FORMAT_##type, _testContext->_actual##type); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (EXPECT) String Macro Functions
@@ -231,15 +542,61 @@ if (_testSuit == NULL) { \
 
 // 실제 문자열과 기대하는 문자열이 같은지 검사하는 함수
 #define EXPECT_STR_EQUAL(actual, expected) \
-	_actualStr = actual; \
-	_expectedStr = expected; \
-	if(strncmp(_actualStr, _expectedStr, strlen(_expectedStr)) != 0) { PRINT_FAIL("EXPECT_STR_EQUAL", __FILE__, __LINE__, STR_FORMAT, _actualStr, _expectedStr); }
+	_testContext->_actualStr = actual; \
+	_testContext->_expectedStr = expected; \
+	if(strncmp(_testContext->_actualStr, _testContext->_expectedStr, strlen(_testContext->_expectedStr)) != 0) { PRINT_FAIL("EXPECT_STR_EQUAL", __FILE__, __LINE__, STR_FORMAT, _testContext->_actualStr, _testContext->_expectedStr); }
 
 // 실제 문자열과 기대하는 문자열이 다른지 검사하는 함수
 #define EXPECT_STR_NOT_EQUAL(actual, expected) \
-	_actualStr = actual; \
-	_expectedStr = expected; \
-	if(strncmp(_actualStr, _expectedStr, strlen(_expectedStr)) == 0) { PRINT_FAIL("EXPECT_STR_NOT_EQUAL", __FILE__, __LINE__, STR_FORMAT, _actualStr, _expectedStr); }
+	_testContext->_actualStr = actual; \
+	_testContext->_expectedStr = expected; \
+	if(strncmp(_testContext->_actualStr, _testContext->_expectedStr, strlen(_testContext->_expectedStr)) == 0) { PRINT_FAIL("EXPECT_STR_NOT_EQUAL", __FILE__, __LINE__, STR_FORMAT, _testContext->_actualStr, _testContext->_expectedStr); }
+
+//////////////////////////////////////////////////////////////////////////////////
+/// (EXPECT) Allocation Macro Functions
+/// 실패해도 현재 진행 중인 테스트가 종료되지 않는다.
+/// 테스트 함수를 실행하는 스레드의 malloc, calloc, realloc, reallocarray, memalign, aligned_alloc, posix_memalign, valloc 호출만 집계한다
+/// (테스트가 만든 스레드의 할당과 mmap 등으로 직접 얻은 메모리는 제외).
+//////////////////////////////////////////////////////////////////////////////////
+
+// 현재 테스트가 지금까지 메모리를 할당한 횟수가 지정한 횟수 이하인지 검사하는 함수
+#define EXPECT_MAX_ALLOCS(max) \
+	_testContext->_actuallonglong = GetTestAllocationCount(); \
+	_testContext->_expectedlonglong = max; \
+	if(_testContext->_actuallonglong > _testContext->_expectedlonglong) { PRINT_FAIL("EXPECT_MAX_ALLOCS", __FILE__, __LINE__, NUM2_FORMAT_longlong, _testContext->_actuallonglong, _testContext->_expectedlonglong); }
+
+// 지정한 코드(F)가 메모리를 할당하지 않는지 검사하는 함수
+#define EXPECT_NO_ALLOC(F) \
+	{ \
+	long long _allocationsBefore = GetTestAllocationCount(); \
+	F; \
+	_testContext->_actuallonglong = GetTestAllocationCount() - _allocationsBefore; \
+	if(_testContext->_actuallonglong != 0) { PRINT_FAIL("EXPECT_NO_ALLOC", __FILE__, __LINE__, NUM1_FORMAT_longlong, _testContext->_actuallonglong); } \
+	}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// (EXPECT) Differential Macro Functions
+/// 실패해도 현재 진행 중인 테스트가 종료되지 않는다.
+/// 차분 테스트(DIFFERENTIAL)에서 구현의 결과(implementation)와 기준 구현의 결과(reference)를 비교한다.
+//////////////////////////////////////////////////////////////////////////////////
+
+// 구현과 기준 구현의 결과 값이 같은지 검사하는 함수
+#define EXPECT_SAME_NUM(implementation, reference, type) \
+	_testContext->_actual##type = implementation; \
+	_testContext->_expected##type = reference; \
+	if(_testContext->_actual##type != _testContext->_expected##type) { PRINT_FAIL("EXPECT_SAME_NUM", __FILE__, __LINE__, SAME_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
+
+// 구현과 기준 구현의 결과 값의 부호가 같은지 검사하는 함수(strcmp 처럼 부호만 정해진 비교 결과에 사용)
+#define EXPECT_SAME_SIGN(implementation, reference, type) \
+	_testContext->_actual##type = implementation; \
+	_testContext->_expected##type = reference; \
+	if((_testContext->_actual##type > 0) - (_testContext->_actual##type < 0) != (_testContext->_expected##type > 0) - (_testContext->_expected##type < 0)) { PRINT_FAIL("EXPECT_SAME_SIGN", __FILE__, __LINE__, SAME_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
+
+// 구현과 기준 구현의 결과 문자열이 같은지 검사하는 함수(길이까지 같아야 하고, 둘 다 NULL 이어도 같다)
+#define EXPECT_SAME_STR(implementation, reference) \
+	_testContext->_actualStr = implementation; \
+	_testContext->_expectedStr = reference; \
+	if((_testContext->_actualStr == NULL || _testContext->_expectedStr == NULL) ? (_testContext->_actualStr != _testContext->_expectedStr) : (strcmp(_testContext->_actualStr, _testContext->_expectedStr) != 0)) { PRINT_FAIL("EXPECT_SAME_STR", __FILE__, __LINE__, SAME_STR_FORMAT, _testContext->_actualStr, _testContext->_expectedStr); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (ASSERT) NULL Macro Functions
@@ -248,13 +605,13 @@ if (_testSuit == NULL) { \
 
 // 실제 값이 NULL 인지 검사하는 함수
 #define ASSERT_NULL(actual) \
-	_actualPtr = actual; \
-	if(_actualPtr != NULL) { PRINT_FAIL("ASSERT_NULL", __FILE__, __LINE__, NULL_FORMAT, _actualPtr); }
+	_testContext->_actualPtr = actual; \
+	if(_testContext->_actualPtr != NULL) { PRINT_FAIL("ASSERT_NULL", __FILE__, __LINE__, NULL_FORMAT, _testContext->_actualPtr); }
 
 // 실제 값이 NULL 이 아닌지 검사하는 함수
 #define ASSERT_NOT_NULL(actual) \
-	_actualPtr = actual; \
-	if(_actualPtr == NULL) { PRINT_FAIL("ASSERT_NOT_NULL", __FILE__, __LINE__, NULL_FORMAT, _actualPtr); }
+	_testContext->_actualPtr = actual; \
+	if(_testContext->_actualPtr == NULL) { PRINT_FAIL("ASSERT_NOT_NULL", __FILE__, __LINE__, NULL_FORMAT, _testContext->_actualPtr); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (ASSERT) Number Macro Functions
@@ -263,49 +620,49 @@ if (_testSuit == NULL) { \
 
 // 실제 값과 기대하는 값이 같은지 검사하는 함수 
 #define ASSERT_NUM_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type != _expected##type) { PRINT_FAIL("ASSERT_NUM_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type != _testContext->_expected##type) { PRINT_FAIL("ASSERT_NUM_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값과 기대하는 값이 다른지 검사하는 함수
 #define ASSERT_NUM_NOT_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type == _expected##type) { PRINT_FAIL("ASSERT_NUM_NOT_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type == _testContext->_expected##type) { PRINT_FAIL("ASSERT_NUM_NOT_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 작거나 같은지 검사하는 함수
 #define ASSERT_NUM_LESS_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type > _expected##type) { PRINT_FAIL("ASSERT_NUM_LESS_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type > _testContext->_expected##type) { PRINT_FAIL("ASSERT_NUM_LESS_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 작은지 검사하는 함수
 #define ASSERT_NUM_LESS_THAN(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type >= _expected##type) { PRINT_FAIL("ASSERT_NUM_LESS_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type >= _testContext->_expected##type) { PRINT_FAIL("ASSERT_NUM_LESS_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 크거나 같은지 검사하는 함수
 #define ASSERT_NUM_GREATER_EQUAL(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type < _expected##type) { PRINT_FAIL("ASSERT_NUM_LESS_THAN", __FILE__, __LINE__, NUM2##tyup_FORMAT, _actual##type, _expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type < _testContext->_expected##type) { PRINT_FAIL("ASSERT_NUM_GREATER_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 실제 값이 기대하는 값보다 큰지 검사하는 함수
 #define ASSERT_NUM_GREATER_THAN(actual, expected, type) \
-	_actual##type = actual; \
-	_expected##type = expected; \
-	if(_actual##type <= _expected##type) { PRINT_FAIL("ASSERT_NUM_GREATER_EQUAL", __FILE__, __LINE__, NUM2_FORMAT_##type, actual##type, expected##type); }
+	_testContext->_actual##type = actual; \
+	_testContext->_expected##type = expected; \
+	if(_testContext->_actual##type <= _testContext->_expected##type) { PRINT_FAIL("ASSERT_NUM_GREATER_THAN", __FILE__, __LINE__, NUM2_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
 
 // 지정한 숫자가 짝수인지 검사하는 함수
 #define ASSERT_NUM_EVEN(actual, type) \
-	_actual##type = actual; \
-	if(_actual##type % 2 != 0) { PRINT_FAIL("ASSERT_NUM_EVEN", __FILE__, __LINE__, NUM1_FORMAT_##type, _actual##type); }
+	_testContext->_actual##type = actual; \
+	if(_testContext->_actual##type % 2 != 0) { PRINT_FAIL("ASSERT_NUM_EVEN", __FILE__, __LINE__, NUM1_FORMAT_##type, _testContext->_actual##type); }
 
 // 지정한 숫자가 홀수인지 검사하는 함수
 #define ASSERT_NUM_ODD(actual, type)\
-	_actual##type = actual; \
-	if(_actual##type % 2 != 1) ? { PRINT_FAIL("ASSERT_NUM_ODD", __FILE__, __LINE__, NUM1_FORMAT_##type, _actual##type); }
+	_testContext->_actual##type = actual; \
+	if(_testContext->_actual##type % 2 != 1) { PRINT_FAIL("ASSERT_NUM_ODD", __FILE__, __LINE__, NUM1_FORMAT_##type, _testContext->_actual##type); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// (ASSERT) String Macro Functions
@@ -314,15 +671,61 @@ if (_testSuit == NULL) { \
 
 // 실제 문자열과 기대하는 문자열이 같은지 검사하는 함수
 #define ASSERT_STR_EQUAL(actual, expected)\
-	_actualStr = actual; \
-	_expectedStr = expected; \
-	if(strncmp(_actualStr, _expectedStr, strlen(_expectedStr)) != 0) { PRINT_FAIL("ASSERT_STR_EQUAL", __FILE__, __LINE__, STR_FORMAT, _actualStr, _expectedStr); }
+	_testContext->_actualStr = actual; \
+	_testContext->_expectedStr = expected; \
+	if(strncmp(_testContext->_actualStr, _testContext->_expectedStr, strlen(_testContext->_expectedStr)) != 0) { PRINT_FAIL("ASSERT_STR_EQUAL", __FILE__, __LINE__, STR_FORMAT, _testContext->_actualStr, _testContext->_expectedStr); }
 
 // 실제 문자열과 기대하는 문자열이 다른지 검사하는 함수
 #define ASSERT_STR_NOT_EQUAL(actual, expected) \
-	_actualStr = actual; \
-	_expectedStr = expected; \
-	if(strncmp(_actualStr, _expectedStr, strlen(_expectedStr) == 0) { PRINT_FAIL("ASSERT_STR_NOT_EQUAL", __FILE__, __LINE__, STR_FORMAT, actual, expected); }
+	_testContext->_actualStr = actual; \
+	_testContext->_expectedStr = expected; \
+	if(strncmp(_testContext->_actualStr, _testContext->_expectedStr, strlen(_testContext->_expectedStr)) == 0) { PRINT_FAIL("ASSERT_STR_NOT_EQUAL", __FILE__, __LINE__, STR_FORMAT, _testContext->_actualStr, _testContext->_expectedStr); }
+
+//////////////////////////////////////////////////////////////////////////////////
+/// (ASSERT) Allocation Macro Functions
+/// 실패하면 현재 진행 중인 테스트가 종료된다.
+/// 테스트 함수를 실행하는 스레드의 malloc, calloc, realloc, reallocarray, memalign, aligned_alloc, posix_memalign, valloc 호출만 집계한다
+/// (테스트가 만든 스레드의 할당과 mmap 등으로 직접 얻은 메모리는 제외).
+//////////////////////////////////////////////////////////////////////////////////
+
+// 현재 테스트가 지금까지 메모리를 할당한 횟수가 지정한 횟수 이하인지 검사하는 함수
+#define ASSERT_MAX_ALLOCS(max) \
+	_testContext->_actuallonglong = GetTestAllocationCount(); \
+	_testContext->_expectedlonglong = max; \
+	if(_testContext->_actuallonglong > _testContext->_expectedlonglong) { PRINT_FAIL("ASSERT_MAX_ALLOCS", __FILE__, __LINE__, NUM2_FORMAT_longlong, _testContext->_actuallonglong, _testContext->_expectedlonglong); }
+
+// 지정한 코드(F)가 메모리를 할당하지 않는지 검사하는 함수
+#define ASSERT_NO_ALLOC(F) \
+	{ \
+	long long _allocationsBefore = GetTestAllocationCount(); \
+	F; \
+	_testContext->_actuallonglong = GetTestAllocationCount() - _allocationsBefore; \
+	if(_testContext->_actuallonglong != 0) { PRINT_FAIL("ASSERT_NO_ALLOC", __FILE__, __LINE__, NUM1_FORMAT_longlong, _testContext->_actuallonglong); } \
+	}
+
+//////////////////////////////////////////////////////////////////////////////////
+/// (ASSERT) Differential Macro Functions
+/// 실패하면 현재 진행 중인 테스트가 종료된다.
+/// 차분 테스트(DIFFERENTIAL)에서 구현의 결과(implementation)와 기준 구현의 결과(reference)를 비교한다.
+//////////////////////////////////////////////////////////////////////////////////
+
+// 구현과 기준 구현의 결과 값이 같은지 검사하는 함수
+#define ASSERT_SAME_NUM(implementation, reference, type) \
+	_testContext->_actual##type = implementation; \
+	_testContext->_expected##type = reference; \
+	if(_testContext->_actual##type != _testContext->_expected##type) { PRINT_FAIL("ASSERT_SAME_NUM", __FILE__, __LINE__, SAME_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
+
+// 구현과 기준 구현의 결과 값의 부호가 같은지 검사하는 함수(strcmp 처럼 부호만 정해진 비교 결과에 사용)
+#define ASSERT_SAME_SIGN(implementation, reference, type) \
+	_testContext->_actual##type = implementation; \
+	_testContext->_expected##type = reference; \
+	if((_testContext->_actual##type > 0) - (_testContext->_actual##type < 0) != (_testContext->_expected##type > 0) - (_testContext->_expected##type < 0)) { PRINT_FAIL("ASSERT_SAME_SIGN", __FILE__, __LINE__, SAME_FORMAT_##type, _testContext->_actual##type, _testContext->_expected##type); }
+
+// 구현과 기준 구현의 결과 문자열이 같은지 검사하는 함수(길이까지 같아야 하고, 둘 다 NULL 이어도 같다)
+#define ASSERT_SAME_STR(implementation, reference) \
+	_testContext->_actualStr = implementation; \
+	_testContext->_expectedStr = reference; \
+	if((_testContext->_actualStr == NULL || _testContext->_expectedStr == NULL) ? (_testContext->_actualStr != _testContext->_expectedStr) : (strcmp(_testContext->_actualStr, _testContext->_expectedStr) != 0)) { PRINT_FAIL("ASSERT_SAME_STR", __FILE__, __LINE__, SAME_STR_FORMAT, _testContext->_actualStr, _testContext->_expectedStr); }
 
 //////////////////////////////////////////////////////////////////////////////////
 /// Definitions
@@ -335,19 +738,421 @@ struct _test_suit_t;
 // 실행될 테스트 함수의 주소를 저장할 함수 포인터
 typedef TestResult (*TestFunc)(struct _test_suit_t* testSuit);
 
-// 테스트를 관리하는 TestSuit 객체에 저장된 테스트를 실행하기 위한 함수의 주소를 저장한 함수 포인터
-typedef void (*TestSuitInitializer)();
+// 벤치마크 측정 대상 코드를 지정한 횟수만큼 실행하는 함수 포인터
+typedef void (*TestBenchmarkFunc)(long long iterations);
+
+// 속성 기반 테스트의 입력 하나를 만들고 속성을 검사하는 함수 포인터
+typedef void (*TestPropertyFunc)(void);
+
+// 속성 기반 테스트에서 만든 바이트 배열
+typedef struct _test_bytes_t
+{
+	// 바이트 배열
+	unsigned char *data;
+	// 바이트 배열의 길이
+	size_t length;
+} TestBytes;
+
+// 속성 기반 테스트에서 만든 문자열 배열
+typedef struct _test_strings_t
+{
+	// 문자열 배열(마지막 원소 다음은 NULL)
+	char **strings;
+	// 문자열 개수
+	int count;
+} TestStrings;
+
+// 퍼징 대상 코드에 입력 하나를 전달하여 실행하는 함수 포인터
+typedef void (*TestFuzzFunc)(const unsigned char *data, size_t size);
+
+// 비동기 테스트의 시작 코드를 실행하는 함수 포인터
+typedef void (*TestAsyncStartFunc)(void);
+
+// 비동기 테스트에서 파일 디스크립터가 준비되거나 타이머의 시간이 지났을 때 호출되는 함수 포인터(events 는 TestAsyncEvent 비트 조합)
+typedef void (*TestAsyncFunc)(int fd, int events, void *data);
 
 // 사용자의 테스트 함수에 대한 정보를 관리하기 위한 구조체
 typedef struct _test_t
 {
 	// 테스트 케이스 이름
-	char *testCase;
+	const char *testCase;
 	// 테스트 이름
-	char *testName;
+	const char *testName;
 	// 실행될 테스트 함수
 	TestFunc testFunc;
-} Test, *TestPtr, **TestPtrContainer;
+	// 테스트 제한 시간(밀리초, 0 이면 실행 옵션의 기본 제한 시간)
+	int timeoutMilliseconds;
+	// 테스트 종류(TestKind)
+	int kind;
+	// 테스트를 정의한 소스 파일 이름(__FILE__, 감시 모드에서 바뀐 파일의 테스트를 고르는 데 사용)
+	const char *fileName;
+} Test;
+
+// 등록된 Test 레코드를 가리키는 포인터와 그 리스트(레코드는 읽기 전용 정적 데이터이므로 const)
+typedef const Test *TestPtr, *const *TestPtrContainer;
+
+// 실행될 픽스처 함수의 주소를 저장할 함수 포인터
+typedef void (*TestFixtureFunc)(void);
+
+// 테스트 케이스의 픽스처 함수에 대한 정보를 관리하기 위한 구조체
+typedef struct _test_fixture_t
+{
+	// 테스트 케이스 이름
+	const char *testCase;
+	// 실행될 픽스처 함수
+	TestFixtureFunc fixtureFunc;
+	// 픽스처 종류(TestFixtureKind)
+	int kind;
+	// 픽스처를 정의한 소스 파일 이름(__FILE__, SHARED_SETUP 실패를 기록하는 데 사용)
+	const char *fileName;
+	// 픽스처를 정의한 소스 줄 번호(__LINE__)
+	int lineNumber;
+} TestFixture;
+
+// 등록된 TestFixture 레코드를 가리키는 포인터와 그 리스트
+typedef const TestFixture *TestFixturePtr, *const *TestFixturePtrContainer;
+
+// 테스트가 읽는 데이터 파일에 대한 정보를 관리하기 위한 구조체(결과 캐시의 지문에 파일 내용을 포함한다)
+typedef struct _test_data_t
+{
+	// 테스트 케이스 이름
+	const char *testCase;
+	// 테스트 이름
+	const char *testName;
+	// 데이터 파일 경로
+	const char *path;
+} TestData;
+
+// 등록된 TestData 레코드를 가리키는 포인터와 그 리스트
+typedef const TestData *TestDataPtr, *const *TestDataPtrContainer;
+
+// 테스트 실행 방식을 지정하기 위한 구조체
+typedef struct _test_options_t
+{
+	// 동시에 실행할 테스트 작업자 프로세스 개수(1 이하면 순차 실행)
+	int numberOfJobs;
+	// 동시에 실행할 테스트 작업자 스레드 개수(1 이하면 순차 실행, numberOfJobs 가 우선)
+	int numberOfThreads;
+	// 실행 결과 요약에 출력할 가장 느린 테스트 개수(0 이면 출력하지 않음)
+	int numberOfSlowestTests;
+	// 사용할 리포터 이름(console, json, junit)
+	const char *reporterName;
+	// 리포터 출력 파일 경로(NULL 이면 표준 출력)
+	const char *outputPath;
+	// 실패한 테스트와 실행 결과 요약만 출력할지 여부(console 리포터)
+	int quiet;
+	// 실행할 테스트 이름(testCase.testName) glob 패턴(양성패턴[:양성패턴...][-음성패턴[:음성패턴...]], NULL 이면 전체)
+	const char *filter;
+	// 실행하지 않고 선택된 테스트 이름만 출력할지 여부
+	int listTests;
+	// 전체 샤드 개수(1 이하면 샤드로 나누지 않음)
+	int totalShards;
+	// 실행할 샤드 번호(0 부터 시작)
+	int shardIndex;
+	// 테스트별 실행 시간 기록 파일 경로(샤드 분배에 사용하고 실행 후 갱신한다, NULL 이면 사용하지 않음)
+	const char *timingsPath;
+	// 테스트 하나의 기본 제한 시간(밀리초, 0 이면 제한 없음)
+	int timeoutMilliseconds;
+	// 벤치마크만 골라 실행 시간을 측정할지 여부(벤치마크 모드, 항상 순차 실행)
+	int runBenchmarks;
+	// 벤치마크 하나의 측정 시간(밀리초, 보정 시간 제외)
+	int benchmarkMilliseconds;
+	// 벤치마크 하나의 반복 측정 횟수(통계 계산에 사용하는 표본 수)
+	int benchmarkRepetitions;
+	// 벤치마크 기준 결과 파일 경로(NULL 이면 비교하지 않음)
+	const char *baselinePath;
+	// 기준 결과를 구분하는 빌드 태그(공백 없는 문자열)
+	const char *baselineTag;
+	// 성능 저하로 판단할 중앙값 증가율(퍼센트, 통계적으로 유의미한 차이 중 이 값을 넘는 것만 실패로 기록)
+	int regressionThreshold;
+	// 이미 기록된 기준 결과도 이번 측정 결과로 갱신할지 여부
+	int updateBaseline;
+	// 테스트마다 하드웨어 성능 카운터(perf_event_open)를 측정할지 여부
+	int perfCounters;
+	// 테스트가 할당하고 해제하지 않은 메모리가 있으면 실패로 기록할지 여부
+	int leakCheck;
+	// 테스트별 힙 프로파일(할당 호출 경로)을 기록할 디렉터리(NULL 이면 기록하지 않음)
+	const char *heapProfilePath;
+	// 힙 프로파일 표본 사이의 평균 할당 크기(바이트, 1 이면 모든 할당을 기록)
+	long long heapSampleBytes;
+	// 속성 기반 테스트 하나가 검사할 입력 개수
+	int propertyCases;
+	// 속성 기반 테스트의 입력을 만드는 난수 seed(지정하지 않으면 실행할 때마다 다르다)
+	unsigned long long propertySeed;
+	// 속성 기반 테스트 하나의 입력들을 동시에 검사할 스레드 개수
+	int propertyThreads;
+	// 차분 테스트 하나가 비교할 입력 개수
+	int differentialCases;
+	// 차분 테스트 하나의 입력들을 동시에 비교할 스레드 개수
+	int differentialThreads;
+	// libFuzzer 로 실행할 퍼징 테스트 이름(testCase.testName, NULL 이면 퍼징 모드가 아님)
+	const char *fuzzTarget;
+	// 퍼징 테스트별 코퍼스 디렉터리(테스트케이스.테스트이름)를 둘 디렉터리(NULL 이면 코퍼스를 사용하지 않음)
+	const char *fuzzCorpusPath;
+	// libFuzzer 에 전달할 명령행 인자 개수('--' 뒤의 인자)
+	int numberOfFuzzArguments;
+	// libFuzzer 에 전달할 명령행 인자 리스트
+	char **fuzzArguments;
+	// 테스트 결과 캐시 파일 경로(지문이 같은 테스트의 이전 성공 결과를 재사용한다, NULL 이면 사용하지 않음)
+	const char *cachePath;
+	// 검사 매크로 함수의 실패를 포맷팅하지 않고 바이너리로 저장할 실패 기록 파일 경로(리포터에는 테스트마다 처음 실패만 전달한다, NULL 이면 사용하지 않음)
+	const char *failureLogPath;
+	// 테스트별 마지막 실행 결과와 실행 시간을 기록하는 상태 파일 경로(실행 순서 결정에 사용하고 실행 후 갱신한다, NULL 이면 사용하지 않음)
+	const char *statePath;
+	// 선택된 테스트들의 실행 순서(TestOrder)
+	int testOrder;
+	// 감시할 디렉터리 목록(':' 로 구분, 파일이 바뀌면 다시 빌드하고 영향받는 테스트를 다시 실행한다, NULL 이면 감시하지 않음)
+	const char *watchPaths;
+	// 감시 모드에서 파일이 바뀌었을 때 실행할 빌드 명령
+	const char *watchCommand;
+	// 감시 모드가 다시 실행하는 테스트 프로그램에 전달한 바뀐 소스 파일 이름 목록(':' 로 구분, 이 파일들에 정의된 테스트만 선택, NULL 이면 모두)
+	const char *watchSources;
+	// 명령행 인자 개수(감시 모드에서 테스트 프로그램을 다시 실행할 때 사용)
+	int numberOfArguments;
+	// 명령행 인자 리스트(감시 모드에서 테스트 프로그램을 다시 실행할 때 사용)
+	char **arguments;
+	// 포크 서버 모드에서 작업자 프로세스 하나가 실행할 테스트 개수(초기화를 마친 프로세스에서 그만큼마다 새 작업자 프로세스를 만든다, 0 이면 사용하지 않음)
+	int forkServerBatch;
+	// 하나의 이벤트 루프에서 동시에 진행할 ASYNC_TEST 최대 개수(1 이하면 다른 테스트처럼 하나씩 실행)
+	int asyncLimit;
+} TestOptions, *TestOptionsPtr;
+
+// 벤치마크 하나의 측정 결과를 저장하기 위한 구조체(실행 시간은 iteration 당 나노초)
+typedef struct _test_benchmark_result_t
+{
+	// 반복 측정 한 번의 iteration 수(보정 결과)
+	long long iterations;
+	// 반복 측정 횟수(측정하지 않았으면 0)
+	int repetitions;
+	// 최소 실행 시간
+	double minimumNanoseconds;
+	// 중앙값
+	double medianNanoseconds;
+	// 평균
+	double meanNanoseconds;
+	// 표준편차
+	double stddevNanoseconds;
+	// 99 백분위 값
+	double p99Nanoseconds;
+	// iteration 당 처리 바이트 수(SET_BENCHMARK_BYTES)
+	long long bytesPerIteration;
+	// iteration 당 처리 항목 수(SET_BENCHMARK_ITEMS)
+	long long itemsPerIteration;
+	// 초당 처리 바이트 수
+	double bytesPerSecond;
+	// 초당 처리 항목 수
+	double itemsPerSecond;
+	// 기준 결과와 비교한 결과(TestBaselineStatus)
+	int baselineStatus;
+	// 기준 결과의 중앙값
+	double baselineMedianNanoseconds;
+	// 기준 결과 대비 중앙값 변화율(퍼센트, 양수면 느려짐)
+	double changePercent;
+	// 느려지지 않았다는 가설에 대한 Mann-Whitney U 검정의 단측 p 값
+	double pValue;
+} TestBenchmarkResult, *TestBenchmarkResultPtr;
+
+// 테스트 하나의 하드웨어 성능 카운터 측정 결과를 저장하기 위한 구조체(사용자 공간 실행분만, 사용할 수 없는 카운터는 -1)
+typedef struct _test_perf_counter_result_t
+{
+	// 측정 여부(FALSE 면 나머지 값은 의미 없음)
+	int measured;
+	// CPU 사이클 수
+	long long cycles;
+	// 실행된 명령어 수
+	long long instructions;
+	// L1 데이터 캐시 읽기 미스 수
+	long long l1dMisses;
+	// 마지막 단계 캐시(LLC) 미스 수
+	long long llcMisses;
+	// 분기 예측 실패 수
+	long long branchMisses;
+} TestPerfCounterResult, *TestPerfCounterResultPtr;
+
+// 테스트 하나의 메모리 할당 집계 결과를 저장하기 위한 구조체(테스트 함수를 실행한 스레드의 malloc, calloc, realloc, free 만)
+typedef struct _test_allocation_result_t
+{
+	// 집계 여부(FALSE 면 나머지 값은 의미 없음)
+	int tracked;
+	// 할당 횟수(realloc 은 해제와 할당으로 집계)
+	long long allocations;
+	// 해제 횟수(테스트 안에서 할당한 블록만)
+	long long frees;
+	// 요청한 크기의 합
+	long long bytes;
+	// 동시에 할당되어 있던 크기의 최댓값
+	long long peakBytes;
+	// 테스트가 끝날 때까지 해제되지 않은 블록 개수
+	long long leakedBlocks;
+	// 테스트가 끝날 때까지 해제되지 않은 크기의 합
+	long long leakedBytes;
+} TestAllocationResult, *TestAllocationResultPtr;
+
+// 실행 중인 테스트 하나의 상태를 관리하기 위한 구조체(테스트마다 따로 생성되므로 스레드 간에 공유되지 않는다)
+typedef struct _test_context_t
+{
+	// 매크로 함수에서 매개변수가 함수일 경우, 한 번만 실행되도록 하기 위해 그 결과값을 저장하는 변수(상황에 맞게 사용)
+	void *_actualPtr;
+	void *_expectedPtr;
+	int _actualint;
+	int _expectedint;
+	long _actuallong;
+	long _expectedlong;
+	long long _actuallonglong;
+	long long _expectedlonglong;
+	char *_actualStr;
+	char *_expectedStr;
+	// 현재 테스트의 실패 횟수
+	int failCount;
+	// 현재 테스트 진행 상태(ASSERT 실패 시 TestExit)
+	int onGoing;
+	// 현재 테스트를 실행 중인 TestSuit 객체
+	struct _test_suit_t *testSuit;
+	// 현재 실행 중인 테스트 번호
+	int testIndex;
+	// 실패 정보를 즉시 리포터에 전달할지 여부(FALSE 면 failureLog 에 모았다가 테스트가 끝난 뒤 한 번에 전달)
+	int streamFailures;
+	// 현재 테스트의 실패 정보 기록 버퍼(병렬 실행 시 사용, 작업자마다 재사용)
+	char *failureLog;
+	// 실패 정보 기록 버퍼에 기록된 길이
+	size_t failureLogLength;
+	// 실패 정보 기록 버퍼의 크기
+	size_t failureLogCapacity;
+	// 실패 정보를 기록할 때마다 레코드를 바로 전달할 부모 프로세스와의 소켓(작업자 프로세스에서만 사용, 없으면 -1)
+	int failureFd;
+	// 제한 시간 감시를 현재 스레드에서 직접 수행할지 여부(작업자 프로세스는 부모 프로세스가 감시하므로 FALSE)
+	int useWatchdog;
+	// 제한 시간 감시 타이머와 중단 지점(처음 필요할 때 생성, 작업자마다 재사용)
+	struct _test_watchdog_t *watchdog;
+	// 현재 벤치마크의 측정 결과
+	TestBenchmarkResult benchmark;
+	// 하드웨어 성능 카운터(처음 필요할 때 생성, 작업자마다 재사용)
+	struct _test_perf_counters_t *perfCounters;
+	// 메모리 할당 기록(처음 필요할 때 생성, 작업자마다 재사용)
+	struct _test_allocation_tracker_t *allocationTracker;
+	// 실패 정보를 리포터에 전달하지 않을지 여부(속성 기반 테스트가 실패하는 입력을 찾고 줄이는 동안 TRUE)
+	int muteFailures;
+	// 실행 중인 속성 기반 테스트의 입력 생성 상태(GEN_ 함수에서 사용)
+	struct _test_property_source_t *propertySource;
+	// ASYNC_TEST 가 사용하는 이벤트 루프(처음 필요할 때 생성, 작업자마다 재사용, 동시에 진행할 때는 여러 테스트가 함께 사용)
+	struct _test_event_loop_t *eventLoop;
+	// 현재 ASYNC_TEST 가 등록하고 아직 해제하지 않은 파일 디스크립터와 타이머 개수
+	int asyncWatches;
+	// 현재 ASYNC_TEST 가 ASYNC_DONE 을 호출했는지 여부
+	int asyncDone;
+} TestContext, *TestContextPtr;
+
+// 테스트 하나의 실행 결과를 저장하기 위한 구조체
+typedef struct _test_report_t
+{
+	// 테스트 실행 결과(TestSuccess, TestFail, TestCrash, TestTimeout, TestNotRun)
+	TestResult result;
+	// 적용된 제한 시간(밀리초, 0 이면 제한 없음)
+	int timeoutMilliseconds;
+	// ASSERT 실패로 전체 테스트 종료가 요청되었는지 여부
+	int exitRequested;
+	// 비정상 종료 시 작업자 프로세스를 종료시킨 시그널 번호(없으면 0)
+	int signalNumber;
+	// 비정상 종료 시 작업자 프로세스의 종료 코드
+	int exitStatus;
+	// 테스트 실행 시간(단조 증가 시계 기준, 나노초)
+	long long elapsedNanoseconds;
+	// 테스트를 실행한 스레드의 CPU 사용 시간(나노초)
+	long long cpuNanoseconds;
+	// 테스트 실행 동안 증가한 CPU 타임스탬프 카운터 값(TSC 를 지원하지 않으면 0)
+	unsigned long long cycles;
+	// 벤치마크 측정 결과(벤치마크 모드의 BENCHMARK 만 사용)
+	TestBenchmarkResult benchmark;
+	// 하드웨어 성능 카운터 측정 결과(벤치마크 모드의 BENCHMARK 는 보정 이후 반복 측정 구간만)
+	TestPerfCounterResult perfCounters;
+	// 메모리 할당 집계 결과(테스트 함수 실행 구간만)
+	TestAllocationResult allocations;
+	// 테스트를 실행하지 않고 결과 캐시의 이전 성공 결과를 재사용했는지 여부
+	int cached;
+} TestReport, *TestReportPtr;
+
+// 테스트 케이스(testCase)별 실행 시간 집계 결과를 저장하기 위한 구조체
+typedef struct _test_case_time_t
+{
+	// 테스트 케이스 이름
+	const char *testCase;
+	// 실행된 테스트 개수
+	int numberOfTests;
+	// 실행 시간 합계(나노초)
+	long long elapsedNanoseconds;
+	// CPU 사용 시간 합계(나노초)
+	long long cpuNanoseconds;
+} TestCaseTime, *TestCaseTimePtr;
+
+// 출력 버퍼를 비우는 백그라운드 기록 스레드 정보(ttlib_sink.c 에서만 사용)
+struct _test_sink_writer_t;
+
+// 리포터 출력을 모아서 한 번에 기록하는 출력 대상 구조체
+typedef struct _test_sink_t
+{
+	// 출력 파일 디스크립터
+	int fd;
+	// fd 를 직접 열었는지 여부(삭제 시 닫는다)
+	int ownsFd;
+	// 리포터 이벤트마다 버퍼를 비울지 여부(기록 스레드 없이 터미널에 출력하는 경우 TRUE)
+	int autoFlush;
+	// 출력 버퍼(기록 스레드가 있으면 링 버퍼로 사용)
+	char *buffer;
+	// 출력 버퍼 크기
+	size_t capacity;
+	// 출력 버퍼에 모인 길이(기록 스레드가 없는 경우에만 사용)
+	size_t length;
+	// 출력 버퍼를 비우는 백그라운드 기록 스레드(NULL 이면 버퍼가 가득 차거나 FlushTestSink 호출 시 직접 기록)
+	struct _test_sink_writer_t *writer;
+} TestSink, *TestSinkPtr, **TestSinkPtrContainer;
+
+// 검사 매크로 함수 하나의 실패 정보를 저장하기 위한 구조체
+typedef struct _test_failure_t
+{
+	// 실패한 매크로 함수 이름(EXPECT_NUM_EQUAL 등)
+	const char *macroName;
+	// 실패한 소스 파일 이름
+	const char *fileName;
+	// 실패한 소스 줄 번호
+	int lineNumber;
+	// 포맷팅된 실패 메시지(actual, expected 값)
+	const char *message;
+} TestFailure, *TestFailurePtr;
+
+// 검사 매크로 함수 호출 위치의 정적 기술자(PRINT_FAIL 이 호출 위치마다 만들며, 실패 기록은 인자 값과 함께 이 기술자를 가리킨다)
+typedef struct _test_failure_site_t
+{
+	// 매크로 함수 이름(EXPECT_NUM_EQUAL 등)
+	const char *macroName;
+	// 소스 파일 이름
+	const char *fileName;
+	// 소스 줄 번호
+	int lineNumber;
+	// 실패 메시지 포맷 문자열(인자 값은 리포터에 전달할 때 포맷팅된다)
+	const char *format;
+} TestFailureSite, *TestFailureSitePtr;
+
+// 테스트 실행 과정을 출력하는 리포터 구조체(콜백 함수 테이블)
+// 콜백 함수는 항상 한 번에 하나씩 호출되며, 한 테스트의 begin, failure, end 는 다른 테스트의 이벤트와 섞이지 않는다.
+typedef struct _test_reporter_t
+{
+	// 리포터 이름
+	const char *name;
+	// 전체 테스트 실행 시작 시 호출
+	void (*onStart)(struct _test_reporter_t *reporter, struct _test_suit_t *testSuit);
+	// 테스트 하나의 실행 시작 시 호출
+	void (*onTestBegin)(struct _test_reporter_t *reporter, struct _test_suit_t *testSuit, int testIndex);
+	// 검사 매크로 함수 실패 시 호출
+	void (*onFailure)(struct _test_reporter_t *reporter, struct _test_suit_t *testSuit, int testIndex, const TestFailure *failure);
+	// 테스트 하나의 실행 완료 시 호출
+	void (*onTestEnd)(struct _test_reporter_t *reporter, struct _test_suit_t *testSuit, int testIndex, const TestReport *report);
+	// 전체 테스트 실행 완료 시 호출
+	void (*onFinish)(struct _test_reporter_t *reporter, struct _test_suit_t *testSuit, int numberOfCurTests);
+	// 출력 대상
+	TestSinkPtr sink;
+	// 리포터별 상태
+	void *state;
+} TestReporter, *TestReporterPtr, **TestReporterPtrContainer;
 
 // 모든 사용자 테스트를 관리하기 위한 구조체
 typedef struct _test_suit_t
@@ -358,12 +1163,103 @@ typedef struct _test_suit_t
 	int numberOfFailTests;
 	// 현재 진행 중인 테스트 실행 여부
 	int onGoing;
-	// 사용자가 작성한 테스트 등록 및 초기화를 담당하는 객체
-	TestSuitInitializer *initializers;
-	// 사용자가 작성한 테스트 리스트
+	// 사용자가 작성한 테스트 리스트(링커 섹션을 그대로 가리킨다)
 	TestPtrContainer testPtrContainer;
+	// 테스트 실행 옵션
+	TestOptions options;
+	// 테스트별 실행 결과 리스트(testPtrContainer 와 같은 순서)
+	TestReportPtr testReports;
+	// 마지막 RunAllTests 호출의 전체 실행 시간(나노초)
+	long long elapsedNanoseconds;
+	// 테스트 실행 과정을 출력하는 리포터(NULL 이면 실행 옵션에 따라 생성)
+	TestReporterPtr reporter;
+	// reporter 를 TestSuit 객체가 생성했는지 여부(삭제 시 함께 삭제한다)
+	int ownsReporter;
+	// 테스트 이름 해시 인덱스(이름으로 테스트를 찾을 때 한 번 생성된다)
+	struct _test_name_index_t *nameIndex;
+	// 실행할 테스트 번호 리스트(실행 순서, RunAllTests 호출 시 실행 옵션에 따라 선택된다)
+	int *selectedTests;
+	// 실행할 테스트 개수
+	int numberOfSelectedTests;
+	// 벤치마크 기준 결과(벤치마크 모드에서 기준 결과 파일을 지정하면 RunAllTests 호출 시 읽는다)
+	struct _test_baseline_t *baseline;
+	// 기준 결과보다 유의미하게 느려진 벤치마크 개수
+	int numberOfRegressions;
+	// 하드웨어 성능 카운터를 열지 못한 원인(errno, 0 이면 사용 가능하거나 요청하지 않음)
+	int perfCounterError;
+	// 사용자가 작성한 픽스처 리스트(링커 섹션을 그대로 가리킨다)
+	TestFixturePtrContainer fixturePtrContainer;
+	// 전체 픽스처 개수
+	int numberOfFixtures;
+	// 테스트 케이스별 픽스처 상태(픽스처가 있으면 RunAllTests 호출 시 선택된 테스트에 맞춰 생성된다)
+	struct _test_fixture_index_t *fixtureIndex;
+	// 사용자가 선언한 테스트 데이터 파일 리스트(링커 섹션을 그대로 가리킨다)
+	TestDataPtrContainer dataPtrContainer;
+	// 전체 테스트 데이터 파일 개수
+	int numberOfData;
+	// 테스트별 지문과 결과 재사용 여부(결과 캐시 파일을 지정하면 RunAllTests 호출 시 생성된다)
+	struct _test_cache_t *cache;
+	// 바이너리 실패 기록 파일의 출력 상태(실패 기록 파일을 지정하면 RunAllTests 호출 시 생성된다)
+	struct _test_failure_log_t *failureLogFile;
+	// LoadTestPlugin 으로 읽은 테스트 스위트 공유 라이브러리 핸들 리스트(삭제 시 dlclose 한다)
+	void **pluginHandles;
+	// 읽은 테스트 스위트 공유 라이브러리 개수
+	int numberOfPlugins;
+	// 여러 테스트 스위트의 테스트 레코드를 합친 리스트(LoadTestPlugin 이 할당하며 testPtrContainer 가 가리킨다)
+	TestPtr *pluginTests;
+	// 여러 테스트 스위트의 픽스처 레코드를 합친 리스트(LoadTestPlugin 이 할당하며 fixturePtrContainer 가 가리킨다)
+	TestFixturePtr *pluginFixtures;
+	// 여러 테스트 스위트의 테스트 데이터 파일 레코드를 합친 리스트(LoadTestPlugin 이 할당하며 dataPtrContainer 가 가리킨다)
+	TestDataPtr *pluginData;
 } TestSuit, *TestSuitPtr, **TestSuitPtrContainer;
 
+// 테스트 스위트 공유 라이브러리(플러그인)가 링커 섹션에 등록한 레코드 범위(ttrun 이 여러 스위트를 한 TestSuit 객체로 합칠 때 사용)
+typedef struct _test_plugin_records_t
+{
+	// 테스트 레코드 리스트의 시작과 끝
+	TestPtrContainer testsBegin;
+	TestPtrContainer testsEnd;
+	// 픽스처 레코드 리스트의 시작과 끝
+	TestFixturePtrContainer fixturesBegin;
+	TestFixturePtrContainer fixturesEnd;
+	// 테스트 데이터 파일 레코드 리스트의 시작과 끝
+	TestDataPtrContainer dataBegin;
+	TestDataPtrContainer dataEnd;
+} TestPluginRecords, *TestPluginRecordsPtr;
+
+// 테스트 스위트 공유 라이브러리에서 레코드 범위를 얻는 함수 이름(dlsym 으로 찾는다)
+#define TEST_PLUGIN_ENTRY_NAME "GetTestPluginRecords"
+
+// 현재 스레드에서 실행 중인 테스트의 TestContext 객체(매크로 함수에서 사용)
+extern __thread TestContextPtr _testContext;
+
+// 링커가 테스트 레코드 섹션(ttlib_tests)의 시작과 끝에 정의하는 심볼(테스트가 없으면 NULL)
+extern const TestPtr __start_ttlib_tests[] __attribute__((weak, visibility("hidden")));
+extern const TestPtr __stop_ttlib_tests[] __attribute__((weak, visibility("hidden")));
+
+// 링커가 픽스처 레코드 섹션(ttlib_fixtures)의 시작과 끝에 정의하는 심볼(픽스처가 없으면 NULL)
+extern const TestFixturePtr __start_ttlib_fixtures[] __attribute__((weak, visibility("hidden")));
+extern const TestFixturePtr __stop_ttlib_fixtures[] __attribute__((weak, visibility("hidden")));
+
+// 링커가 테스트 데이터 파일 레코드 섹션(ttlib_data)의 시작과 끝에 정의하는 심볼(선언이 없으면 NULL)
+extern const TestDataPtr __start_ttlib_data[] __attribute__((weak, visibility("hidden")));
+extern const TestDataPtr __stop_ttlib_data[] __attribute__((weak, visibility("hidden")));
+
+#ifdef TTLIB_PLUGIN
+// 테스트 스위트 공유 라이브러리의 레코드 범위를 반환하는 함수(-DTTLIB_PLUGIN 으로 빌드하면 정의된다)
+// 섹션 시작과 끝 심볼은 hidden 이므로 공유 라이브러리마다 자기 섹션을 가리키고, 여러 소스 파일에서 정의되어도 weak 이므로 하나로 합쳐진다.
+void GetTestPluginRecords(TestPluginRecordsPtr records);
+__attribute__((weak, visibility("default"))) void GetTestPluginRecords(TestPluginRecordsPtr records)
+{
+	records->testsBegin = __start_ttlib_tests;
+	records->testsEnd = __stop_ttlib_tests;
+	records->fixturesBegin = __start_ttlib_fixtures;
+	records->fixturesEnd = __stop_ttlib_fixtures;
+	records->dataBegin = __start_ttlib_data;
+	records->dataEnd = __stop_ttlib_data;
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////////////
 /// Local Functions
 //////////////////////////////////////////////////////////////////////////////////
@@ -371,8 +1267,54 @@ typedef struct _test_suit_t
 TestSuitPtr NewTestSuit();
 void DeleteTestSuit(TestSuitPtrContainer testSuitContainer);
 
-TestPtr AddTest(TestSuitPtr testSuit, Test test);
-void RunAllTests(TestSuitPtr testSuit);
+TestInitializationResult RegisterTests(TestSuitPtr testSuit, TestPtrContainer begin, TestPtrContainer end);
+TestInitializationResult RegisterTestFixtures(TestSuitPtr testSuit, TestFixturePtrContainer begin, TestFixturePtrContainer end);
+TestInitializationResult RegisterTestData(TestSuitPtr testSuit, TestDataPtrContainer begin, TestDataPtrContainer end);
+TestInitializationResult LoadTestPlugin(TestSuitPtr testSuit, const char *path);
+TestInitializationResult ParseTestOptions(TestSuitPtr testSuit, int argc, char **argv);
+int RunAllTests(TestSuitPtr testSuit);
+int FindTest(TestSuitPtr testSuit, const char *testCase, const char *testName);
+
+TestReportPtr GetTestReport(TestSuitPtr testSuit, int testIndex);
+int GetSlowestTests(TestSuitPtr testSuit, int *testIndexes, int count);
+long long GetTestSuitElapsedTime(TestSuitPtr testSuit);
+long long GetTestSuitCpuTime(TestSuitPtr testSuit);
+int GetTestCaseTimes(TestSuitPtr testSuit, TestCaseTimePtr testCaseTimes, int count);
+
+TestReporterPtr NewTestReporter(const char *name, const char *outputPath);
+void DeleteTestReporter(TestReporterPtrContainer reporterContainer);
+void SetTestReporter(TestSuitPtr testSuit, TestReporterPtr reporter);
+void ReportTestFailure(const char *macroName, const char *fileName, int lineNumber, const char *format, ...) __attribute__((format(printf, 4, 5)));
+void RecordTestFailure(const TestFailureSite *site, const char *format, ...) __attribute__((format(printf, 2, 3)));
+long long DecodeTestFailureLog(const char *path, FILE *output);
+
+TestSinkPtr NewTestSink(const char *path);
+void DeleteTestSink(TestSinkPtrContainer sinkContainer);
+int WriteTestSink(TestSinkPtr sink, const char *data, size_t length);
+int PrintTestSink(TestSinkPtr sink, const char *format, ...) __attribute__((format(printf, 2, 3)));
+int FlushTestSink(TestSinkPtr sink);
+
+void RunBenchmark(TestBenchmarkFunc body);
+void SetBenchmarkCounters(long long bytesPerIteration, long long itemsPerIteration);
+
+long long GetTestAllocationCount(void);
+
+void RunProperty(TestPropertyFunc property, const char *fileName, int lineNumber);
+void RunDifferential(TestPropertyFunc property, const char *fileName, int lineNumber);
+void DiscardTestProperty(void);
+long long GenerateTestInt(long long min, long long max);
+char *GenerateTestString(int minLength, int maxLength, const char *alphabet);
+TestBytes GenerateTestBytes(int minLength, int maxLength);
+TestStrings GenerateTestStrings(int minCount, int maxCount, int maxLength, const char *alphabet);
+char GenerateTestDelimiter(const char *delimiters);
+
+void RunFuzzTest(TestFuzzFunc fuzz);
+
+void RunAsyncTest(TestAsyncStartFunc start);
+int WatchAsyncTestFd(int fd, int events, TestAsyncFunc callback, void *data);
+int StartAsyncTestTimer(int milliseconds, TestAsyncFunc callback, void *data);
+void UnwatchAsyncTestFd(int fd);
+void FinishAsyncTest(void);
 
 void IncFailCountTestSuit(TestSuitPtr testSuit);
 void SetExitTestSuit(TestSuitPtr testSuit);
@@ -92,25 +92,15 @@ TEST(CompareStrings, NotEqual, {
 //<-- Test Codes ends here
 ///////////////////////////////////////////////////////////////////////////////
 
-int main()
+int main(int argc, char **argv)
 {
     CREATE_TESTSUIT();
 
-    REGISTER_TESTS(
-        Test_IsDigit_AcceptableValues,
-        Test_IsDigit_InvalidValues,
-        Test_CompareNumbers_Equal,
-        Test_CompareNumbers_NotEqual,
-        Test_CompareNumbers_Less,
-        Test_CompareNumbers_Greater,
-        Test_CheckNumberType_Even,
-        Test_CheckNumberType_Odd,
-        Test_CompareStrings_Equal,
-        Test_CompareStrings_NotEqual);
+    PARSE_TEST_OPTIONS(argc, argv);
 
-    RUN_ALL_TESTS();
+    int result = RUN_ALL_TESTS();
 
     CLEAN_UP_TESTSUIT();
 
-    return True;
+    return result;
 }
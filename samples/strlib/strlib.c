@@ -480,19 +480,19 @@ Bool SearchString(const StringPtr str, const char *pattern)
 	int strIndex = 0;
 	int patternIndex = 0;
 
-	for( ; strIndex < strLength; strIndex++)
+	// 패턴이 들어갈 수 있는 위치까지만 검색
+	for( ; strIndex <= strLength - patternLength; strIndex++)
 	{
 		// 첫 문자를 먼저 검색
-		if(str->data[strIndex] == pattern[patternIndex])
+		if(str->data[strIndex] == pattern[0])
 		{
 			// 첫 문자가 일치하므로 1 부터 시작
 			int equalCount = 1;
-			// 검색할 문자열과 패턴 문자열이 일치하는 첫 문자의 위치부터 검색 시작
-			int tempIndex = (++strIndex);
-			patternIndex++;
+			// 첫 문자 다음 위치부터 비교(일부만 일치하면 strIndex 의 다음 위치부터 다시 검색)
+			int tempIndex = strIndex + 1;
 
 			// 첫 문자가 일치하면 그 다음 문자들이 일치하는지 검사
-			for( ; patternIndex < patternLength; patternIndex++)
+			for(patternIndex = 1; patternIndex < patternLength; patternIndex++)
 			{
 				if(str->data[tempIndex] != pattern[patternIndex]) break;
 				else equalCount++;
@@ -506,8 +506,6 @@ Bool SearchString(const StringPtr str, const char *pattern)
 				break;
 			}
 		}
-		// 못찾았으면 다시 검색
-		patternIndex = 0;
 	}
 
 	return result;
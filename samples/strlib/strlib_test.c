@@ -1,6 +1,9 @@
 #include "ttlib.h"
 #include "strlib.h"
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Definitions of Test
 ////////////////////////////////////////////////////////////////////////////////
@@ -823,6 +826,63 @@ TEST(MergeString, MergeString, {
 	EXPECT_NULL(MergeString(NULL, 'x'));
 })
 
+PROPERTY(MergeString, MergeSplitString, char *s = GEN_STRING(1, 32, "ab|"), {
+	PROPERTY_ASSUME(strchr(s, '|') != NULL);
+	char **sList = SplitString(s, '|', IncludeEmptyString);
+	char *actual = MergeString(sList, '|');
+
+	// 나눈 문자열을 같은 구분 문자로 연결하면 원래 문자열
+	EXPECT_STR_EQUAL(actual, s);
+	DeleteCharPtrContainer(sList);
+	free(actual);
+})
+
+DIFFERENTIAL(SearchString, MatchesStrstr, char *s = GEN_STRING(1, 16, "ab"); char *pattern = GEN_STRING(1, 4, "ab"), {
+	StringPtr str = NewString(s);
+
+	// 패턴이 있는지 여부는 strstr 과 같아야 함
+	EXPECT_SAME_NUM(SearchString(str, pattern) == True, strstr(s, pattern) != NULL, int);
+	DeleteString(&str);
+})
+
+DIFFERENTIAL(CompareString, MatchesStrcmp, char *s1 = GEN_STRING(1, 8, "abc"); char *s2 = GEN_STRING(1, 8, "abc"), {
+	StringPtr str1 = NewString(s1);
+	StringPtr str2 = NewString(s2);
+
+	// 비교 결과의 부호는 strcmp 와 같아야 함
+	EXPECT_SAME_SIGN(CompareString(str1, str2), strcmp(s1, s2), int);
+	DeleteString(&str1);
+	DeleteString(&str2);
+})
+
+DIFFERENTIAL(ChangeStringCase, MatchesToupper, char *s = GEN_STRING(1, 32, NULL), {
+	StringPtr str = NewString(s);
+	char *expected = strdup(s);
+	int index = 0;
+	for( ; expected[index] != '\0'; index++){
+		expected[index] = (char)toupper((unsigned char)expected[index]);
+	}
+
+	// 대문자로 바꾼 결과는 문자마다 toupper 를 적용한 결과와 같아야 함
+	EXPECT_SAME_STR(ConvertToUpperString(str), expected);
+	free(expected);
+	DeleteString(&str);
+})
+
+FUZZ_TEST(SplitString, SplitMergeFuzz, data, size, {
+	char *s = strndup((const char*)data, size);
+	char **sList = SplitString(s, '|', IncludeEmptyString);
+
+	// 구분 문자가 있는 문자열만 나눠지고, 나눈 문자열을 연결하면 원래 문자열
+	if(sList != NULL){
+		char *actual = MergeString(sList, '|');
+		EXPECT_STR_EQUAL(actual, s);
+		free(actual);
+		DeleteCharPtrContainer(sList);
+	}
+	free(s);
+})
+
 TEST(TestStringAPI, StringTest, {
 	StringPtr str1 = NewString("abc");
 	StringPtr str2 = CloneString(str1);
@@ -856,48 +916,75 @@ TEST(TestStringAPI, StringTest, {
 	free(actualCharPtr);
 })
 
+// 비동기 테스트에서 소켓 쌍으로 주고받는 문자열과 받은 결과
+#define ECHO_MESSAGE "hello, async world"
+
+typedef struct _echo_t
+{
+	int fds[2];
+	StringPtr received;
+} Echo, *EchoPtr;
+
+// 받을 수 있는 만큼 읽어 이어 붙이고, 다 받으면 보낸 문자열과 비교한 뒤 끝낸다
+static void OnEchoReadable(int fd, int events, void *data)
+{
+	EchoPtr echo = (EchoPtr)data;
+	char buffer[8];
+
+	EXPECT_NUM_EQUAL(events & TestAsyncRead, TestAsyncRead, int);
+	ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+	if(length > 0){
+		buffer[length] = '\0';
+		ConcatString(echo->received, buffer);
+	}
+	if(length > 0 && GetLength(echo->received) < (int)strlen(ECHO_MESSAGE)){
+		return;
+	}
+
+	EXPECT_STR_EQUAL(GetPtr(echo->received), ECHO_MESSAGE);
+	ASYNC_UNWATCH(fd);
+	close(echo->fds[0]);
+	close(echo->fds[1]);
+	DeleteString(&echo->received);
+	free(echo);
+	ASYNC_DONE();
+}
+
+// 타이머의 시간이 지나면 문자열을 보낸다
+static void OnEchoTimer(int fd, int events, void *data)
+{
+	EchoPtr echo = (EchoPtr)data;
+
+	EXPECT_NUM_EQUAL(fd, -1, int);
+	EXPECT_NUM_EQUAL(events, TestAsyncTimer, int);
+	EXPECT_NUM_EQUAL((int)write(echo->fds[0], ECHO_MESSAGE, strlen(ECHO_MESSAGE)), (int)strlen(ECHO_MESSAGE), int);
+}
+
+ASYNC_TEST(TestStringAPI, AsyncEchoTest, {
+	EchoPtr echo = (EchoPtr)calloc(1, sizeof(Echo));
+	ASSERT_NOT_NULL(echo);
+	echo->received = NewString("");
+
+	// 시작 코드는 소켓과 타이머를 등록하고 돌아가며, 검사는 콜백 함수에서 한다
+	ASSERT_NUM_EQUAL(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, echo->fds), 0, int);
+	EXPECT_NUM_EQUAL(ASYNC_WATCH(echo->fds[1], TestAsyncRead, OnEchoReadable, echo), 0, int);
+	EXPECT_NUM_NOT_EQUAL(ASYNC_TIMER(10, OnEchoTimer, echo), -1, int);
+})
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Main Function
 ////////////////////////////////////////////////////////////////////////////////
 
-int main()
+int main(int argc, char **argv)
 {
     CREATE_TESTSUIT();
 
-    REGISTER_TESTS(
-		Test_NewString_InstanceCreation,
-		Test_DeleteString_InstanceDeletion,
-		Test_GetLength_LengthOfString,
-		Test_GetPtr_PointerToStringData,
-		Test_CloneString_InstanceClone,
-		Test_SetString_SetNewValue,
-		Test_ChangeStringCase_UpperString,
-		Test_ChangeStringCase_LowerString,
-		Test_TrimString_TrimLeft,
-		Test_TrimString_TrimRight,
-		Test_TrimString_Trim,
-		Test_CopyString_CopyString,
-		Test_CopyString_CopyNString,
-		Test_FormatString_FormatString,
-		Test_ConcatString_ConcatString,
-		Test_TruncateString_TruncateString,
-		Test_SubString_SubString,
-		Test_CompareString_CompareString,
-		Test_SearchString_SearchString,
-		Test_CheckCharIsDigit_IsDigit,
-		Test_CheckCharIsAlpha_IsAlpha,
-		Test_CheckCharIsLetter_IsLetter,
-		Test_CheckCharIsSpace_IsSpace,
-		Test_CheckCharIsCRLF_IsCRLF,
-		Test_SplitString_SplitString,
-		Test_MergeString_MergeString,
-		Test_TestStringAPI_StringTest
-    );
-
-    RUN_ALL_TESTS();
+    PARSE_TEST_OPTIONS(argc, argv);
+
+    int result = RUN_ALL_TESTS();
 
     CLEAN_UP_TESTSUIT();
 
-	return 1;
+    return result;
 }
 
@@ -1,13 +1,161 @@
-#include "../include/ttlib.h"
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 실행 옵션 값을 저장할 TestOptions 멤버의 주소
+#define TEST_OPTION_FIELD(options, offset, type) ((type*)((char*)(options) + (offset)))
+
+// 실행 옵션 값의 형식
+typedef enum _test_option_value_type_t
+{
+	// 값이 없는 명령행 옵션(-q, --list 등)
+	TestOptionValueNone = 1,
+	// 값이 필요한 옵션(-j N, --jobs=N 등)
+	TestOptionValueRequired,
+	// 값을 생략할 수 있는 명령행 옵션(--watch[=DIRS] 등)
+	TestOptionValueOptional
+} TestOptionValueType;
+
+// 실행 옵션 하나의 명령행 이름, 환경 변수 이름, 값을 해석하는 함수, 값을 저장할 위치
+typedef struct _test_option_t
+{
+	// 짧은 옵션 문자(없으면 0)
+	char shortName;
+	// 긴 옵션 이름('--' 제외, 환경 변수로만 지정하면 NULL)
+	const char *longName;
+	// 환경 변수 이름(명령행으로만 지정하면 NULL)
+	const char *envName;
+	// 명령행 옵션 값의 형식(환경 변수에는 항상 값이 있다)
+	TestOptionValueType valueType;
+	// 값을 해석하여 저장하는 함수(값 없이 지정한 명령행 옵션이면 value 는 NULL, 성공 시 0, 잘못된 값이면 -1 반환)
+	int (*parse)(const char *value, TestOptionsPtr options, size_t offset);
+	// 값을 저장할 TestOptions 멤버의 위치
+	size_t offset;
+} TestOption;
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefitions of Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-static TestInitializationResult InitializeTests(const TestSuitPtr testSuit);
-static TestPtrContainer NewTestPtrContainer(size_t numberOfTests);
-static void DeleteTest(TestPtr test);
-static void DeleteTestPtrContainer(TestPtrContainer testPtrContainer, int numberOfTests);
+static void InitializeTestOptions(TestOptionsPtr options);
+static const TestOption *FindTestOption(const char *arg);
+static int ParseWorkersOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseCountOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParsePositiveOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseSwitchOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseDisableOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParsePathOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseTextOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseTagOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseReporterOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseOrderOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseWatchOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseForkServerOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseShardOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseSeedOption(const char *value, TestOptionsPtr options, size_t offset);
+static int ParseNumberOfWorkers(const char *value);
+static int ParseNonNegative(const char *value);
+static int FindTestRunEnd(TestSuitPtr testSuit, int start, int batchAsyncTests);
+static int RunSelectedTests(TestSuitPtr testSuit, int start, int count);
+static int RunTestsInSerial(TestSuitPtr testSuit, int start, int count);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// 현재 스레드에서 실행 중인 테스트의 TestContext 객체
+__thread TestContextPtr _testContext = NULL;
+
+// 지원하는 실행 옵션 표(환경 변수는 표 순서대로 적용한 뒤 명령행 옵션을 적용한다)
+static const TestOption _testOptions[] = {
+	// -j N, -jN, --jobs=N : 동시에 실행할 작업자 프로세스 개수(0 이면 CPU 개수)
+	{ 'j', "jobs", "TTLIB_JOBS", TestOptionValueRequired, ParseWorkersOption, offsetof(TestOptions, numberOfJobs) },
+	// -t N, -tN, --threads=N : 동시에 실행할 작업자 스레드 개수(0 이면 CPU 개수)
+	{ 't', "threads", "TTLIB_THREADS", TestOptionValueRequired, ParseWorkersOption, offsetof(TestOptions, numberOfThreads) },
+	// --slowest=N : 실행 결과 요약에 출력할 가장 느린 테스트 개수
+	{ 0, "slowest", "TTLIB_SLOWEST", TestOptionValueRequired, ParseCountOption, offsetof(TestOptions, numberOfSlowestTests) },
+	// --reporter=NAME : 리포터 이름(console, json, junit)
+	{ 0, "reporter", "TTLIB_REPORTER", TestOptionValueRequired, ParseReporterOption, offsetof(TestOptions, reporterName) },
+	// --output=PATH : 리포터 출력 파일 경로
+	{ 0, "output", "TTLIB_OUTPUT", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, outputPath) },
+	// -q, --quiet : 실패한 테스트와 실행 결과 요약만 출력
+	{ 'q', "quiet", "TTLIB_QUIET", TestOptionValueNone, ParseSwitchOption, offsetof(TestOptions, quiet) },
+	// --filter=PATTERNS : 실행할 테스트 이름 glob 패턴(양성패턴[:양성패턴...][-음성패턴[:음성패턴...]])
+	{ 0, "filter", "TTLIB_FILTER", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, filter) },
+	// --list : 실행하지 않고 선택된 테스트 이름만 출력
+	{ 0, "list", NULL, TestOptionValueNone, ParseSwitchOption, offsetof(TestOptions, listTests) },
+	// --shard=INDEX/TOTAL : 선택된 테스트를 TOTAL 개로 나눈 것 중 INDEX 번째(0 부터 시작) 샤드만 실행
+	{ 0, "shard", NULL, TestOptionValueRequired, ParseShardOption, 0 },
+	{ 0, NULL, "TTLIB_TOTAL_SHARDS", TestOptionValueRequired, ParsePositiveOption, offsetof(TestOptions, totalShards) },
+	{ 0, NULL, "TTLIB_SHARD_INDEX", TestOptionValueRequired, ParseCountOption, offsetof(TestOptions, shardIndex) },
+	// --timings=PATH : 샤드 분배에 사용할 테스트별 실행 시간 기록 파일(실행 후 갱신된다)
+	{ 0, "timings", "TTLIB_TIMINGS", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, timingsPath) },
+	// --timeout=MS : 테스트 하나의 기본 제한 시간(밀리초, 0 이면 제한 없음, TEST_TIMEOUT 으로 지정한 값이 우선)
+	{ 0, "timeout", "TTLIB_TIMEOUT", TestOptionValueRequired, ParseCountOption, offsetof(TestOptions, timeoutMilliseconds) },
+	// --benchmark : BENCHMARK 로 정의한 벤치마크만 순차 실행하며 실행 시간을 측정
+	{ 0, "benchmark", "TTLIB_BENCHMARK", TestOptionValueNone, ParseSwitchOption, offsetof(TestOptions, runBenchmarks) },
+	// --benchmark-time=MS : 벤치마크 하나의 측정 시간(밀리초)
+	{ 0, "benchmark-time", "TTLIB_BENCHMARK_TIME", TestOptionValueRequired, ParsePositiveOption, offsetof(TestOptions, benchmarkMilliseconds) },
+	// --benchmark-repetitions=N : 벤치마크 하나의 반복 측정 횟수
+	{ 0, "benchmark-repetitions", "TTLIB_BENCHMARK_REPETITIONS", TestOptionValueRequired, ParsePositiveOption, offsetof(TestOptions, benchmarkRepetitions) },
+	// --benchmark-baseline=PATH : 벤치마크 기준 결과 파일(기준 결과가 없는 벤치마크는 이번 측정 결과를 기록한다)
+	{ 0, "benchmark-baseline", "TTLIB_BENCHMARK_BASELINE", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, baselinePath) },
+	// --benchmark-tag=TAG : 기준 결과를 구분하는 빌드 태그
+	{ 0, "benchmark-tag", "TTLIB_BENCHMARK_TAG", TestOptionValueRequired, ParseTagOption, offsetof(TestOptions, baselineTag) },
+	// --benchmark-threshold=PERCENT : 성능 저하로 판단할 중앙값 증가율
+	{ 0, "benchmark-threshold", "TTLIB_BENCHMARK_THRESHOLD", TestOptionValueRequired, ParseCountOption, offsetof(TestOptions, regressionThreshold) },
+	// --update-baseline : 이미 기록된 기준 결과도 이번 측정 결과로 갱신
+	{ 0, "update-baseline", "TTLIB_UPDATE_BASELINE", TestOptionValueNone, ParseSwitchOption, offsetof(TestOptions, updateBaseline) },
+	// --perf-counters : 테스트마다 하드웨어 성능 카운터 측정(사용할 수 없으면 측정 없이 실행)
+	{ 0, "perf-counters", "TTLIB_PERF_COUNTERS", TestOptionValueNone, ParseSwitchOption, offsetof(TestOptions, perfCounters) },
+	// --no-leak-check, TTLIB_LEAK_CHECK=0 : 테스트가 해제하지 않은 메모리를 실패로 기록하지 않음
+	{ 0, "no-leak-check", NULL, TestOptionValueNone, ParseDisableOption, offsetof(TestOptions, leakCheck) },
+	{ 0, NULL, "TTLIB_LEAK_CHECK", TestOptionValueRequired, ParseSwitchOption, offsetof(TestOptions, leakCheck) },
+	// --heap-profile=DIR : 테스트별 힙 프로파일을 DIR 디렉터리에 기록
+	{ 0, "heap-profile", "TTLIB_HEAP_PROFILE", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, heapProfilePath) },
+	// --heap-sample=BYTES : 힙 프로파일 표본 사이의 평균 할당 크기
+	{ 0, "heap-sample", "TTLIB_HEAP_SAMPLE", TestOptionValueRequired, ParsePositiveOption, offsetof(TestOptions, heapSampleBytes) },
+	// --property-cases=N : 속성 기반 테스트 하나가 검사할 입력 개수
+	{ 0, "property-cases", "TTLIB_PROPERTY_CASES", TestOptionValueRequired, ParsePositiveOption, offsetof(TestOptions, propertyCases) },
+	// --property-seed=SEED : 속성 기반 테스트의 입력을 만드는 난수 seed
+	{ 0, "property-seed", "TTLIB_PROPERTY_SEED", TestOptionValueRequired, ParseSeedOption, offsetof(TestOptions, propertySeed) },
+	// --property-threads=N : 속성 기반 테스트 하나의 입력들을 동시에 검사할 스레드 개수(0 이면 CPU 개수)
+	{ 0, "property-threads", "TTLIB_PROPERTY_THREADS", TestOptionValueRequired, ParseWorkersOption, offsetof(TestOptions, propertyThreads) },
+	// --diff-cases=N : 차분 테스트 하나가 비교할 입력 개수
+	{ 0, "diff-cases", "TTLIB_DIFF_CASES", TestOptionValueRequired, ParsePositiveOption, offsetof(TestOptions, differentialCases) },
+	// --diff-threads=N : 차분 테스트 하나의 입력들을 동시에 비교할 스레드 개수(0 이면 CPU 개수)
+	{ 0, "diff-threads", "TTLIB_DIFF_THREADS", TestOptionValueRequired, ParseWorkersOption, offsetof(TestOptions, differentialThreads) },
+	// --fuzz=TEST : testCase.testName 퍼징 테스트를 libFuzzer 로 실행(-fsanitize=fuzzer 로 빌드 필요, '--' 뒤의 인자는 libFuzzer 옵션)
+	{ 0, "fuzz", NULL, TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, fuzzTarget) },
+	// --fuzz-corpus=DIR : 퍼징 테스트별 코퍼스 디렉터리를 둘 디렉터리(보통 실행에서는 저장된 입력을 회귀 테스트로 실행)
+	{ 0, "fuzz-corpus", "TTLIB_FUZZ_CORPUS", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, fuzzCorpusPath) },
+	// --cache=PATH : 테스트 결과 캐시 파일(지문이 같은 테스트는 이전 성공 결과를 재사용하고 실행 후 갱신된다)
+	{ 0, "cache", "TTLIB_CACHE", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, cachePath) },
+	// --failure-log=PATH : 검사 매크로 함수의 실패를 포맷팅하지 않고 바이너리로 기록할 파일(리포터에는 테스트별 첫 번째 실패만 전달하며 ttdecode 로 읽는다)
+	// 지정하지 않으면 순차 실행은 실패마다 바로 포맷팅하여 출력한다(비정상 종료나 멈춤 직전까지의 실패가 보이도록, 기록 후 포맷팅은 병렬 실행에서만 사용)
+	{ 0, "failure-log", "TTLIB_FAILURE_LOG", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, failureLogPath) },
+	// --state=PATH : 테스트별 마지막 실행 결과와 실행 시간을 기록하는 상태 파일(실행 순서 결정에 사용하고 실행 후 갱신된다)
+	{ 0, "state", "TTLIB_STATE", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, statePath) },
+	// --order=ORDER : 실행 순서(defined, failed-first, longest-first)
+	{ 0, "order", "TTLIB_ORDER", TestOptionValueRequired, ParseOrderOption, offsetof(TestOptions, testOrder) },
+	// --watch[=DIRS] : DIRS(':' 로 구분, 기본값 .) 디렉터리의 소스 파일이 바뀔 때마다 다시 빌드하고 영향받는 테스트를 다시 실행
+	{ 0, "watch", "TTLIB_WATCH", TestOptionValueOptional, ParseWatchOption, offsetof(TestOptions, watchPaths) },
+	// --watch-command=CMD : 감시 모드의 빌드 명령(기본값 make)
+	{ 0, "watch-command", "TTLIB_WATCH_COMMAND", TestOptionValueRequired, ParseTextOption, offsetof(TestOptions, watchCommand) },
+	// 감시 모드가 다시 실행하는 테스트 프로그램에 전달하는 바뀐 소스 파일 목록
+	{ 0, NULL, "TTLIB_WATCH_SOURCES", TestOptionValueRequired, ParsePathOption, offsetof(TestOptions, watchSources) },
+	// --fork-server[=N] : 초기화와 공유 픽스처 생성을 마친 프로세스에서 테스트 N 개(기본값 1)마다 새 작업자 프로세스를 만들어 실행
+	{ 0, "fork-server", "TTLIB_FORK_SERVER", TestOptionValueOptional, ParseForkServerOption, offsetof(TestOptions, forkServerBatch) },
+	// --async-limit=N : 하나의 이벤트 루프에서 동시에 진행할 ASYNC_TEST 최대 개수(1 이하면 하나씩 실행, 실행 순서에서 연속된 ASYNC_TEST 끼리만 함께 진행)
+	{ 0, "async-limit", "TTLIB_ASYNC_LIMIT", TestOptionValueRequired, ParseCountOption, offsetof(TestOptions, asyncLimit) }
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Local Functions
@@ -28,81 +176,60 @@ TestSuitPtr NewTestSuit()
 	}
 
 	// Initialize other members
-	testSuit->initializers = NULL;
 	testSuit->testPtrContainer = NULL;
 	testSuit->numberOfTests = 0;
 	testSuit->numberOfFailTests = 0;
 	testSuit->onGoing = TestContinue;
+	testSuit->testReports = NULL;
+	testSuit->elapsedNanoseconds = 0;
+	testSuit->reporter = NULL;
+	testSuit->ownsReporter = FALSE;
+	testSuit->nameIndex = NULL;
+	testSuit->selectedTests = NULL;
+	testSuit->numberOfSelectedTests = 0;
+	testSuit->baseline = NULL;
+	testSuit->numberOfRegressions = 0;
+	testSuit->perfCounterError = 0;
+	testSuit->fixturePtrContainer = NULL;
+	testSuit->numberOfFixtures = 0;
+	testSuit->fixtureIndex = NULL;
+	testSuit->dataPtrContainer = NULL;
+	testSuit->numberOfData = 0;
+	testSuit->cache = NULL;
+	testSuit->failureLogFile = NULL;
+	testSuit->pluginHandles = NULL;
+	testSuit->numberOfPlugins = 0;
+	testSuit->pluginTests = NULL;
+	testSuit->pluginFixtures = NULL;
+	testSuit->pluginData = NULL;
+	InitializeTestOptions(&testSuit->options);
 
 	return testSuit;
 }
 
 /**
- * @fn TestPtr AddTest(TestSuitPtr testSuit, Test test)
- * @brief 테스트를 추가하는 함수
+ * @fn TestInitializationResult RegisterTests(TestSuitPtr testSuit, TestPtrContainer begin, TestPtrContainer end)
+ * @brief 링커 섹션(ttlib_tests)에 배치된 테스트 레코드 리스트를 TestSuit 객체에 연결하는 함수
+ * TEST 매크로 함수가 만든 정적 레코드를 그대로 가리키므로 테스트 개수와 관계없이 메모리 할당이나 복사가 없다(O(1)).
+ * 테스트가 하나도 없으면 begin 과 end 가 모두 NULL 이다.
  * @param testSuit 전체 테스트 관리 구조체(출력)
- * @param test 추가할 테스트(입력)
- * @return 성공 시 새로 추가된 테스트 구조체 주소, 실패 시 NULL 반환
+ * @param begin 테스트 레코드 리스트의 시작(__start_ttlib_tests, 입력)
+ * @param end 테스트 레코드 리스트의 끝(__stop_ttlib_tests, 입력)
+ * @return 성공 시 TestInitializationResultSuccess, 실패 시 TestInitializationResultFail 반환
  */
-TestPtr AddTest(TestSuitPtr testSuit, Test test)
+TestInitializationResult RegisterTests(TestSuitPtr testSuit, TestPtrContainer begin, TestPtrContainer end)
 {
 	// Check parameter
-	if (testSuit == NULL)
-	{
-		return NULL;
-	}
-
-	// Create a new Test instance
-	TestPtr newTest = (TestPtr)malloc(sizeof(Test));
-	if (newTest == NULL)
-	{
-		return NULL;
-	}
-
-	// Allocate required memory for the created instance
-	char *testCase = strdup(test.testCase);
-	char *testName = strdup(test.testName);
-	if (testCase == NULL || testName == NULL)
+	if (testSuit == NULL || begin > end)
 	{
-		free(testCase);
-		free(testName);
-		free(newTest);
-		return NULL;
-	}
-
-	// Setup members of Test instance
-	newTest->testCase = testCase;
-	newTest->testName = testName;
-	newTest->testFunc = test.testFunc;
-
-	// Reallocate memory for testPtrContainer in TestSuit instance
-	int numberOfTests = testSuit->numberOfTests;
-	size_t newSize = 0;
-	TestPtrContainer newContainer = NULL;
-
-	if (testSuit->testPtrContainer == NULL) // None of testPtrContainer registered yet.
-	{
-		newContainer = NewTestPtrContainer((size_t)(numberOfTests + 1));
-	}
-	else // One or more testPtrContainer exist already.
-	{
-		newSize = sizeof(TestPtr) * (size_t)(numberOfTests + 1);
-		newContainer = (TestPtrContainer)realloc(testSuit->testPtrContainer, newSize);
-	}
-	if (newContainer == NULL)
-	{
-		DeleteTest(newTest);
-		return NULL;
+		return TestInitializationResultFail;
 	}
 
-	// Add new Test instance pointer at the end of the TestPtrContainer instance
-	newContainer[testSuit->numberOfTests] = newTest;
-
-	// Apply results to any related members
-	testSuit->testPtrContainer = newContainer;
-	testSuit->numberOfTests++;
+	testSuit->testPtrContainer = begin;
+	testSuit->numberOfTests = (begin == NULL) ? 0 : (int)(end - begin);
+	DeleteTestNameIndex(testSuit);
 
-	return newTest;
+	return TestInitializationResultSuccess;
 }
 
 /**
@@ -121,12 +248,34 @@ void DeleteTestSuit(TestSuitPtrContainer testSuitContainer)
 
 	TestSuitPtr testSuit = *testSuitContainer;
 
-	// release memory allocated to the array of Test instances
-	if ((testSuit->testPtrContainer != NULL) && (testSuit->numberOfTests > 0))
+	// release memory allocated to the array of TestReport instances
+	free(testSuit->testReports);
+
+	// release the test name index and the list of selected tests
+	DeleteTestNameIndex(testSuit);
+	free(testSuit->selectedTests);
+
+	// release the benchmark baseline loaded by RunAllTests
+	DeleteBenchmarkBaseline(testSuit);
+
+	// release the per-case fixture state prepared by RunAllTests
+	DeleteTestFixtures(testSuit);
+
+	// release the test fingerprints computed by RunAllTests
+	DeleteTestCache(testSuit);
+
+	// close the failure log file left open by RunAllTests
+	CloseTestFailureLog(testSuit);
+
+	// release the reporter created by RunAllTests
+	if (testSuit->ownsReporter == TRUE)
 	{
-		DeleteTestPtrContainer(testSuit->testPtrContainer, testSuit->numberOfTests);
+		DeleteTestReporter(&testSuit->reporter);
 	}
 
+	// close the test suite libraries last, since the records point into them
+	UnloadTestPlugins(testSuit);
+
 	// release memory allocated to the TestSuit instance
 	free(testSuit);
 
@@ -135,59 +284,297 @@ void DeleteTestSuit(TestSuitPtrContainer testSuitContainer)
 }
 
 /**
- * @fn void RunAllTests(TestSuitPtr testSuit)
+ * @fn int RunAllTests(TestSuitPtr testSuit)
  * @brief 전체 테스트들을 실행하는 함수
+ * 벤치마크 모드에서 기준 결과 파일을 지정하면 기준 결과보다 유의미하게 느려진 벤치마크도 실패한 테스트로 집계하므로,
+ * main 함수에서 반환값을 종료 코드로 사용하면 CI 에서 성능 저하를 검출할 수 있다.
  * @param testSuit 전체 테스트 관리 구조체(입력)
- * @return 반환값 없음
+ * @return 모든 테스트가 성공하면 0, 실패한 테스트가 있으면 1, 테스트를 실행하지 못했으면 -1 반환
  */
-void RunAllTests(TestSuitPtr testSuit)
+int RunAllTests(TestSuitPtr testSuit)
 {
 	// Check parameter
 	if (testSuit == NULL)
 	{
-		return;
+		return -1;
 	}
 
-	// Add user testPtrContainer into TestSuit instance
-	if (InitializeTests(testSuit) == TestInitializationResultFail)
+	// Watch mode rebuilds and reruns the test program, which runs the tests itself
+	if (testSuit->options.watchPaths != NULL)
 	{
-		return;
+		return WatchTests(testSuit);
 	}
 
 	int numberOfCurTests = 0;
 	int numberOfTests = testSuit->numberOfTests;
 
-	printf("--------------------------------\n");
-	printf("[ 총 테스트 수: %d 개 ]\n", numberOfTests);
-	printf("--------------------------------\n");
+	// Select the tests matching the filter option
+	if (SelectTests(testSuit) < 0)
+	{
+		puts("테스트 선택 실패");
+		return -1;
+	}
+
+	// Fuzzing mode runs exactly the named fuzz test
+	if (testSuit->options.fuzzTarget != NULL && testSuit->numberOfSelectedTests != 1)
+	{
+		printf("퍼징 테스트 없음 (target:%s)\n", testSuit->options.fuzzTarget);
+		return -1;
+	}
+
+	// Keep only the tests assigned to this shard
+	if (ShardTests(testSuit) < 0)
+	{
+		printf("잘못된 샤드 설정 (index:%d, total:%d)\n", testSuit->options.shardIndex, testSuit->options.totalShards);
+		return -1;
+	}
+
+	// Run the recently failing or the longest tests first, using the recorded state of the last runs
+	if (OrderTests(testSuit) < 0)
+	{
+		printf("테스트 실행 순서 결정 실패 (order:%s, state:%s)\n", GetTestOrderName(testSuit->options.testOrder), testSuit->options.statePath);
+		return -1;
+	}
+
+	// Only print the names of the selected tests with the list option
+	if (testSuit->options.listTests == TRUE)
+	{
+		PrintTestList(testSuit);
+		return 0;
+	}
+
+	// Mark the tests whose passing result can be reused, before the fixtures count the tests that will run
+	if (PrepareTestCache(testSuit) < 0)
+	{
+		printf("테스트 결과 캐시 준비 실패 (path:%s)\n", testSuit->options.cachePath);
+		return -1;
+	}
 
-	if (numberOfTests >= 1)
+	// Group the fixtures by test case and count the selected tests sharing them
+	if (PrepareTestFixtures(testSuit) < 0)
 	{
-		// Call all test functions in the array
-		TestPtr test = NULL;
-		while(numberOfCurTests < numberOfTests)
+		puts("테스트 픽스처 준비 실패");
+		return -1;
+	}
+
+	// Create the reporter selected by the options unless one was set by SetTestReporter
+	if (testSuit->reporter == NULL)
+	{
+		testSuit->reporter = NewTestReporter(testSuit->options.reporterName, testSuit->options.outputPath);
+		if (testSuit->reporter == NULL)
 		{
-			test = testSuit->testPtrContainer[numberOfCurTests];
-			if (test->testFunc == NULL) // testSuit->testPtrContainer is a NULL-terninated array
+			printf("리포터 생성 실패 (reporter:%s, output:%s)\n", (testSuit->options.reporterName != NULL) ? testSuit->options.reporterName : "console", (testSuit->options.outputPath != NULL) ? testSuit->options.outputPath : "-");
+			return -1;
+		}
+		testSuit->ownsReporter = TRUE;
+	}
+
+	// Load the benchmark baseline to compare the measurements with
+	testSuit->numberOfRegressions = 0;
+	if (testSuit->options.runBenchmarks == TRUE && testSuit->options.baselinePath != NULL && LoadBenchmarkBaseline(testSuit) != 0)
+	{
+		printf("벤치마크 기준 결과 파일 읽기 실패 (path:%s)\n", testSuit->options.baselinePath);
+		return -1;
+	}
+
+	// Create the directory for the per-test heap profiles
+	if (testSuit->options.heapProfilePath != NULL && mkdir(testSuit->options.heapProfilePath, 0777) != 0 && errno != EEXIST)
+	{
+		printf("힙 프로파일 디렉터리 생성 실패 (path:%s)\n", testSuit->options.heapProfilePath);
+		return -1;
+	}
+
+	// Create the binary failure log file, which receives the failures instead of the reporter
+	if (OpenTestFailureLog(testSuit) != 0)
+	{
+		printf("실패 기록 파일 생성 실패 (path:%s)\n", testSuit->options.failureLogPath);
+		return -1;
+	}
+
+	// Check once whether hardware counters can be opened here, and run without them otherwise
+	testSuit->perfCounterError = (testSuit->options.perfCounters == TRUE) ? ProbeTestPerfCounters() : 0;
+
+	ReportTestStart(testSuit);
+
+	if (numberOfTests >= 1 && testSuit->numberOfSelectedTests >= 1)
+	{
+		// Allocate a result report for each test
+		free(testSuit->testReports);
+		testSuit->testReports = (TestReportPtr)calloc((size_t)numberOfTests, sizeof(TestReport));
+		if (testSuit->testReports == NULL)
+		{
+			puts("테스트 결과 저장 공간 할당 실패");
+			FlushTestSink(testSuit->reporter->sink);
+			return -1;
+		}
+
+		long long startTime = GetMonotonicTime();
+
+		// Consecutive asynchronous tests run at once on one event loop, unless worker processes run the tests
+		int batchAsyncTests = (testSuit->options.runBenchmarks == FALSE && testSuit->options.fuzzTarget == NULL && testSuit->options.numberOfJobs <= 1 && testSuit->options.forkServerBatch == 0 && testSuit->options.asyncLimit > 1) ? TRUE : FALSE;
+
+		// Call the test functions in the selected order, one run of tests of the same kind at a time
+		int numberOfRuns = 0;
+		int start = 0;
+		while (start < testSuit->numberOfSelectedTests && testSuit->onGoing != TestExit)
+		{
+			int end = FindTestRunEnd(testSuit, start, batchAsyncTests);
+			numberOfCurTests = -1;
+			if (batchAsyncTests == TRUE && testSuit->testPtrContainer[testSuit->selectedTests[start]]->kind == TestKindAsync)
+			{
+				numberOfCurTests = RunAsyncTests(testSuit, start, end - start, testSuit->options.asyncLimit);
+			}
+			if (numberOfCurTests < 0)
 			{
-				break;
+				numberOfCurTests = RunSelectedTests(testSuit, start, end - start);
 			}
+			start = end;
+			numberOfRuns++;
+		}
+
+		if (numberOfRuns > 1)
+		{
+			// Count the results of all runs in the selected order
+			numberOfCurTests = MergeTestReports(testSuit, 0, testSuit->numberOfSelectedTests);
+		}
+
+		// Tear down the shared fixtures left by a test which requested exit
+		FinishTestFixtures(testSuit);
+
+		testSuit->elapsedNanoseconds = GetMonotonicTime() - startTime;
+	}
+
+	ReportTestFinish(testSuit, numberOfCurTests);
+
+	if (CloseTestFailureLog(testSuit) != 0)
+	{
+		printf("실패 기록 파일 저장 실패 (path:%s)\n", testSuit->options.failureLogPath);
+	}
+
+	if (numberOfCurTests > 0 && SaveTestTimings(testSuit) != 0)
+	{
+		printf("실행 시간 기록 파일 저장 실패 (path:%s)\n", testSuit->options.timingsPath);
+	}
+
+	if (numberOfCurTests > 0 && SaveTestState(testSuit) != 0)
+	{
+		printf("테스트 상태 파일 저장 실패 (path:%s)\n", testSuit->options.statePath);
+	}
+
+	if (numberOfCurTests > 0 && SaveTestCache(testSuit) != 0)
+	{
+		printf("테스트 결과 캐시 저장 실패 (path:%s)\n", testSuit->options.cachePath);
+	}
+
+	if (numberOfCurTests > 0 && SaveBenchmarkBaseline(testSuit) != 0)
+	{
+		printf("벤치마크 기준 결과 파일 저장 실패 (path:%s)\n", testSuit->options.baselinePath);
+	}
+
+	return (testSuit->numberOfFailTests > 0) ? 1 : 0;
+}
+
+/**
+ * @fn TestInitializationResult ParseTestOptions(TestSuitPtr testSuit, int argc, char **argv)
+ * @brief 환경 변수와 명령행 옵션을 해석하여 TestSuit 객체의 실행 옵션에 적용하는 함수
+ * 지원하는 옵션과 환경 변수는 _testOptions 표에 정의되어 있으며, 환경 변수로 지정한 값보다 명령행 옵션이 우선한다.
+ * 명령행 옵션과 환경 변수 모두 잘못된 값이면 해당 옵션을 출력하고 실패를 반환한다(값이 빈 환경 변수는 지정하지 않은 것으로 본다).
+ * '--' 뒤의 인자는 모두 libFuzzer 옵션으로 전달한다.
+ * @param testSuit 전체 테스트 관리 구조체(출력)
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 리스트(입력)
+ * @return 성공 시 TestInitializationResultSuccess, 실패 시 TestInitializationResultFail 반환
+ */
+TestInitializationResult ParseTestOptions(TestSuitPtr testSuit, int argc, char **argv)
+{
+	// Check parameter
+	if (testSuit == NULL || (argc > 0 && argv == NULL))
+	{
+		return TestInitializationResultFail;
+	}
 
-			printf("\n{ (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s }\n", (numberOfCurTests + 1), test->testCase, test->testName);
+	// Keep the arguments to run the rebuilt test program with in watch mode
+	testSuit->options.numberOfArguments = argc;
+	testSuit->options.arguments = argv;
 
-			test->testFunc(testSuit);
-			numberOfCurTests++;
-			if (testSuit->onGoing == TestExit) break;
+	const size_t numberOfOptions = sizeof(_testOptions) / sizeof(TestOption);
+	size_t optionIndex = 0;
+	for (; optionIndex < numberOfOptions; optionIndex++)
+	{
+		const TestOption *option = &_testOptions[optionIndex];
+		const char *value = (option->envName != NULL) ? getenv(option->envName) : NULL;
+		if (value == NULL || *value == '\0')
+		{
+			continue;
 		}
 
-		printf("\n--------------------------------\n");
-		printf("[ 총 성공 테스트 수: %d 개 / 실패 테스트 수: %d 개 ]\n", numberOfCurTests - testSuit->numberOfFailTests, testSuit->numberOfFailTests);
-		printf("--------------------------------\n");
+		if (option->parse(value, &testSuit->options, option->offset) != 0)
+		{
+			printf("잘못된 환경 변수 값 (variable:%s, value:%s)\n", option->envName, value);
+			return TestInitializationResultFail;
+		}
 	}
-	else
+
+	int argIndex = 1;
+	for (; argIndex < argc; argIndex++)
 	{
-		puts("\n[ 테스트가 존재하지 않음. ]\n");
+		const char *arg = argv[argIndex];
+		if (strcmp(arg, "--") == 0)
+		{
+			// The rest belongs to libFuzzer
+			testSuit->options.numberOfFuzzArguments = argc - argIndex - 1;
+			testSuit->options.fuzzArguments = argv + argIndex + 1;
+			break;
+		}
+
+		const TestOption *option = FindTestOption(arg);
+		if (option == NULL)
+		{
+			printf("알 수 없는 옵션 (option:%s)\n", arg);
+			return TestInitializationResultFail;
+		}
+
+		// A short option takes its value from the same argument (-j4) or the next one (-j 4)
+		const char *value = NULL;
+		if (arg[1] != '-')
+		{
+			value = (arg[2] != '\0') ? arg + 2 : NULL;
+			if (value == NULL && option->valueType == TestOptionValueRequired)
+			{
+				if (argIndex + 1 >= argc)
+				{
+					printf("옵션 값이 없음 (option:%s)\n", arg);
+					return TestInitializationResultFail;
+				}
+				value = argv[++argIndex];
+			}
+		}
+		else
+		{
+			const char *equal = strchr(arg, '=');
+			value = (equal != NULL) ? equal + 1 : NULL;
+			if (value == NULL && option->valueType == TestOptionValueRequired)
+			{
+				printf("옵션 값이 없음 (option:%s)\n", arg);
+				return TestInitializationResultFail;
+			}
+		}
+
+		if ((value != NULL && option->valueType == TestOptionValueNone) || option->parse(value, &testSuit->options, option->offset) != 0)
+		{
+			printf("잘못된 옵션 값 (option:%s)\n", arg);
+			return TestInitializationResultFail;
+		}
+	}
+
+	// TTLIB_SHARD_INDEX and TTLIB_TOTAL_SHARDS are given separately
+	if (testSuit->options.shardIndex >= testSuit->options.totalShards)
+	{
+		printf("잘못된 샤드 설정 (index:%d, total:%d)\n", testSuit->options.shardIndex, testSuit->options.totalShards);
+		return TestInitializationResultFail;
 	}
+
+	return TestInitializationResultSuccess;
 }
 
 /**
@@ -224,95 +611,806 @@ void SetExitTestSuit(TestSuitPtr testSuit)
 	testSuit->onGoing = TestExit;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void InitializeTestContext(TestContextPtr context, TestSuitPtr testSuit, int streamFailures)
+ * @brief 작업자(순차 실행, 프로세스, 스레드)가 테스트 실행에 사용할 TestContext 객체를 초기화하는 함수
+ * 실패 정보 기록 버퍼는 같은 작업자가 실행하는 테스트들 사이에서 재사용된다.
+ * @param context 초기화할 TestContext 객체(출력)
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param streamFailures 실패 정보를 즉시 리포터에 전달할지 여부(입력, 순차 실행 시 TRUE)
+ * @return 반환값 없음
+ */
+void InitializeTestContext(TestContextPtr context, TestSuitPtr testSuit, int streamFailures)
+{
+	memset(context, 0, sizeof(TestContext));
+	context->onGoing = TestContinue;
+	context->testSuit = testSuit;
+	context->streamFailures = streamFailures;
+	context->failureFd = -1;
+	context->useWatchdog = TRUE;
+}
+
+/**
+ * @fn void ReleaseTestContext(TestContextPtr context)
+ * @brief TestContext 객체의 실패 정보 기록 버퍼와 제한 시간 감시 타이머, 하드웨어 성능 카운터, 메모리 할당 기록을 해제하는 함수
+ * @param context 해제할 TestContext 객체(입력, 출력)
+ * @return 반환값 없음
+ */
+void ReleaseTestContext(TestContextPtr context)
+{
+	free(context->failureLog);
+	context->failureLog = NULL;
+	context->failureLogLength = 0;
+	context->failureLogCapacity = 0;
+	DeleteTestWatchdog(context);
+	DeleteTestPerfCounters(context);
+	DeleteTestAllocationTracker(context);
+	DeleteTestEventLoop(context);
+}
+
+/**
+ * @fn void ResetTestContext(TestContextPtr context, int testIndex)
+ * @brief 다음 테스트를 실행하기 위해 TestContext 객체의 테스트별 상태를 초기화하는 함수
+ * 실패 정보 기록 버퍼와 전달 소켓, 제한 시간 감시 타이머, 하드웨어 성능 카운터, 메모리 할당 기록, 이벤트 루프는 재사용하기 위해 유지한다.
+ * @param context 초기화할 TestContext 객체(입력, 출력)
+ * @param testIndex 실행할 테스트 번호(입력)
+ * @return 반환값 없음
+ */
+void ResetTestContext(TestContextPtr context, int testIndex)
+{
+	char *failureLog = context->failureLog;
+	size_t failureLogCapacity = context->failureLogCapacity;
+	int failureFd = context->failureFd;
+	int useWatchdog = context->useWatchdog;
+	TestWatchdogPtr watchdog = context->watchdog;
+	TestPerfCountersPtr perfCounters = context->perfCounters;
+	TestAllocationTrackerPtr allocationTracker = context->allocationTracker;
+	TestEventLoopPtr eventLoop = context->eventLoop;
+	InitializeTestContext(context, context->testSuit, context->streamFailures);
+	context->testIndex = testIndex;
+	context->failureLog = failureLog;
+	context->failureLogCapacity = failureLogCapacity;
+	context->failureFd = failureFd;
+	context->useWatchdog = useWatchdog;
+	context->watchdog = watchdog;
+	context->perfCounters = perfCounters;
+	context->allocationTracker = allocationTracker;
+	context->eventLoop = eventLoop;
+}
+
+/**
+ * @fn void RunTest(TestSuitPtr testSuit, int testIndex, TestReportPtr report, TestContextPtr context)
+ * @brief 지정한 번호의 테스트 하나를 실행하고 그 결과를 저장하는 함수
+ * 작업자마다 따로 가진 TestContext 객체를 현재 스레드에 설정하므로 여러 스레드에서 동시에 호출할 수 있다.
+ * TestSuit 객체는 변경하지 않으며(테스트 케이스의 공유 픽스처 상태는 잠금으로 보호된다), 결과는 호출한 쪽에서 반영한다.
+ * 실패 정보를 즉시 전달하는 TestContext 이면 테스트 시작과 결과도 직접 리포터에 전달하고,
+ * 그렇지 않으면 호출한 쪽에서 context 의 실패 정보 기록과 함께 ReplayTestResult 함수로 전달한다.
+ * 제한 시간이 있는 테스트는 현재 스레드로 시그널을 보내는 타이머로 감시하다가 제한 시간이 지나면 테스트 함수를 빠져나와 TestTimeout 으로 기록한다
+ * (작업자 프로세스에서는 useWatchdog 가 FALSE 이며 부모 프로세스가 작업자 프로세스를 종료시킨다).
+ * 테스트 케이스에 공유 픽스처가 있으면 실행 시간과 메모리 할당 기록을 시작하기 전에 준비하고, 마지막 테스트가 끝나면 결과를 전달하기 전에 정리한다.
+ * 테스트 함수를 실행하는 동안 현재 스레드의 메모리 할당을 기록하고, 다른 실패 없이 끝난 테스트가 해제하지 않은 블록을 남기면 LEAK_CHECK 실패로 기록한다.
+ * 결과 캐시에서 이전 성공 결과를 재사용하는 테스트는 픽스처와 테스트 함수를 실행하지 않고 성공으로 기록한다.
+ * 순차 실행과 작업자 프로세스, 스레드 실행에서 함께 사용하기 때문에 전달받은 인자에 대한 검사를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 실행할 테스트 번호(0 부터 시작, 입력)
+ * @param report 테스트 실행 결과를 저장할 구조체(출력)
+ * @param context 테스트 실행에 사용할 TestContext 객체(입력, 출력)
+ * @return 반환값 없음
+ */
+void RunTest(TestSuitPtr testSuit, int testIndex, TestReportPtr report, TestContextPtr context)
+{
+	// Reset the per-test state, keeping the failure log buffer and the watchdog for reuse
+	ResetTestContext(context, testIndex);
+
+	// A passing result whose fingerprint has not changed is reused without running the test
+	if (IsTestResultCached(testSuit, testIndex) == TRUE)
+	{
+		memset(report, 0, sizeof(TestReport));
+		report->result = TestSuccess;
+		report->cached = TRUE;
+		report->timeoutMilliseconds = GetTestTimeout(testSuit, testIndex);
+		if (context->streamFailures == TRUE)
+		{
+			ReportTestBegin(testSuit, testIndex);
+			ReportTestEnd(testSuit, testIndex, report);
+		}
+		return;
+	}
+
+	int timeoutMilliseconds = GetTestTimeout(testSuit, testIndex);
+	TestWatchdogPtr watchdog = NULL;
+	if (timeoutMilliseconds > 0 && context->useWatchdog == TRUE)
+	{
+		watchdog = GetTestWatchdog(context);
+	}
+
+	TestPerfCountersPtr perfCounters = NULL;
+	if (testSuit->options.perfCounters == TRUE && testSuit->perfCounterError == 0)
+	{
+		perfCounters = GetTestPerfCounters(context);
+	}
+
+	TestAllocationTrackerPtr allocationTracker = GetTestAllocationTracker(context);
+	if (allocationTracker != NULL && testSuit->options.heapProfilePath != NULL)
+	{
+		GetTestHeapProfile(allocationTracker, testSuit->options.heapSampleBytes);
+	}
+
+	TestContextPtr previousContext = _testContext;
+	_testContext = context;
+
+	if (context->streamFailures == TRUE)
+	{
+		ReportTestBegin(testSuit, testIndex);
+	}
+
+	// The shared fixture is built outside the measurement of the first test using it
+	int fixtureReady = AcquireTestFixture(testSuit, testIndex);
+
+	long long startCpuTime = GetThreadCpuTime();
+	unsigned long long startCycles = ReadCycleCounter();
+	long long startTime = GetMonotonicTime();
+
+	if (allocationTracker != NULL)
+	{
+		StartTestAllocations(allocationTracker);
+		if (allocationTracker->heapProfile != NULL)
+		{
+			StartTestHeapProfile(allocationTracker->heapProfile, testIndex);
+		}
+	}
+
+	if (perfCounters != NULL)
+	{
+		StartTestPerfCounters(perfCounters);
+	}
+
+	if (fixtureReady != 0)
+	{
+		// The shared fixture of the test case could not be built
+		report->result = TestFail;
+	}
+	else if (watchdog == NULL)
+	{
+		report->result = RunTestFunction(testSuit, testIndex);
+	}
+	else if (sigsetjmp(watchdog->jumpBuffer, 0) == 0)
+	{
+		ArmTestWatchdog(watchdog, timeoutMilliseconds);
+		report->result = RunTestFunction(testSuit, testIndex);
+		DisarmTestWatchdog(watchdog);
+	}
+	else
+	{
+		// The watchdog signal handler jumped out of the test function
+		report->result = TestTimeout;
+	}
+
+	if (perfCounters != NULL)
+	{
+		StopTestPerfCounters(perfCounters, &report->perfCounters);
+	}
+	else
+	{
+		report->perfCounters.measured = FALSE;
+	}
+
+	if (allocationTracker != NULL)
+	{
+		StopTestAllocations(allocationTracker, &report->allocations);
+		if (allocationTracker->heapProfile != NULL)
+		{
+			WriteTestHeapProfile(testSuit, testIndex, allocationTracker->heapProfile);
+		}
+
+		// A leak fails a test that passed otherwise
+		if (testSuit->options.leakCheck == TRUE && report->allocations.tracked == TRUE && report->allocations.leakedBlocks > 0 && report->result == TestSuccess)
+		{
+			ReportTestLeaks(testSuit, testIndex, allocationTracker);
+			context->failCount++;
+			report->result = TestFail;
+		}
+	}
+	else
+	{
+		report->allocations.tracked = FALSE;
+	}
+
+	report->elapsedNanoseconds = GetMonotonicTime() - startTime;
+	report->cycles = ReadCycleCounter() - startCycles;
+	report->cpuNanoseconds = GetThreadCpuTime() - startCpuTime;
+
+	// The last test of the case tears the shared fixture down, and its failures fail that test
+	int failCount = context->failCount;
+	ReleaseTestFixture(testSuit, testIndex);
+	if (context->failCount > failCount && report->result == TestSuccess)
+	{
+		report->result = TestFail;
+	}
+
+	report->exitRequested = (context->onGoing == TestExit) ? TRUE : FALSE;
+	report->signalNumber = 0;
+	report->exitStatus = 0;
+	report->timeoutMilliseconds = timeoutMilliseconds;
+	report->benchmark = context->benchmark;
+	report->cached = FALSE;
+
+	_testContext = previousContext;
+
+	if (context->streamFailures == TRUE)
+	{
+		ReportTestEnd(testSuit, testIndex, report);
+	}
+}
+
+/**
+ * @fn int MergeTestReports(TestSuitPtr testSuit, int start, int count)
+ * @brief 실행 순서의 한 구간에 있는 테스트별 실행 결과를 실행 순서대로 집계하여 TestSuit 객체에 반영하는 함수
+ * ASSERT 실패로 종료를 요청한 첫 번째 테스트까지만 집계하므로 순차 실행 결과와 같은 성공/실패 테스트 수를 얻는다.
+ * 실패 테스트 수는 구간의 집계 결과로 바꾸므로, 여러 구간을 나누어 실행했으면 전체 구간으로 다시 집계한다.
+ * 병렬 실행 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param start 구간의 첫 실행 순서(selectedTests 의 위치, 입력)
+ * @param count 구간의 테스트 개수(입력)
+ * @return 실행된 것으로 집계된 테스트 개수 반환
+ */
+int MergeTestReports(TestSuitPtr testSuit, int start, int count)
+{
+	int numberOfCurTests = 0;
+	int numberOfFailTests = 0;
+
+	int selectedIndex = start;
+	for (; selectedIndex < start + count; selectedIndex++)
+	{
+		TestReportPtr report = &testSuit->testReports[testSuit->selectedTests[selectedIndex]];
+		if (report->result == TestNotRun)
+		{
+			continue;
+		}
+
+		numberOfCurTests++;
+		if (report->result == TestFail || report->result == TestCrash || report->result == TestTimeout)
+		{
+			numberOfFailTests++;
+		}
+		if (report->exitRequested == TRUE)
+		{
+			testSuit->onGoing = TestExit;
+			break;
+		}
+	}
+	testSuit->numberOfFailTests = numberOfFailTests;
+
+	return numberOfCurTests;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- * @fn static TestInitializationResult InitializeTests(TestSuitPtr testSuit)
- * @brief 사용자가 작성한 테스트 함수들을 전체 테스트 관리 구조체(TestSuit)에 등록하는 함수
- * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
- * @param testSuit 전체 테스트 관리 구조체(입력, 읽기 전용)
- * @return 성공 시 TestInitializationResultSuccess, 실패 시 TestInitializationResultSuccessFail 반환
+ * @fn static void InitializeTestOptions(TestOptionsPtr options)
+ * @brief 테스트 실행 옵션을 기본값으로 초기화하는 함수(환경 변수와 명령행 옵션은 ParseTestOptions 함수에서 적용한다)
+ * 속성 기반 테스트의 seed 를 지정하지 않으면 실행할 때마다 현재 시각과 프로세스 번호로 정한다(작업자 프로세스를 만들기 전에 정하므로 모두 같은 seed 를 사용한다).
+ * NewTestSuit 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param options 초기화할 테스트 실행 옵션(출력)
+ * @return 반환값 없음
  */
-static TestInitializationResult InitializeTests(const TestSuitPtr testSuit)
+static void InitializeTestOptions(TestOptionsPtr options)
 {
-	TestSuitInitializer *initializers = testSuit->initializers;
-	if (initializers == NULL)
+	options->numberOfJobs = 1;
+	options->numberOfThreads = 1;
+	options->numberOfSlowestTests = 5;
+	options->reporterName = NULL;
+	options->outputPath = NULL;
+	options->quiet = FALSE;
+	options->filter = NULL;
+	options->listTests = FALSE;
+	options->totalShards = 1;
+	options->shardIndex = 0;
+	options->timingsPath = NULL;
+	options->timeoutMilliseconds = 0;
+	options->runBenchmarks = FALSE;
+	options->benchmarkMilliseconds = 500;
+	options->benchmarkRepetitions = 20;
+	options->baselinePath = NULL;
+	options->baselineTag = "default";
+	options->regressionThreshold = 5;
+	options->updateBaseline = FALSE;
+	options->perfCounters = FALSE;
+	options->leakCheck = TRUE;
+	options->heapProfilePath = NULL;
+	options->heapSampleBytes = 65536;
+	options->propertyCases = 100;
+	options->propertySeed = ((unsigned long long)time(NULL) << 16) ^ (unsigned long long)getpid();
+	options->propertyThreads = 1;
+	options->differentialCases = 1000000;
+	options->differentialThreads = ParseNumberOfWorkers("0");
+	options->fuzzTarget = NULL;
+	options->fuzzCorpusPath = NULL;
+	options->numberOfFuzzArguments = 0;
+	options->fuzzArguments = NULL;
+	options->cachePath = NULL;
+	options->failureLogPath = NULL;
+	options->statePath = NULL;
+	options->testOrder = TestOrderDefined;
+	options->watchPaths = NULL;
+	options->watchCommand = "make";
+	options->watchSources = NULL;
+	options->numberOfArguments = 0;
+	options->arguments = NULL;
+	options->forkServerBatch = 0;
+	options->asyncLimit = 256;
+}
+
+/**
+ * @fn static int ParseNumberOfWorkers(const char *value)
+ * @brief 작업자(프로세스 또는 스레드) 개수를 나타내는 문자열을 정수로 변환하는 함수
+ * 0 을 지정하면 현재 사용 가능한 CPU 개수를 사용한다.
+ * @param value 변환할 문자열(입력)
+ * @return 성공 시 작업자 개수, 실패 시 -1 반환
+ */
+static int ParseNumberOfWorkers(const char *value)
+{
+	long numberOfWorkers = ParseNonNegative(value);
+	if (numberOfWorkers < 0 || numberOfWorkers > 4096)
 	{
-		return TestInitializationResultFail;
+		return -1;
 	}
 
-	TestSuitInitializer initializer = NULL;
-	while ((initializer = *initializers++) != NULL)
+	if (numberOfWorkers == 0)
 	{
-		initializer();
+		long numberOfCpus = sysconf(_SC_NPROCESSORS_ONLN);
+		numberOfWorkers = (numberOfCpus > 0) ? numberOfCpus : 1;
 	}
 
-	return TestInitializationResultSuccess;
+	return (int)numberOfWorkers;
 }
 
 /**
- * @fn static TestPtrContainer NewTestPtrContainer(size_t numberOfTests)
- * @brief TestPtrContainer 를 새로 생성하는 함수
- * @param numberOfTests 저장할 Test 구조체 포인터의 개수(입력)
- * @return 성공 시 새로 생성된 TestPtrContainer 객체, 실패 시 NULL 반환
+ * @fn static int FindTestRunEnd(TestSuitPtr testSuit, int start, int batchAsyncTests)
+ * @brief 실행 순서의 start 위치부터 한 번에 실행할 테스트 구간의 끝을 찾는 함수
+ * ASYNC_TEST 를 함께 진행하면 ASYNC_TEST 인지 여부가 같은 연속된 테스트까지를 한 구간으로 보고, 그렇지 않으면 나머지 테스트 전체가 한 구간이다.
+ * 구간은 실행 순서를 바꾸지 않으므로 --order 와 상태 파일로 정한 순서가 그대로 유지된다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param start 구간의 첫 실행 순서(입력)
+ * @param batchAsyncTests ASYNC_TEST 를 하나의 이벤트 루프에서 함께 진행하는지 여부(입력)
+ * @return 구간의 끝(포함하지 않는 실행 순서) 반환
  */
-static TestPtrContainer NewTestPtrContainer(size_t numberOfTests)
+static int FindTestRunEnd(TestSuitPtr testSuit, int start, int batchAsyncTests)
 {
-	TestPtrContainer testPtrContainer = (TestPtrContainer)malloc(sizeof(TestPtr) * numberOfTests);
-	if (testPtrContainer == NULL)
+	int end = start + 1;
+	if (batchAsyncTests == FALSE)
 	{
-		return NULL;
+		return testSuit->numberOfSelectedTests;
 	}
 
-	size_t testIndex = 0;
-	for (; testIndex < numberOfTests; testIndex++)
+	int isAsync = (testSuit->testPtrContainer[testSuit->selectedTests[start]]->kind == TestKindAsync) ? TRUE : FALSE;
+	while (end < testSuit->numberOfSelectedTests && ((testSuit->testPtrContainer[testSuit->selectedTests[end]]->kind == TestKindAsync) ? TRUE : FALSE) == isAsync)
 	{
-		testPtrContainer[testIndex] = NULL;
+		end++;
 	}
 
-	return testPtrContainer;
+	return end;
 }
 
 /**
- * @fn static void DeleteTestPtrContainer(TestPtrContainer testPtrContainer, int numberOfTests)
- * @brief TestPtrContainer 를 삭제하는 함수
- * DeleteTestSuit 함수에서 호출되기 때문에 전달받은 구조체의 이중 포인터에 대한 NULL 체크와 numberOfTests 에 대한 체크를 수행하지 않는다.
- * @param testPtrContainer 삭제할 구조체의 포인터들을 가지는 이중 포인터(입력, 이중 포인터)
- * @param numberOfTests 저장된 Test 구조체 포인터의 개수(입력)
- * @return 반환값 없음
+ * @fn static int RunSelectedTests(TestSuitPtr testSuit, int start, int count)
+ * @brief 실행 순서의 한 구간에 있는 테스트들을 실행 옵션에 따라 순차 실행, 작업자 프로세스 또는 작업자 스레드로 실행하는 함수
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param start 구간의 첫 실행 순서(selectedTests 의 위치, 입력)
+ * @param count 구간의 테스트 개수(입력)
+ * @return 실행된 것으로 집계된 테스트 개수 반환
+ */
+static int RunSelectedTests(TestSuitPtr testSuit, int start, int count)
+{
+	int numberOfCurTests = 0;
+	if (testSuit->options.runBenchmarks == TRUE || testSuit->options.fuzzTarget != NULL)
+	{
+		// Benchmarks run alone so that parallel tests do not disturb the measurement, and libFuzzer owns the process
+		numberOfCurTests = RunTestsInSerial(testSuit, start, count);
+	}
+	else if (testSuit->options.numberOfJobs > 1 || testSuit->options.forkServerBatch > 0)
+	{
+		numberOfCurTests = RunTestsInProcesses(testSuit, start, count, testSuit->options.numberOfJobs);
+	}
+	else if (testSuit->options.numberOfThreads > 1)
+	{
+		numberOfCurTests = RunTestsInThreads(testSuit, start, count, testSuit->options.numberOfThreads);
+	}
+	else
+	{
+		numberOfCurTests = RunTestsInSerial(testSuit, start, count);
+	}
+
+	return numberOfCurTests;
+}
+
+/**
+ * @fn static int RunTestsInSerial(TestSuitPtr testSuit, int start, int count)
+ * @brief 실행 순서의 한 구간에 있는 테스트들을 현재 프로세스에서 하나씩 차례대로 실행하는 함수
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param start 구간의 첫 실행 순서(selectedTests 의 위치, 입력)
+ * @param count 구간의 테스트 개수(입력)
+ * @return 실행된 테스트 개수 반환
  */
-static void DeleteTestPtrContainer(TestPtrContainer testPtrContainer, int numberOfTests)
+static int RunTestsInSerial(TestSuitPtr testSuit, int start, int count)
 {
-	TestPtr test = NULL;
+	int numberOfCurTests = 0;
+	int numberOfTests = count;
+
+	// Failures go through the binary failure log file when one is given, except under libFuzzer
+	TestContext context;
+	InitializeTestContext(&context, testSuit, (testSuit->failureLogFile == NULL || testSuit->options.fuzzTarget != NULL) ? TRUE : FALSE);
 
-	int testIndex = 0;
-	for (; testIndex < numberOfTests; testIndex++)
+	while (numberOfCurTests < numberOfTests)
 	{
-		test = testPtrContainer[testIndex];
-		if(test != NULL)
+		int testIndex = testSuit->selectedTests[start + numberOfCurTests];
+		TestReportPtr report = &testSuit->testReports[testIndex];
+		RunTest(testSuit, testIndex, report, &context);
+		if (context.streamFailures == FALSE)
+		{
+			ReplayTestResult(testSuit, testIndex, context.failureLog, context.failureLogLength, report);
+		}
+		numberOfCurTests++;
+
+		// Apply the result of the test to TestSuit instance
+		if (report->result == TestFail || report->result == TestTimeout)
+		{
+			IncFailCountTestSuit(testSuit);
+		}
+		if (report->exitRequested == TRUE)
 		{
-			free(test->testCase);
-			free(test->testName);
-			free(test);
+			SetExitTestSuit(testSuit);
 		}
+		if (testSuit->onGoing == TestExit) break;
 	}
 
-	free(testPtrContainer);
+	ReleaseTestContext(&context);
+
+	return numberOfCurTests;
 }
 
 /**
- * @fn static void DeleteTest(TestPtr test)
- * @brief Test 구조체를 삭제하는 함수
- * AddTest 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
- * @param test 삭제할 Test 구조체(입력)
- * @return 반환값 없음
+ * @fn static int ParseNonNegative(const char *value)
+ * @brief 0 이상의 정수를 나타내는 문자열을 정수로 변환하는 함수
+ * @param value 변환할 문자열(입력)
+ * @return 성공 시 변환된 정수, 실패 시 -1 반환
+ */
+static int ParseNonNegative(const char *value)
+{
+	char *end = NULL;
+	long number = strtol(value, &end, 10);
+	if (end == value || *end != '\0' || number < 0 || number > 0x7fffffffL)
+	{
+		return -1;
+	}
+
+	return (int)number;
+}
+
+/**
+ * @fn static const TestOption *FindTestOption(const char *arg)
+ * @brief 명령행 인자(-j4, -q, --jobs=4, --watch 등)에 해당하는 실행 옵션을 _testOptions 표에서 찾는 함수
+ * @param arg 명령행 인자(입력)
+ * @return 성공 시 실행 옵션, 알 수 없는 옵션이면 NULL 반환
+ */
+static const TestOption *FindTestOption(const char *arg)
+{
+	if (arg[0] != '-' || arg[1] == '\0')
+	{
+		return NULL;
+	}
+
+	const char *name = (arg[1] == '-') ? arg + 2 : NULL;
+	size_t nameLength = (name != NULL) ? strcspn(name, "=") : 0;
+
+	const size_t numberOfOptions = sizeof(_testOptions) / sizeof(TestOption);
+	size_t optionIndex = 0;
+	for (; optionIndex < numberOfOptions; optionIndex++)
+	{
+		const TestOption *option = &_testOptions[optionIndex];
+		if (name == NULL)
+		{
+			// A short option without a value must be given alone (-q)
+			if (option->shortName == arg[1] && (arg[2] == '\0' || option->valueType != TestOptionValueNone))
+			{
+				return option;
+			}
+		}
+		else if (option->longName != NULL && strncmp(option->longName, name, nameLength) == 0 && option->longName[nameLength] == '\0')
+		{
+			return option;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static int ParseWorkersOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 작업자(프로세스 또는 스레드) 개수 옵션을 해석하는 함수(0 이면 CPU 개수)
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 성공 시 0, 잘못된 값이면 -1 반환
+ */
+static int ParseWorkersOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	int numberOfWorkers = ParseNumberOfWorkers(value);
+	if (numberOfWorkers < 0)
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, int) = numberOfWorkers;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseCountOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 0 이상의 정수 옵션을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 성공 시 0, 잘못된 값이면 -1 반환
+ */
+static int ParseCountOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	int number = ParseNonNegative(value);
+	if (number < 0)
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, int) = number;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParsePositiveOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 1 이상의 정수 옵션을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 성공 시 0, 잘못된 값이면 -1 반환
+ */
+static int ParsePositiveOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	int number = ParseNonNegative(value);
+	if (number < 1)
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, int) = number;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseSwitchOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 켜고 끄는 옵션을 해석하는 함수(값이 없거나 "0" 이 아니면 켠다)
+ * @param value 옵션 값(입력, 명령행 옵션이면 NULL)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 항상 0 반환
+ */
+static int ParseSwitchOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	*TEST_OPTION_FIELD(options, offset, int) = (value != NULL && strcmp(value, "0") == 0) ? FALSE : TRUE;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseDisableOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 기본으로 켜진 기능을 끄는 옵션(--no-leak-check 등)을 해석하는 함수
+ * @param value 옵션 값(사용하지 않음)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 항상 0 반환
+ */
+static int ParseDisableOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	(void)value;
+	*TEST_OPTION_FIELD(options, offset, int) = FALSE;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParsePathOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 경로나 패턴처럼 문자열을 그대로 사용하는 옵션을 해석하는 함수(빈 문자열이면 지정하지 않은 것으로 본다)
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 const char * 멤버의 위치(입력)
+ * @return 항상 0 반환
+ */
+static int ParsePathOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	*TEST_OPTION_FIELD(options, offset, const char*) = (*value != '\0') ? value : NULL;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseTextOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 비어 있으면 안 되는 문자열 옵션(--watch-command 등)을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 const char * 멤버의 위치(입력)
+ * @return 성공 시 0, 빈 문자열이면 -1 반환
+ */
+static int ParseTextOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	if (*value == '\0')
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, const char*) = value;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseTagOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 공백이 없는 이름 옵션(--benchmark-tag)을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 const char * 멤버의 위치(입력)
+ * @return 성공 시 0, 비어 있거나 공백이 있으면 -1 반환
+ */
+static int ParseTagOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	if (strpbrk(value, " \t\r\n") != NULL)
+	{
+		return -1;
+	}
+
+	return ParseTextOption(value, options, offset);
+}
+
+/**
+ * @fn static int ParseReporterOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 리포터 이름 옵션을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 const char * 멤버의 위치(입력)
+ * @return 성공 시 0, 알 수 없는 리포터이면 -1 반환
+ */
+static int ParseReporterOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	if (HasTestReporter(value) == FALSE)
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, const char*) = value;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseOrderOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 실행 순서 옵션(defined, failed-first, longest-first)을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 성공 시 0, 알 수 없는 실행 순서이면 -1 반환
+ */
+static int ParseOrderOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	int testOrder = ParseTestOrder(value);
+	if (testOrder < 0)
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, int) = testOrder;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseWatchOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 감시 모드 옵션을 해석하는 함수(값이 없거나 비어 있으면 현재 디렉터리를 감시한다)
+ * @param value 옵션 값(입력, 명령행에서 값 없이 지정하면 NULL)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 const char * 멤버의 위치(입력)
+ * @return 항상 0 반환
  */
-static void DeleteTest(TestPtr test)
+static int ParseWatchOption(const char *value, TestOptionsPtr options, size_t offset)
 {
-	free(test->testCase);
-	free(test->testName);
-	free(test);
+	*TEST_OPTION_FIELD(options, offset, const char*) = (value != NULL && *value != '\0') ? value : ".";
+
+	return 0;
 }
 
+/**
+ * @fn static int ParseForkServerOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 포크 서버 모드 옵션을 해석하는 함수(값이 없으면 테스트 1 개마다 새 작업자 프로세스를 만든다)
+ * @param value 옵션 값(입력, 명령행에서 값 없이 지정하면 NULL)
+ * @param options 값을 저장할 테스트 실행 옵션(출력)
+ * @param offset 값을 저장할 int 멤버의 위치(입력)
+ * @return 성공 시 0, 잘못된 값이면 -1 반환
+ */
+static int ParseForkServerOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	if (value == NULL)
+	{
+		*TEST_OPTION_FIELD(options, offset, int) = 1;
+		return 0;
+	}
+
+	return ParseCountOption(value, options, offset);
+}
+
+/**
+ * @fn static int ParseShardOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief "INDEX/TOTAL" 형식의 샤드 지정 옵션을 해석하여 실행 옵션에 적용하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 샤드 정보를 저장할 테스트 실행 옵션(출력)
+ * @param offset 사용하지 않음(shardIndex 와 totalShards 를 함께 저장한다)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int ParseShardOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	(void)offset;
+	const char *slash = strchr(value, '/');
+	if (slash == NULL || slash == value)
+	{
+		return -1;
+	}
+
+	char index[16];
+	size_t indexLength = (size_t)(slash - value);
+	if (indexLength >= sizeof(index))
+	{
+		return -1;
+	}
+	memcpy(index, value, indexLength);
+	index[indexLength] = '\0';
+
+	int shardIndex = ParseNonNegative(index);
+	int totalShards = ParseNonNegative(slash + 1);
+	if (shardIndex < 0 || totalShards < 1 || shardIndex >= totalShards)
+	{
+		return -1;
+	}
+
+	options->shardIndex = shardIndex;
+	options->totalShards = totalShards;
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseSeedOption(const char *value, TestOptionsPtr options, size_t offset)
+ * @brief 난수 seed 를 나타내는 부호 없는 10 진수 옵션을 해석하는 함수
+ * @param value 옵션 값(입력)
+ * @param options 값을 저장할 테스트 실행 옵션(출력, 실패하면 변경하지 않는다)
+ * @param offset 값을 저장할 unsigned long long 멤버의 위치(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int ParseSeedOption(const char *value, TestOptionsPtr options, size_t offset)
+{
+	if (*value < '0' || *value > '9')
+	{
+		return -1;
+	}
+
+	char *end = NULL;
+	errno = 0;
+	unsigned long long number = strtoull(value, &end, 10);
+	if (errno != 0 || end == value || *end != '\0')
+	{
+		return -1;
+	}
+	*TEST_OPTION_FIELD(options, offset, unsigned long long) = number;
+
+	return 0;
+}
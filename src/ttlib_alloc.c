@@ -0,0 +1,702 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <link.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 할당 기록 테이블의 처음 크기(2 의 거듭제곱)
+#define TEST_ALLOCATION_TABLE_SIZE 1024
+
+// 할당 기록 테이블에서 주소의 위치를 찾기 위한 곱셈 해시 상수(2^64 / 황금비)
+#define TEST_ALLOCATION_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+
+// 누수된 블록을 할당한 코드의 위치를 찾기 위한 구조체(dl_iterate_phdr 콜백에서 사용)
+typedef struct _test_allocation_site_t
+{
+	// 찾을 주소(malloc 을 호출한 코드의 주소)
+	uintptr_t address;
+	// 주소가 속한 실행 파일 또는 공유 라이브러리 경로
+	const char *objectName;
+	// 실행 파일 또는 공유 라이브러리의 시작 주소로부터의 거리(addr2line 에 사용)
+	uintptr_t offset;
+} TestAllocationSite, *TestAllocationSitePtr;
+
+#ifndef TTLIB_NO_ALLOCATION_HOOKS
+// glibc 의 실제 메모리 할당 함수(아래에서 정의하는 malloc, calloc, realloc, memalign 등과 free 가 호출한다)
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *block, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void *__libc_valloc(size_t size);
+extern void __libc_free(void *block);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TTLIB_NO_ALLOCATION_HOOKS
+static inline TestAllocationTrackerPtr GetActiveAllocationTracker(void);
+static TestAllocationEntryPtr MapAllocationTable(size_t capacity);
+static size_t HashAllocation(const void *address, size_t capacity);
+static int GrowAllocationTable(TestAllocationTrackerPtr tracker);
+static void RecordAllocation(TestAllocationTrackerPtr tracker, void *block, size_t size, void *caller);
+static int RemoveAllocation(TestAllocationTrackerPtr tracker, void *block);
+#endif
+static int FindAllocationSite(struct dl_phdr_info *info, size_t size, void *data);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn long long GetTestAllocationCount(void)
+ * @brief 현재 스레드에서 실행 중인 테스트가 지금까지 메모리를 할당한 횟수를 반환하는 함수(EXPECT_MAX_ALLOCS, EXPECT_NO_ALLOC 매크로 함수에서 사용)
+ * @return 할당 횟수(malloc, calloc, realloc, memalign 계열 함수 호출 횟수), 할당을 추적하지 않으면 0 반환
+ */
+long long GetTestAllocationCount(void)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || context->allocationTracker == NULL)
+	{
+		return 0;
+	}
+
+	return context->allocationTracker->result.allocations;
+}
+
+#ifndef TTLIB_NO_ALLOCATION_HOOKS
+/**
+ * @fn void *malloc(size_t size)
+ * @brief glibc 의 malloc 을 대신하여 메모리를 할당하고, 테스트 실행 중이면 할당을 기록하는 함수
+ * 라이브러리를 정적으로 링크한 실행 파일에 정의되므로 LD_PRELOAD 없이 glibc 내부(strdup, fopen 등)의 할당까지 대신한다.
+ * 아래의 할당 함수들은 모두 HoldTestWatchdog 로 감싸므로 제한 시간 중단은 glibc 의 arena 잠금을 풀고 할당 기록을 마친 뒤에 일어난다.
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 할당한 메모리 주소, 실패 시 NULL 반환
+ */
+void *malloc(size_t size)
+{
+	// A timed out test must not leave glibc's arena lock held for the next test
+	HoldTestWatchdog();
+	void *block = __libc_malloc(size);
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (block != NULL && tracker != NULL)
+	{
+		RecordAllocation(tracker, block, size, __builtin_return_address(0));
+	}
+	ReleaseTestWatchdog();
+
+	return block;
+}
+
+/**
+ * @fn void *calloc(size_t count, size_t size)
+ * @brief glibc 의 calloc 을 대신하여 0 으로 초기화된 메모리를 할당하고, 테스트 실행 중이면 할당을 기록하는 함수
+ * @param count 항목 개수(입력)
+ * @param size 항목 하나의 크기(입력)
+ * @return 성공 시 할당한 메모리 주소, 실패 시 NULL 반환
+ */
+void *calloc(size_t count, size_t size)
+{
+	HoldTestWatchdog();
+	void *block = __libc_calloc(count, size);
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (block != NULL && tracker != NULL)
+	{
+		RecordAllocation(tracker, block, count * size, __builtin_return_address(0));
+	}
+	ReleaseTestWatchdog();
+
+	return block;
+}
+
+/**
+ * @fn void *realloc(void *block, size_t size)
+ * @brief glibc 의 realloc 을 대신하여 메모리 크기를 바꾸고, 테스트 실행 중이면 해제와 새 할당으로 기록하는 함수
+ * 테스트가 시작되기 전에 할당된 메모리는 크기를 바꾼 뒤에도 기록하지 않는다.
+ * @param block 크기를 바꿀 메모리 주소(NULL 이면 malloc 과 같다, 입력)
+ * @param size 새 크기(입력)
+ * @return 성공 시 새 메모리 주소, 실패 시 NULL 반환
+ */
+void *realloc(void *block, size_t size)
+{
+	HoldTestWatchdog();
+	void *newBlock = __libc_realloc(block, size);
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (tracker == NULL)
+	{
+		ReleaseTestWatchdog();
+		return newBlock;
+	}
+
+	if (block == NULL)
+	{
+		if (newBlock != NULL)
+		{
+			RecordAllocation(tracker, newBlock, size, __builtin_return_address(0));
+		}
+	}
+	else if (newBlock != NULL)
+	{
+		if (RemoveAllocation(tracker, block) == TRUE)
+		{
+			RecordAllocation(tracker, newBlock, size, __builtin_return_address(0));
+		}
+	}
+	else if (size == 0)
+	{
+		// glibc frees the block when realloc shrinks it to zero bytes
+		RemoveAllocation(tracker, block);
+	}
+	ReleaseTestWatchdog();
+
+	return newBlock;
+}
+
+/**
+ * @fn void *reallocarray(void *block, size_t count, size_t size)
+ * @brief glibc 의 reallocarray 를 대신하는 함수(glibc 의 구현은 내부 realloc 을 직접 호출하므로 기록이 어긋나지 않도록 함께 정의한다)
+ * @param block 크기를 바꿀 메모리 주소(입력)
+ * @param count 항목 개수(입력)
+ * @param size 항목 하나의 크기(입력)
+ * @return 성공 시 새 메모리 주소, 실패 시 NULL 반환
+ */
+void *reallocarray(void *block, size_t count, size_t size)
+{
+	size_t totalSize = 0;
+	if (__builtin_mul_overflow(count, size, &totalSize))
+	{
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	return realloc(block, totalSize);
+}
+
+/**
+ * @fn void *memalign(size_t alignment, size_t size)
+ * @brief glibc 의 memalign 을 대신하여 정렬된 메모리를 할당하고, 테스트 실행 중이면 할당을 기록하는 함수
+ * @param alignment 정렬 단위(2 의 거듭제곱, 입력)
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 할당한 메모리 주소, 실패 시 NULL 반환
+ */
+void *memalign(size_t alignment, size_t size)
+{
+	HoldTestWatchdog();
+	void *block = __libc_memalign(alignment, size);
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (block != NULL && tracker != NULL)
+	{
+		RecordAllocation(tracker, block, size, __builtin_return_address(0));
+	}
+	ReleaseTestWatchdog();
+
+	return block;
+}
+
+/**
+ * @fn void *aligned_alloc(size_t alignment, size_t size)
+ * @brief glibc 의 aligned_alloc 을 대신하여 정렬된 메모리를 할당하고, 테스트 실행 중이면 할당을 기록하는 함수
+ * @param alignment 정렬 단위(2 의 거듭제곱, 입력)
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 할당한 메모리 주소, 실패 시 NULL 반환(정렬 단위가 2 의 거듭제곱이 아니면 errno 를 EINVAL 로 설정)
+ */
+void *aligned_alloc(size_t alignment, size_t size)
+{
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		errno = EINVAL;
+		return NULL;
+	}
+
+	HoldTestWatchdog();
+	void *block = __libc_memalign(alignment, size);
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (block != NULL && tracker != NULL)
+	{
+		RecordAllocation(tracker, block, size, __builtin_return_address(0));
+	}
+	ReleaseTestWatchdog();
+
+	return block;
+}
+
+/**
+ * @fn int posix_memalign(void **blockPtr, size_t alignment, size_t size)
+ * @brief glibc 의 posix_memalign 을 대신하여 정렬된 메모리를 할당하고, 테스트 실행 중이면 할당을 기록하는 함수
+ * @param blockPtr 할당한 메모리 주소를 저장할 변수(출력)
+ * @param alignment 정렬 단위(sizeof(void*) 의 배수인 2 의 거듭제곱, 입력)
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 0, 정렬 단위가 잘못되었으면 EINVAL, 메모리가 부족하면 ENOMEM 반환(errno 는 바꾸지 않는다)
+ */
+int posix_memalign(void **blockPtr, size_t alignment, size_t size)
+{
+	if (alignment % sizeof(void*) != 0 || alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		return EINVAL;
+	}
+
+	HoldTestWatchdog();
+	int savedErrno = errno;
+	void *block = __libc_memalign(alignment, size);
+	errno = savedErrno;
+	if (block == NULL)
+	{
+		ReleaseTestWatchdog();
+		return ENOMEM;
+	}
+
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (tracker != NULL)
+	{
+		RecordAllocation(tracker, block, size, __builtin_return_address(0));
+	}
+	*blockPtr = block;
+	ReleaseTestWatchdog();
+
+	return 0;
+}
+
+/**
+ * @fn void *valloc(size_t size)
+ * @brief glibc 의 valloc 을 대신하여 페이지 단위로 정렬된 메모리를 할당하고, 테스트 실행 중이면 할당을 기록하는 함수
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 할당한 메모리 주소, 실패 시 NULL 반환
+ */
+void *valloc(size_t size)
+{
+	HoldTestWatchdog();
+	void *block = __libc_valloc(size);
+	TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+	if (block != NULL && tracker != NULL)
+	{
+		RecordAllocation(tracker, block, size, __builtin_return_address(0));
+	}
+	ReleaseTestWatchdog();
+
+	return block;
+}
+
+/**
+ * @fn void free(void *block)
+ * @brief glibc 의 free 를 대신하여 메모리를 해제하고, 현재 테스트가 할당한 메모리면 기록에서 지우는 함수
+ * @param block 해제할 메모리 주소(입력)
+ * @return 반환값 없음
+ */
+void free(void *block)
+{
+	HoldTestWatchdog();
+	if (block != NULL)
+	{
+		TestAllocationTrackerPtr tracker = GetActiveAllocationTracker();
+		if (tracker != NULL)
+		{
+			RemoveAllocation(tracker, block);
+		}
+	}
+
+	__libc_free(block);
+	ReleaseTestWatchdog();
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestAllocationTrackerPtr GetTestAllocationTracker(TestContextPtr context)
+ * @brief TestContext 객체의 메모리 할당 기록을 반환하는 함수(처음 호출될 때 생성한다)
+ * 할당 기록 테이블은 malloc 대신 mmap 으로 만들어 할당을 기록하는 도중에 다시 기록 함수가 호출되지 않게 한다.
+ * @param context 테스트를 실행할 TestContext 객체(입력, 출력)
+ * @return 성공 시 메모리 할당 기록, 실패하거나 할당 함수를 대신하지 않도록 빌드되었으면 NULL 반환
+ */
+TestAllocationTrackerPtr GetTestAllocationTracker(TestContextPtr context)
+{
+#ifdef TTLIB_NO_ALLOCATION_HOOKS
+	(void)context;
+	return NULL;
+#else
+	if (context->allocationTracker != NULL)
+	{
+		return context->allocationTracker;
+	}
+
+	TestAllocationTrackerPtr tracker = (TestAllocationTrackerPtr)calloc(1, sizeof(TestAllocationTracker));
+	if (tracker == NULL)
+	{
+		return NULL;
+	}
+
+	tracker->entries = MapAllocationTable(TEST_ALLOCATION_TABLE_SIZE);
+	if (tracker->entries == NULL)
+	{
+		free(tracker);
+		return NULL;
+	}
+	tracker->capacity = TEST_ALLOCATION_TABLE_SIZE;
+
+	context->allocationTracker = tracker;
+
+	return tracker;
+#endif
+}
+
+/**
+ * @fn void StartTestAllocations(TestAllocationTrackerPtr tracker)
+ * @brief 이전 테스트의 기록을 지우고 현재 스레드의 메모리 할당 기록을 시작하는 함수
+ * @param tracker 메모리 할당 기록(입력, 출력)
+ * @return 반환값 없음
+ */
+void StartTestAllocations(TestAllocationTrackerPtr tracker)
+{
+	// Blocks leaked by the previous test stay in the table until now
+	if (tracker->count > 0)
+	{
+		memset(tracker->entries, 0, sizeof(TestAllocationEntry) * tracker->capacity);
+		tracker->count = 0;
+	}
+	memset(&tracker->result, 0, sizeof(tracker->result));
+	tracker->liveBytes = 0;
+	tracker->sequence = 0;
+	tracker->paused = 0;
+	tracker->overflowed = FALSE;
+	tracker->active = TRUE;
+}
+
+/**
+ * @fn void StopTestAllocations(TestAllocationTrackerPtr tracker, TestAllocationResultPtr result)
+ * @brief 메모리 할당 기록을 멈추고 해제되지 않은 블록을 포함한 결과를 저장하는 함수
+ * 기록 테이블을 늘리지 못해 빠진 블록이 있으면 누수를 판단할 수 없으므로 tracked 를 FALSE 로 저장한다.
+ * @param tracker 메모리 할당 기록(입력, 출력)
+ * @param result 기록 결과를 저장할 구조체(출력)
+ * @return 반환값 없음
+ */
+void StopTestAllocations(TestAllocationTrackerPtr tracker, TestAllocationResultPtr result)
+{
+	tracker->active = FALSE;
+
+	*result = tracker->result;
+	result->leakedBlocks = (long long)tracker->count;
+	result->leakedBytes = tracker->liveBytes;
+	result->tracked = (tracker->overflowed == FALSE) ? TRUE : FALSE;
+}
+
+/**
+ * @fn void PauseTestAllocations(void)
+ * @brief 현재 스레드의 메모리 할당 기록을 ResumeTestAllocations 호출 전까지 멈추는 함수
+ * 실패 정보 기록 등 라이브러리 내부의 할당이 테스트의 할당 횟수나 누수로 집계되지 않도록 라이브러리 내부 작업을 감싸는 데 사용한다.
+ * @return 반환값 없음
+ */
+void PauseTestAllocations(void)
+{
+	TestContextPtr context = _testContext;
+	if (context != NULL && context->allocationTracker != NULL)
+	{
+		context->allocationTracker->paused++;
+	}
+}
+
+/**
+ * @fn void ResumeTestAllocations(void)
+ * @brief PauseTestAllocations 로 멈춘 메모리 할당 기록을 다시 시작하는 함수
+ * @return 반환값 없음
+ */
+void ResumeTestAllocations(void)
+{
+	TestContextPtr context = _testContext;
+	if (context != NULL && context->allocationTracker != NULL && context->allocationTracker->paused > 0)
+	{
+		context->allocationTracker->paused--;
+	}
+}
+
+/**
+ * @fn void ReportTestLeaks(TestSuitPtr testSuit, int testIndex, TestAllocationTrackerPtr tracker)
+ * @brief 현재 테스트에서 해제되지 않은 블록을 테스트를 정의한 소스 파일의 LEAK_CHECK 실패로 리포터에 전달하는 함수
+ * 가장 먼저 할당된 누수 블록을 할당한 코드의 위치를 실행 파일(또는 공유 라이브러리) 경로와 시작 주소로부터의 거리로 출력한다
+ * (addr2line -e 경로 거리 로 소스 위치를 찾을 수 있다).
+ * @param testSuit 테스트를 실행 중인 TestSuit 객체(입력)
+ * @param testIndex 실행 중인 테스트 번호(입력)
+ * @param tracker 기록을 멈춘 메모리 할당 기록(입력)
+ * @return 반환값 없음
+ */
+void ReportTestLeaks(TestSuitPtr testSuit, int testIndex, TestAllocationTrackerPtr tracker)
+{
+	TestAllocationEntryPtr first = NULL;
+	size_t entryIndex = 0;
+	for (; entryIndex < tracker->capacity; entryIndex++)
+	{
+		TestAllocationEntryPtr entry = &tracker->entries[entryIndex];
+		if (entry->address != NULL && (first == NULL || entry->sequence < first->sequence))
+		{
+			first = entry;
+		}
+	}
+	if (first == NULL)
+	{
+		return;
+	}
+
+	TestAllocationSite site;
+	site.address = (uintptr_t)first->caller;
+	site.objectName = NULL;
+	site.offset = site.address;
+	dl_iterate_phdr(FindAllocationSite, &site);
+	if (site.objectName == NULL || *site.objectName == '\0')
+	{
+		// The main executable has an empty name in the program header list
+		site.objectName = program_invocation_name;
+	}
+
+	ReportTestFailure("LEAK_CHECK", testSuit->testPtrContainer[testIndex]->fileName, 0, "메모리 누수 (blocks:%zu, bytes:%lld, first:%zu bytes allocated at %s+0x%lx)", tracker->count, tracker->liveBytes, first->size, site.objectName, (unsigned long)site.offset);
+}
+
+/**
+ * @fn void DeleteTestAllocationTracker(TestContextPtr context)
+ * @brief TestContext 객체의 메모리 할당 기록을 삭제하는 함수
+ * @param context TestContext 객체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestAllocationTracker(TestContextPtr context)
+{
+	TestAllocationTrackerPtr tracker = context->allocationTracker;
+	if (tracker == NULL)
+	{
+		return;
+	}
+
+	context->allocationTracker = NULL;
+	DeleteTestHeapProfile(tracker);
+	munmap(tracker->entries, sizeof(TestAllocationEntry) * tracker->capacity);
+	free(tracker);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TTLIB_NO_ALLOCATION_HOOKS
+/**
+ * @fn static inline TestAllocationTrackerPtr GetActiveAllocationTracker(void)
+ * @brief 현재 스레드에서 할당을 기록 중인 메모리 할당 기록을 반환하는 함수(모든 할당 함수에서 호출되므로 검사만 수행한다)
+ * 다른 스레드에서 해제한 블록이나 테스트가 만든 스레드의 할당은 기록되지 않는다.
+ * @return 기록 중이면 메모리 할당 기록, 아니면 NULL 반환
+ */
+static inline TestAllocationTrackerPtr GetActiveAllocationTracker(void)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL)
+	{
+		return NULL;
+	}
+
+	TestAllocationTrackerPtr tracker = context->allocationTracker;
+	if (tracker == NULL || tracker->active == FALSE || tracker->paused > 0)
+	{
+		return NULL;
+	}
+
+	return tracker;
+}
+
+/**
+ * @fn static TestAllocationEntryPtr MapAllocationTable(size_t capacity)
+ * @brief 0 으로 초기화된 할당 기록 테이블을 mmap 으로 생성하는 함수
+ * @param capacity 테이블 크기(입력)
+ * @return 성공 시 테이블 주소, 실패 시 NULL 반환
+ */
+static TestAllocationEntryPtr MapAllocationTable(size_t capacity)
+{
+	void *entries = mmap(NULL, sizeof(TestAllocationEntry) * capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (entries != MAP_FAILED) ? (TestAllocationEntryPtr)entries : NULL;
+}
+
+/**
+ * @fn static size_t HashAllocation(const void *address, size_t capacity)
+ * @brief 메모리 주소가 저장될 할당 기록 테이블의 위치를 계산하는 함수
+ * @param address 메모리 주소(입력)
+ * @param capacity 테이블 크기(2 의 거듭제곱, 입력)
+ * @return 테이블 위치 반환
+ */
+static size_t HashAllocation(const void *address, size_t capacity)
+{
+	// malloc returns 16-byte aligned blocks, so the low bits carry no information
+	unsigned long long key = (unsigned long long)(uintptr_t)address >> 4;
+
+	return (size_t)((key * TEST_ALLOCATION_HASH_MULTIPLIER) >> 32) & (capacity - 1);
+}
+
+/**
+ * @fn static int GrowAllocationTable(TestAllocationTrackerPtr tracker)
+ * @brief 할당 기록 테이블을 두 배로 늘리고 기록된 블록들을 옮기는 함수
+ * @param tracker 메모리 할당 기록(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int GrowAllocationTable(TestAllocationTrackerPtr tracker)
+{
+	size_t capacity = tracker->capacity * 2;
+	TestAllocationEntryPtr entries = MapAllocationTable(capacity);
+	if (entries == NULL)
+	{
+		return -1;
+	}
+
+	size_t entryIndex = 0;
+	for (; entryIndex < tracker->capacity; entryIndex++)
+	{
+		TestAllocationEntryPtr entry = &tracker->entries[entryIndex];
+		if (entry->address == NULL)
+		{
+			continue;
+		}
+
+		size_t position = HashAllocation(entry->address, capacity);
+		while (entries[position].address != NULL)
+		{
+			position = (position + 1) & (capacity - 1);
+		}
+		entries[position] = *entry;
+	}
+
+	munmap(tracker->entries, sizeof(TestAllocationEntry) * tracker->capacity);
+	tracker->entries = entries;
+	tracker->capacity = capacity;
+
+	return 0;
+}
+
+/**
+ * @fn static void RecordAllocation(TestAllocationTrackerPtr tracker, void *block, size_t size, void *caller)
+ * @brief 새로 할당된 블록을 집계하고 할당 기록 테이블에 추가하는 함수(힙 프로파일의 표본 지점을 지났으면 호출 경로도 기록한다)
+ * @param tracker 메모리 할당 기록(입력, 출력)
+ * @param block 할당된 메모리 주소(입력)
+ * @param size 요청한 크기(입력)
+ * @param caller 할당 함수를 호출한 코드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void RecordAllocation(TestAllocationTrackerPtr tracker, void *block, size_t size, void *caller)
+{
+	tracker->result.allocations++;
+	tracker->result.bytes += (long long)size;
+
+	TestHeapProfilePtr heapProfile = tracker->heapProfile;
+	if (heapProfile != NULL)
+	{
+		heapProfile->bytesUntilSample -= (long long)size;
+		if (heapProfile->bytesUntilSample <= 0)
+		{
+			SampleTestHeapProfile(heapProfile, size, caller);
+		}
+	}
+
+	// Keep the load factor at or below one half so that probe chains stay short
+	if ((tracker->count + 1) * 2 > tracker->capacity && GrowAllocationTable(tracker) != 0)
+	{
+		tracker->overflowed = TRUE;
+		return;
+	}
+
+	size_t position = HashAllocation(block, tracker->capacity);
+	while (tracker->entries[position].address != NULL)
+	{
+		position = (position + 1) & (tracker->capacity - 1);
+	}
+
+	TestAllocationEntryPtr entry = &tracker->entries[position];
+	entry->address = block;
+	entry->size = size;
+	entry->caller = caller;
+	entry->sequence = tracker->sequence++;
+	tracker->count++;
+
+	tracker->liveBytes += (long long)size;
+	if (tracker->liveBytes > tracker->result.peakBytes)
+	{
+		tracker->result.peakBytes = tracker->liveBytes;
+	}
+}
+
+/**
+ * @fn static int RemoveAllocation(TestAllocationTrackerPtr tracker, void *block)
+ * @brief 해제된 블록을 할당 기록 테이블에서 지우는 함수(기록되지 않은 블록은 무시한다)
+ * 선형 탐사 테이블이므로 지운 자리 뒤의 블록들을 앞으로 당겨 탐사가 끊기지 않게 한다.
+ * @param tracker 메모리 할당 기록(입력, 출력)
+ * @param block 해제된 메모리 주소(입력)
+ * @return 기록된 블록이면 TRUE, 아니면 FALSE 반환
+ */
+static int RemoveAllocation(TestAllocationTrackerPtr tracker, void *block)
+{
+	size_t mask = tracker->capacity - 1;
+	size_t position = HashAllocation(block, tracker->capacity);
+	while (tracker->entries[position].address != block)
+	{
+		if (tracker->entries[position].address == NULL)
+		{
+			return FALSE;
+		}
+		position = (position + 1) & mask;
+	}
+
+	tracker->result.frees++;
+	tracker->liveBytes -= (long long)tracker->entries[position].size;
+	tracker->count--;
+
+	size_t nextPosition = position;
+	for (;;)
+	{
+		nextPosition = (nextPosition + 1) & mask;
+		TestAllocationEntryPtr next = &tracker->entries[nextPosition];
+		if (next->address == NULL)
+		{
+			break;
+		}
+
+		// Move the entry back only when its home slot is not between the hole and its current slot
+		size_t home = HashAllocation(next->address, tracker->capacity);
+		if (((nextPosition - home) & mask) >= ((nextPosition - position) & mask))
+		{
+			tracker->entries[position] = *next;
+			position = nextPosition;
+		}
+	}
+	memset(&tracker->entries[position], 0, sizeof(TestAllocationEntry));
+
+	return TRUE;
+}
+#endif
+
+/**
+ * @fn static int FindAllocationSite(struct dl_phdr_info *info, size_t size, void *data)
+ * @brief (dl_iterate_phdr 콜백) 주소가 속한 실행 파일 또는 공유 라이브러리를 찾는 함수
+ * @param info 실행 파일 또는 공유 라이브러리 정보(입력)
+ * @param size info 구조체 크기(입력)
+ * @param data 찾을 주소와 결과를 저장할 TestAllocationSite 구조체(입력, 출력)
+ * @return 찾았으면 1(순회 중단), 못 찾았으면 0 반환
+ */
+static int FindAllocationSite(struct dl_phdr_info *info, size_t size, void *data)
+{
+	(void)size;
+	TestAllocationSitePtr site = (TestAllocationSitePtr)data;
+
+	int headerIndex = 0;
+	for (; headerIndex < info->dlpi_phnum; headerIndex++)
+	{
+		const ElfW(Phdr) *header = &info->dlpi_phdr[headerIndex];
+		uintptr_t begin = (uintptr_t)info->dlpi_addr + (uintptr_t)header->p_vaddr;
+		if (header->p_type == PT_LOAD && site->address >= begin && site->address < begin + (uintptr_t)header->p_memsz)
+		{
+			site->objectName = info->dlpi_name;
+			site->offset = site->address - (uintptr_t)info->dlpi_addr;
+			return 1;
+		}
+	}
+
+	return 0;
+}
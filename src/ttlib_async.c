@@ -0,0 +1,1068 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// epoll_wait 한 번에 받는 최대 이벤트 개수
+#define TEST_ASYNC_EVENTS 64
+
+// 동시에 진행 중인 ASYNC_TEST 하나의 자리(TestContext 객체가 첫 번째 멤버이므로 항목에 기록된 TestContext 객체로 자리를 찾는다)
+typedef struct _test_async_slot_t
+{
+	// 테스트를 실행하는 TestContext 객체(자리마다 재사용)
+	TestContext context;
+	// 진행 중인 테스트 번호(비어 있으면 -1)
+	int testIndex;
+	// 진행 중인 테스트의 구간 안 실행 순서(TestAsyncRunner.selectedTests 의 위치)
+	int position;
+	// 공유 픽스처 준비 결과(0 이 아니면 시작 코드와 TEARDOWN 을 실행하지 않는다)
+	int fixtureReady;
+	// 적용된 제한 시간(밀리초, 0 이면 제한 없음)
+	int timeoutMilliseconds;
+	// 시작 시각(나노초)
+	long long beginTime;
+	// 제한 시각(나노초, 0 이면 제한 없음)
+	long long deadline;
+	// 시작 코드, 콜백 함수, 픽스처를 실행한 CPU 시간의 합(나노초)
+	long long cpuNanoseconds;
+	// 시작 코드, 콜백 함수, 픽스처를 실행하는 동안 증가한 CPU 타임스탬프 카운터 값의 합
+	unsigned long long cycles;
+} TestAsyncSlot, *TestAsyncSlotPtr;
+
+// 끝난 ASYNC_TEST 하나의 결과(앞선 실행 순서의 테스트가 진행 중이면 리포터에 전달하지 않고 보관한다)
+typedef struct _test_async_result_t
+{
+	// 테스트가 끝났는지 여부
+	int finished;
+	// 리포터에 전달했는지 여부
+	int replayed;
+	// 보관한 실패 정보 기록(malloc 으로 복사, 없으면 NULL)
+	char *failureLog;
+	// 보관한 실패 정보 길이
+	size_t failureLogLength;
+} TestAsyncResult, *TestAsyncResultPtr;
+
+// 선택된 ASYNC_TEST 들을 하나의 이벤트 루프에서 함께 진행하는 실행 상태
+typedef struct _test_async_runner_t
+{
+	// 전체 테스트 관리 구조체
+	TestSuitPtr testSuit;
+	// 함께 진행할 구간의 실행 순서 리스트(selectedTests 의 구간 시작 위치)
+	const int *selectedTests;
+	// 함께 사용하는 이벤트 루프
+	TestEventLoopPtr loop;
+	// 테스트 자리 리스트
+	TestAsyncSlotPtr slots;
+	// 테스트 자리 개수(동시에 진행할 최대 테스트 개수)
+	int numberOfSlots;
+	// 실행 순서별 테스트 결과(ASYNC_TEST 개수만큼)
+	TestAsyncResultPtr results;
+	// ASYNC_TEST 개수
+	int numberOfTests;
+	// 다음으로 리포터에 전달할 실행 순서
+	int replayPosition;
+	// 진행 중인 테스트 개수
+	int numberOfRunningTests;
+	// ASSERT 실패로 종료가 요청된 가장 앞선 실행 순서(요청이 없으면 ASYNC_TEST 개수)
+	int exitPosition;
+} TestAsyncRunner, *TestAsyncRunnerPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static TestEventLoopPtr GetAsyncTestLoop(TestContextPtr context);
+static TestEventLoopPtr NewEventLoop(int shared);
+static void DeleteEventLoop(TestEventLoopPtr loop);
+static int AddAsyncWatch(TestContextPtr context, int fd, int isTimer, unsigned int epollEvents, TestAsyncFunc callback, void *data);
+static TestAsyncWatchPtr FindAsyncWatch(TestEventLoopPtr loop, int fd);
+static void RemoveAsyncWatch(TestEventLoopPtr loop, TestAsyncWatchPtr watch);
+static void RemoveAsyncWatches(TestEventLoopPtr loop, TestContextPtr context);
+static void SweepAsyncWatches(TestEventLoopPtr loop);
+static void DispatchAsyncWatch(TestEventLoopPtr loop, TestAsyncWatchPtr watch, unsigned int epollEvents);
+static int IsAsyncTestFinished(TestContextPtr context);
+static void FailAsyncTest(const char *message, int error);
+static void StartAsyncTest(TestAsyncRunnerPtr runner, TestAsyncSlotPtr slot, int position);
+static void FinishAsyncTestSlot(TestAsyncRunnerPtr runner, TestAsyncSlotPtr slot, int timedOut);
+static void ReplayFinishedAsyncTests(TestAsyncRunnerPtr runner);
+static int GetAsyncWaitTimeout(TestAsyncRunnerPtr runner);
+static unsigned int ToEpollEvents(int events);
+static int FromEpollEvents(unsigned int epollEvents);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void RunAsyncTest(TestAsyncStartFunc start)
+ * @brief 비동기 테스트를 실행하는 함수(ASYNC_TEST 매크로 함수에서 호출)
+ * RunAsyncTests 가 여러 테스트를 함께 진행하는 중이면 시작 코드만 실행하고 돌아가며, 등록된 이벤트는 RunAsyncTests 가 처리한다.
+ * 그 밖에는(작업자 프로세스, --async-limit=1 등) TestContext 객체의 이벤트 루프에서 이 테스트가 끝날 때까지 이벤트를 처리한다.
+ * 제한 시간은 이 경우 다른 테스트와 같이 제한 시간 감시 타이머나 부모 프로세스가 감시한다.
+ * @param start 파일 디스크립터와 타이머를 등록하는 시작 코드(입력)
+ * @return 반환값 없음
+ */
+void RunAsyncTest(TestAsyncStartFunc start)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || start == NULL)
+	{
+		return;
+	}
+
+	context->asyncWatches = 0;
+	context->asyncDone = FALSE;
+
+	// The runner of concurrent tests dispatches the events of the shared loop itself
+	if (context->eventLoop != NULL && context->eventLoop->shared == TRUE)
+	{
+		start();
+		return;
+	}
+
+	HoldTestWatchdog();
+	PauseTestAllocations();
+	if (context->eventLoop == NULL)
+	{
+		context->eventLoop = NewEventLoop(FALSE);
+	}
+	int error = errno;
+	TestEventLoopPtr loop = context->eventLoop;
+	if (loop != NULL)
+	{
+		// A test stopped by its timeout may have left its watches behind
+		RemoveAsyncWatches(loop, NULL);
+		SweepAsyncWatches(loop);
+	}
+	ResumeTestAllocations();
+	ReleaseTestWatchdog();
+	if (loop == NULL)
+	{
+		FailAsyncTest("이벤트 루프 생성 실패", error);
+		return;
+	}
+
+	start();
+
+	struct epoll_event events[TEST_ASYNC_EVENTS];
+	while (IsAsyncTestFinished(context) == FALSE)
+	{
+		int numberOfEvents = epoll_wait(loop->epollFd, events, TEST_ASYNC_EVENTS, -1);
+		if (numberOfEvents < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			FailAsyncTest("이벤트 대기 실패", errno);
+			break;
+		}
+
+		int eventIndex = 0;
+		for (; eventIndex < numberOfEvents && IsAsyncTestFinished(context) == FALSE; eventIndex++)
+		{
+			DispatchAsyncWatch(loop, (TestAsyncWatchPtr)events[eventIndex].data.ptr, events[eventIndex].events);
+		}
+
+		HoldTestWatchdog();
+		PauseTestAllocations();
+		SweepAsyncWatches(loop);
+		ResumeTestAllocations();
+		ReleaseTestWatchdog();
+	}
+
+	// Watches left by ASYNC_DONE or a failed ASSERT are dropped
+	HoldTestWatchdog();
+	PauseTestAllocations();
+	RemoveAsyncWatches(loop, context);
+	SweepAsyncWatches(loop);
+	ResumeTestAllocations();
+	ReleaseTestWatchdog();
+}
+
+/**
+ * @fn int WatchAsyncTestFd(int fd, int events, TestAsyncFunc callback, void *data)
+ * @brief 현재 비동기 테스트의 이벤트 루프에 파일 디스크립터를 등록하는 함수(ASYNC_WATCH 매크로 함수에서 호출)
+ * 레벨 트리거로 등록하므로 준비된 동안에는 이벤트를 처리할 때마다 콜백 함수가 호출된다. 이미 등록한 fd 이면 이벤트와 콜백 함수를 바꾼다.
+ * @param fd 감시할 파일 디스크립터(입력, 보통 O_NONBLOCK 소켓)
+ * @param events 기다릴 이벤트(입력, TestAsyncRead, TestAsyncWrite 비트 조합)
+ * @param callback 준비되면 호출할 콜백 함수(입력)
+ * @param data 콜백 함수에 전달할 인자(입력)
+ * @return 성공 시 0, 실패 시 -1 반환(errno 설정, 비동기 테스트가 아니면 EINVAL)
+ */
+int WatchAsyncTestFd(int fd, int events, TestAsyncFunc callback, void *data)
+{
+	TestContextPtr context = _testContext;
+	if (GetAsyncTestLoop(context) == NULL || fd < 0 || callback == NULL)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+
+	return AddAsyncWatch(context, fd, FALSE, ToEpollEvents(events), callback, data);
+}
+
+/**
+ * @fn int StartAsyncTestTimer(int milliseconds, TestAsyncFunc callback, void *data)
+ * @brief 지정한 시간이 지나면 콜백 함수를 한 번 호출하는 타이머를 현재 비동기 테스트의 이벤트 루프에 등록하는 함수(ASYNC_TIMER 매크로 함수에서 호출)
+ * 타이머는 timerfd 로 만들며, 콜백 함수를 호출하기 전에 감시를 해제하고 닫는다.
+ * @param milliseconds 콜백 함수를 호출할 때까지의 시간(입력, 밀리초)
+ * @param callback 시간이 지나면 호출할 콜백 함수(입력, fd 는 -1, events 는 TestAsyncTimer 로 호출된다)
+ * @param data 콜백 함수에 전달할 인자(입력)
+ * @return 성공 시 타이머 번호(ASYNC_UNWATCH 로 취소), 실패 시 -1 반환(errno 설정)
+ */
+int StartAsyncTestTimer(int milliseconds, TestAsyncFunc callback, void *data)
+{
+	TestContextPtr context = _testContext;
+	if (GetAsyncTestLoop(context) == NULL || milliseconds < 0 || callback == NULL)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+
+	int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	struct itimerspec expiration;
+	memset(&expiration, 0, sizeof(expiration));
+	expiration.it_value.tv_sec = milliseconds / 1000;
+	expiration.it_value.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+	if (milliseconds == 0)
+	{
+		// A zero expiration disarms the timer, so expire right away instead
+		expiration.it_value.tv_nsec = 1;
+	}
+
+	if (timerfd_settime(fd, 0, &expiration, NULL) != 0 || AddAsyncWatch(context, fd, TRUE, EPOLLIN, callback, data) != 0)
+	{
+		int error = errno;
+		close(fd);
+		errno = error;
+		return -1;
+	}
+
+	return fd;
+}
+
+/**
+ * @fn void UnwatchAsyncTestFd(int fd)
+ * @brief 현재 비동기 테스트가 등록한 파일 디스크립터나 타이머의 감시를 해제하는 함수(ASYNC_UNWATCH 매크로 함수에서 호출)
+ * 파일 디스크립터는 닫지 않고, 타이머는 닫는다. 등록한 것이 하나도 남지 않으면 콜백 함수가 돌아간 뒤 테스트가 끝난다.
+ * @param fd 등록한 파일 디스크립터 또는 타이머 번호(입력)
+ * @return 반환값 없음
+ */
+void UnwatchAsyncTestFd(int fd)
+{
+	TestContextPtr context = _testContext;
+	TestEventLoopPtr loop = GetAsyncTestLoop(context);
+	if (loop == NULL)
+	{
+		return;
+	}
+
+	TestAsyncWatchPtr watch = FindAsyncWatch(loop, fd);
+	if (watch != NULL && watch->context == context)
+	{
+		RemoveAsyncWatch(loop, watch);
+	}
+}
+
+/**
+ * @fn void FinishAsyncTest(void)
+ * @brief 현재 비동기 테스트를 끝내는 함수(ASYNC_DONE 매크로 함수에서 호출, 콜백 함수가 돌아간 뒤 남은 감시를 해제하고 결과를 기록한다)
+ * @return 반환값 없음
+ */
+void FinishAsyncTest(void)
+{
+	TestContextPtr context = _testContext;
+	if (context != NULL)
+	{
+		context->asyncDone = TRUE;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int RunAsyncTests(TestSuitPtr testSuit, int start, int count, int asyncLimit)
+ * @brief 실행 순서의 한 구간에 연속된 ASYNC_TEST 들을 하나의 epoll 이벤트 루프에서 실행 순서대로 시작하여 최대 asyncLimit 개까지 동시에 진행하는 함수
+ * 테스트마다 자리의 TestContext 객체를 사용하고 콜백 함수를 호출할 때마다 _testContext 를 그 테스트의 객체로 바꾸므로,
+ * 검사 매크로 함수의 실패와 메모리 할당은 이벤트를 처리하는 순서와 관계없이 각 테스트에 기록된다.
+ * 끝난 테스트는 앞선 실행 순서의 테스트가 모두 끝나면 실패 정보와 함께 ReplayTestResult 함수로 실행 순서대로 리포터에 전달한다. 실행 시간은 시작부터 끝날 때까지의 시간이고,
+ * CPU 시간은 그 테스트의 시작 코드, 콜백 함수, 픽스처를 실행한 시간의 합이다(하드웨어 성능 카운터는 측정하지 않는다).
+ * 제한 시간은 이벤트 루프가 감시하여 넘긴 테스트를 TestTimeout 으로 기록하며, 중단되는 코드가 없으므로 TEARDOWN 은 실행한다.
+ * ASSERT 가 실패하면 새 테스트는 시작하지 않고 진행 중인 테스트가 끝나기를 기다리며, 순차 실행과 같이 그 뒤의 실행 순서인 테스트는
+ * 리포터에 전달하지 않고 TestNotRun 으로 기록한다(MergeTestReports 가 집계하는 테스트와 출력되는 테스트가 같다).
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param start 구간의 첫 실행 순서(selectedTests 의 위치, 입력)
+ * @param count 구간의 테스트 개수(모두 ASYNC_TEST, 입력)
+ * @param asyncLimit 동시에 진행할 최대 테스트 개수(입력)
+ * @return 실행된 것으로 집계된 테스트 개수, 이벤트 루프를 만들지 못하면 -1 반환(이때는 다른 테스트처럼 하나씩 실행해야 한다)
+ */
+int RunAsyncTests(TestSuitPtr testSuit, int start, int count, int asyncLimit)
+{
+	int numberOfAsyncTests = count;
+
+	TestAsyncRunner runner;
+	memset(&runner, 0, sizeof(runner));
+	runner.testSuit = testSuit;
+	runner.selectedTests = testSuit->selectedTests + start;
+	runner.numberOfSlots = (asyncLimit < numberOfAsyncTests) ? asyncLimit : numberOfAsyncTests;
+	runner.exitPosition = numberOfAsyncTests;
+	runner.numberOfTests = numberOfAsyncTests;
+	runner.loop = NewEventLoop(TRUE);
+	runner.slots = (TestAsyncSlotPtr)calloc((size_t)runner.numberOfSlots, sizeof(TestAsyncSlot));
+	runner.results = (TestAsyncResultPtr)calloc((size_t)numberOfAsyncTests, sizeof(TestAsyncResult));
+	if (runner.loop == NULL || runner.slots == NULL || runner.results == NULL)
+	{
+		puts("ASYNC_TEST 이벤트 루프 생성 실패");
+		DeleteEventLoop(runner.loop);
+		free(runner.slots);
+		free(runner.results);
+		return -1;
+	}
+
+	int slotIndex = 0;
+	for (; slotIndex < runner.numberOfSlots; slotIndex++)
+	{
+		TestAsyncSlotPtr slot = &runner.slots[slotIndex];
+		InitializeTestContext(&slot->context, testSuit, FALSE);
+		slot->context.useWatchdog = FALSE;
+		slot->context.eventLoop = runner.loop;
+		slot->testIndex = -1;
+	}
+
+	struct epoll_event events[TEST_ASYNC_EVENTS];
+	int nextPosition = 0;
+	while (TRUE)
+	{
+		// Fill the free slots in test order, unless an earlier test requested exit
+		for (slotIndex = 0; slotIndex < runner.numberOfSlots; slotIndex++)
+		{
+			TestAsyncSlotPtr slot = &runner.slots[slotIndex];
+			while (slot->testIndex < 0 && nextPosition < numberOfAsyncTests && nextPosition <= runner.exitPosition)
+			{
+				StartAsyncTest(&runner, slot, nextPosition++);
+			}
+		}
+		if (runner.numberOfRunningTests == 0)
+		{
+			break;
+		}
+
+		int numberOfEvents = epoll_wait(runner.loop->epollFd, events, TEST_ASYNC_EVENTS, GetAsyncWaitTimeout(&runner));
+		if (numberOfEvents < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			// Without events no running test can finish, so fail them all
+			int error = errno;
+			for (slotIndex = 0; slotIndex < runner.numberOfSlots; slotIndex++)
+			{
+				TestAsyncSlotPtr slot = &runner.slots[slotIndex];
+				if (slot->testIndex >= 0)
+				{
+					TestContextPtr previousContext = _testContext;
+					_testContext = &slot->context;
+					FailAsyncTest("이벤트 대기 실패", error);
+					_testContext = previousContext;
+					FinishAsyncTestSlot(&runner, slot, FALSE);
+				}
+			}
+			continue;
+		}
+
+		int eventIndex = 0;
+		for (; eventIndex < numberOfEvents; eventIndex++)
+		{
+			TestAsyncWatchPtr watch = (TestAsyncWatchPtr)events[eventIndex].data.ptr;
+			if (watch->active == FALSE)
+			{
+				continue;
+			}
+
+			TestAsyncSlotPtr slot = (TestAsyncSlotPtr)watch->context;
+			long long startCpuTime = GetThreadCpuTime();
+			unsigned long long startCycles = ReadCycleCounter();
+			DispatchAsyncWatch(runner.loop, watch, events[eventIndex].events);
+			slot->cpuNanoseconds += GetThreadCpuTime() - startCpuTime;
+			slot->cycles += ReadCycleCounter() - startCycles;
+
+			if (slot->testIndex >= 0 && IsAsyncTestFinished(&slot->context) == TRUE)
+			{
+				FinishAsyncTestSlot(&runner, slot, FALSE);
+			}
+		}
+		SweepAsyncWatches(runner.loop);
+
+		// Stop the tests which ran out of time
+		long long now = GetMonotonicTime();
+		for (slotIndex = 0; slotIndex < runner.numberOfSlots; slotIndex++)
+		{
+			TestAsyncSlotPtr slot = &runner.slots[slotIndex];
+			if (slot->testIndex >= 0 && slot->deadline > 0 && now >= slot->deadline)
+			{
+				FinishAsyncTestSlot(&runner, slot, TRUE);
+			}
+		}
+	}
+
+	// Tests after the one which requested exit are left out of the results, as in serial mode
+	int position = 0;
+	for (; position < numberOfAsyncTests; position++)
+	{
+		if (position > runner.exitPosition && runner.results[position].finished == TRUE)
+		{
+			testSuit->testReports[runner.selectedTests[position]].result = TestNotRun;
+		}
+		free(runner.results[position].failureLog);
+	}
+	free(runner.results);
+
+	for (slotIndex = 0; slotIndex < runner.numberOfSlots; slotIndex++)
+	{
+		ReleaseTestContext(&runner.slots[slotIndex].context);
+	}
+	free(runner.slots);
+	DeleteEventLoop(runner.loop);
+
+	// Count results in test order up to the test which requested exit
+	return MergeTestReports(testSuit, start, count);
+}
+
+/**
+ * @fn void DeleteTestEventLoop(TestContextPtr context)
+ * @brief TestContext 객체가 만든 이벤트 루프를 삭제하는 함수(RunAsyncTests 가 함께 사용하게 한 이벤트 루프는 삭제하지 않는다)
+ * @param context TestContext 객체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestEventLoop(TestContextPtr context)
+{
+	TestEventLoopPtr loop = context->eventLoop;
+	context->eventLoop = NULL;
+	if (loop != NULL && loop->shared == FALSE)
+	{
+		DeleteEventLoop(loop);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static TestEventLoopPtr GetAsyncTestLoop(TestContextPtr context)
+ * @brief TestContext 객체가 실행 중인 ASYNC_TEST 의 이벤트 루프를 반환하는 함수
+ * @param context 현재 스레드의 TestContext 객체(입력, NULL 가능)
+ * @return 비동기 테스트를 실행 중이면 이벤트 루프, 아니면 NULL 반환
+ */
+static TestEventLoopPtr GetAsyncTestLoop(TestContextPtr context)
+{
+	if (context == NULL || context->eventLoop == NULL || context->testIndex < 0)
+	{
+		return NULL;
+	}
+
+	return (context->testSuit->testPtrContainer[context->testIndex]->kind == TestKindAsync) ? context->eventLoop : NULL;
+}
+
+/**
+ * @fn static TestEventLoopPtr NewEventLoop(int shared)
+ * @brief epoll 이벤트 루프를 생성하는 함수
+ * @param shared 여러 테스트가 함께 사용하는지 여부(입력)
+ * @return 성공 시 이벤트 루프, 실패 시 NULL 반환
+ */
+static TestEventLoopPtr NewEventLoop(int shared)
+{
+	TestEventLoopPtr loop = (TestEventLoopPtr)calloc(1, sizeof(TestEventLoop));
+	if (loop == NULL)
+	{
+		return NULL;
+	}
+
+	loop->epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (loop->epollFd < 0)
+	{
+		free(loop);
+		return NULL;
+	}
+	loop->shared = shared;
+
+	return loop;
+}
+
+/**
+ * @fn static void DeleteEventLoop(TestEventLoopPtr loop)
+ * @brief 이벤트 루프와 남은 항목을 삭제하는 함수(남은 타이머는 닫고, 테스트의 파일 디스크립터는 닫지 않는다)
+ * @param loop 삭제할 이벤트 루프(입력, NULL 가능)
+ * @return 반환값 없음
+ */
+static void DeleteEventLoop(TestEventLoopPtr loop)
+{
+	if (loop == NULL)
+	{
+		return;
+	}
+
+	while (loop->watches != NULL)
+	{
+		TestAsyncWatchPtr watch = loop->watches;
+		loop->watches = watch->next;
+		if (watch->active == TRUE && watch->isTimer == TRUE)
+		{
+			close(watch->fd);
+		}
+		free(watch);
+	}
+
+	close(loop->epollFd);
+	free(loop);
+}
+
+/**
+ * @fn static int AddAsyncWatch(TestContextPtr context, int fd, int isTimer, unsigned int epollEvents, TestAsyncFunc callback, void *data)
+ * @brief 테스트의 이벤트 루프에 항목을 등록하거나, 이미 등록한 fd 이면 이벤트와 콜백 함수를 바꾸는 함수
+ * 항목은 라이브러리 내부 할당이므로 테스트의 할당 횟수나 누수로 집계하지 않는다.
+ * @param context 등록하는 테스트의 TestContext 객체(입력, 출력)
+ * @param fd 감시할 파일 디스크립터(입력)
+ * @param isTimer ASYNC_TIMER 로 만든 타이머인지 여부(입력)
+ * @param epollEvents 기다릴 epoll 이벤트(입력)
+ * @param callback 준비되면 호출할 콜백 함수(입력)
+ * @param data 콜백 함수에 전달할 인자(입력)
+ * @return 성공 시 0, 실패 시 -1 반환(errno 설정)
+ */
+static int AddAsyncWatch(TestContextPtr context, int fd, int isTimer, unsigned int epollEvents, TestAsyncFunc callback, void *data)
+{
+	TestEventLoopPtr loop = context->eventLoop;
+	int result = 0;
+	int error = 0;
+
+	HoldTestWatchdog();
+	PauseTestAllocations();
+
+	// A descriptor number can only be watched by another test if that test closed it without ASYNC_UNWATCH
+	TestAsyncWatchPtr watch = FindAsyncWatch(loop, fd);
+	if (watch != NULL && watch->context != context)
+	{
+		RemoveAsyncWatch(loop, watch);
+		watch = NULL;
+	}
+
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = epollEvents;
+
+	if (watch != NULL)
+	{
+		event.data.ptr = watch;
+		if (epoll_ctl(loop->epollFd, EPOLL_CTL_MOD, fd, &event) != 0)
+		{
+			error = errno;
+			result = -1;
+		}
+	}
+	else
+	{
+		watch = (TestAsyncWatchPtr)calloc(1, sizeof(TestAsyncWatch));
+		if (watch == NULL)
+		{
+			error = ENOMEM;
+			result = -1;
+		}
+		else
+		{
+			event.data.ptr = watch;
+			if (epoll_ctl(loop->epollFd, EPOLL_CTL_ADD, fd, &event) != 0 && (errno != EEXIST || epoll_ctl(loop->epollFd, EPOLL_CTL_MOD, fd, &event) != 0))
+			{
+				error = errno;
+				free(watch);
+				watch = NULL;
+				result = -1;
+			}
+			else
+			{
+				watch->fd = fd;
+				watch->isTimer = isTimer;
+				watch->active = TRUE;
+				watch->context = context;
+				watch->next = loop->watches;
+				loop->watches = watch;
+				context->asyncWatches++;
+			}
+		}
+	}
+
+	if (result == 0)
+	{
+		watch->callback = callback;
+		watch->data = data;
+	}
+
+	ResumeTestAllocations();
+	ReleaseTestWatchdog();
+
+	errno = error;
+	return result;
+}
+
+/**
+ * @fn static TestAsyncWatchPtr FindAsyncWatch(TestEventLoopPtr loop, int fd)
+ * @brief 이벤트 루프에 등록된 항목 중 지정한 파일 디스크립터의 항목을 찾는 함수
+ * @param loop 이벤트 루프(입력)
+ * @param fd 파일 디스크립터 또는 타이머 번호(입력)
+ * @return 찾으면 항목, 없으면 NULL 반환
+ */
+static TestAsyncWatchPtr FindAsyncWatch(TestEventLoopPtr loop, int fd)
+{
+	TestAsyncWatchPtr watch = loop->watches;
+	for (; watch != NULL; watch = watch->next)
+	{
+		if (watch->active == TRUE && watch->fd == fd)
+		{
+			return watch;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static void RemoveAsyncWatch(TestEventLoopPtr loop, TestAsyncWatchPtr watch)
+ * @brief 항목의 감시를 해제하는 함수(이미 받은 이벤트가 남아 있을 수 있으므로 항목은 SweepAsyncWatches 에서 삭제한다)
+ * @param loop 이벤트 루프(입력)
+ * @param watch 해제할 항목(입력, 출력)
+ * @return 반환값 없음
+ */
+static void RemoveAsyncWatch(TestEventLoopPtr loop, TestAsyncWatchPtr watch)
+{
+	if (watch->active == FALSE)
+	{
+		return;
+	}
+
+	// A descriptor closed by the test has already left the epoll set
+	epoll_ctl(loop->epollFd, EPOLL_CTL_DEL, watch->fd, NULL);
+	if (watch->isTimer == TRUE)
+	{
+		close(watch->fd);
+	}
+	watch->active = FALSE;
+	watch->context->asyncWatches--;
+}
+
+/**
+ * @fn static void RemoveAsyncWatches(TestEventLoopPtr loop, TestContextPtr context)
+ * @brief 테스트가 등록한 모든 항목의 감시를 해제하는 함수
+ * @param loop 이벤트 루프(입력)
+ * @param context 등록한 테스트의 TestContext 객체(입력, NULL 이면 모든 테스트)
+ * @return 반환값 없음
+ */
+static void RemoveAsyncWatches(TestEventLoopPtr loop, TestContextPtr context)
+{
+	TestAsyncWatchPtr watch = loop->watches;
+	for (; watch != NULL; watch = watch->next)
+	{
+		if (context == NULL || watch->context == context)
+		{
+			RemoveAsyncWatch(loop, watch);
+		}
+	}
+}
+
+/**
+ * @fn static void SweepAsyncWatches(TestEventLoopPtr loop)
+ * @brief 감시를 해제한 항목들을 삭제하는 함수(epoll_wait 으로 받은 이벤트를 모두 처리한 뒤 호출한다)
+ * @param loop 이벤트 루프(입력, 출력)
+ * @return 반환값 없음
+ */
+static void SweepAsyncWatches(TestEventLoopPtr loop)
+{
+	TestAsyncWatchPtr *link = &loop->watches;
+	while (*link != NULL)
+	{
+		TestAsyncWatchPtr watch = *link;
+		if (watch->active == TRUE)
+		{
+			link = &watch->next;
+			continue;
+		}
+
+		*link = watch->next;
+		free(watch);
+	}
+}
+
+/**
+ * @fn static void DispatchAsyncWatch(TestEventLoopPtr loop, TestAsyncWatchPtr watch, unsigned int epollEvents)
+ * @brief 받은 이벤트 하나로 항목의 콜백 함수를 등록한 테스트의 TestContext 객체에서 호출하는 함수(타이머는 먼저 감시를 해제한다)
+ * @param loop 이벤트 루프(입력)
+ * @param watch 이벤트를 받은 항목(입력, 출력)
+ * @param epollEvents 받은 epoll 이벤트(입력)
+ * @return 반환값 없음
+ */
+static void DispatchAsyncWatch(TestEventLoopPtr loop, TestAsyncWatchPtr watch, unsigned int epollEvents)
+{
+	if (watch->active == FALSE)
+	{
+		return;
+	}
+
+	int fd = watch->fd;
+	int events = FromEpollEvents(epollEvents);
+	if (watch->isTimer == TRUE)
+	{
+		// A timer fires once, so it is gone before its callback runs
+		unsigned long long expirations = 0;
+		if (read(watch->fd, &expirations, sizeof(expirations)) < 0 && errno == EAGAIN)
+		{
+			return;
+		}
+		RemoveAsyncWatch(loop, watch);
+		fd = -1;
+		events = TestAsyncTimer;
+	}
+
+	TestContextPtr previousContext = _testContext;
+	_testContext = watch->context;
+	watch->callback(fd, events, watch->data);
+	_testContext = previousContext;
+}
+
+/**
+ * @fn static int IsAsyncTestFinished(TestContextPtr context)
+ * @brief 비동기 테스트가 끝났는지 검사하는 함수(ASYNC_DONE 을 호출했거나, 등록한 것이 없거나, ASSERT 가 실패했으면 끝난 것으로 본다)
+ * @param context 테스트의 TestContext 객체(입력)
+ * @return 끝났으면 TRUE, 아니면 FALSE 반환
+ */
+static int IsAsyncTestFinished(TestContextPtr context)
+{
+	return (context->asyncDone == TRUE || context->asyncWatches <= 0 || context->onGoing == TestExit) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static void FailAsyncTest(const char *message, int error)
+ * @brief 이벤트 루프의 시스템 호출 실패를 현재 테스트의 실패로 기록하는 함수
+ * @param message 실패 메시지(입력)
+ * @param error 실패한 시스템 호출의 errno(입력)
+ * @return 반환값 없음
+ */
+static void FailAsyncTest(const char *message, int error)
+{
+	ReportTestFailure("ASYNC_TEST", program_invocation_name, 0, "%s (%s)", message, strerror(error));
+	_testContext->failCount++;
+}
+
+/**
+ * @fn static void StartAsyncTest(TestAsyncRunnerPtr runner, TestAsyncSlotPtr slot, int position)
+ * @brief 빈 자리에서 ASYNC_TEST 하나를 시작하는 함수(공유 픽스처 준비, 메모리 할당 기록 시작, SETUP, 시작 코드 실행)
+ * 시작 코드가 아무것도 등록하지 않았거나 준비에 실패하면 바로 끝낸다.
+ * @param runner 실행 상태(입력, 출력)
+ * @param slot 빈 자리(입력, 출력)
+ * @param position 시작할 테스트의 구간 안 실행 순서(입력)
+ * @return 반환값 없음
+ */
+static void StartAsyncTest(TestAsyncRunnerPtr runner, TestAsyncSlotPtr slot, int position)
+{
+	TestSuitPtr testSuit = runner->testSuit;
+	TestContextPtr context = &slot->context;
+	int testIndex = runner->selectedTests[position];
+
+	ResetTestContext(context, testIndex);
+	slot->testIndex = testIndex;
+	slot->position = position;
+	slot->timeoutMilliseconds = GetTestTimeout(testSuit, testIndex);
+	slot->cpuNanoseconds = 0;
+	slot->cycles = 0;
+	runner->numberOfRunningTests++;
+
+	TestAllocationTrackerPtr allocationTracker = GetTestAllocationTracker(context);
+	if (allocationTracker != NULL && testSuit->options.heapProfilePath != NULL)
+	{
+		GetTestHeapProfile(allocationTracker, testSuit->options.heapSampleBytes);
+	}
+
+	TestContextPtr previousContext = _testContext;
+	_testContext = context;
+
+	// The shared fixture is built outside the measurement of the first test using it
+	slot->fixtureReady = AcquireTestFixture(testSuit, testIndex);
+
+	long long startCpuTime = GetThreadCpuTime();
+	unsigned long long startCycles = ReadCycleCounter();
+	slot->beginTime = GetMonotonicTime();
+	slot->deadline = (slot->timeoutMilliseconds > 0) ? slot->beginTime + (long long)slot->timeoutMilliseconds * 1000000LL : 0;
+
+	if (allocationTracker != NULL)
+	{
+		StartTestAllocations(allocationTracker);
+		if (allocationTracker->heapProfile != NULL)
+		{
+			StartTestHeapProfile(allocationTracker->heapProfile, testIndex);
+		}
+	}
+
+	if (slot->fixtureReady == 0)
+	{
+		RunTestCaseFixture(testSuit, testIndex, TestFixtureSetup);
+		if (context->failCount == 0)
+		{
+			// The start code registers its watches on the shared loop and returns
+			testSuit->testPtrContainer[testIndex]->testFunc(testSuit);
+		}
+	}
+
+	slot->cpuNanoseconds += GetThreadCpuTime() - startCpuTime;
+	slot->cycles += ReadCycleCounter() - startCycles;
+
+	_testContext = previousContext;
+
+	if (IsAsyncTestFinished(context) == TRUE)
+	{
+		FinishAsyncTestSlot(runner, slot, FALSE);
+	}
+}
+
+/**
+ * @fn static void FinishAsyncTestSlot(TestAsyncRunnerPtr runner, TestAsyncSlotPtr slot, int timedOut)
+ * @brief 자리에서 진행 중인 ASYNC_TEST 를 끝내고 결과를 기록하여 리포터에 전달하는 함수(남은 감시 해제, TEARDOWN, 누수 검사, 공유 픽스처 정리)
+ * @param runner 실행 상태(입력, 출력)
+ * @param slot 테스트가 진행 중인 자리(입력, 출력)
+ * @param timedOut 제한 시간을 넘겨 끝내는지 여부(입력)
+ * @return 반환값 없음
+ */
+static void FinishAsyncTestSlot(TestAsyncRunnerPtr runner, TestAsyncSlotPtr slot, int timedOut)
+{
+	TestSuitPtr testSuit = runner->testSuit;
+	TestContextPtr context = &slot->context;
+	int testIndex = slot->testIndex;
+	TestReportPtr report = &testSuit->testReports[testIndex];
+
+	TestContextPtr previousContext = _testContext;
+	_testContext = context;
+
+	long long startCpuTime = GetThreadCpuTime();
+	unsigned long long startCycles = ReadCycleCounter();
+
+	// Watches left behind are dropped, without closing the descriptors of the test
+	RemoveAsyncWatches(runner->loop, context);
+
+	if (slot->fixtureReady != 0)
+	{
+		// The shared fixture of the test case could not be built
+		report->result = TestFail;
+	}
+	else
+	{
+		RunTestCaseFixture(testSuit, testIndex, TestFixtureTeardown);
+		if (timedOut == TRUE)
+		{
+			report->result = TestTimeout;
+		}
+		else
+		{
+			report->result = (context->failCount > 0) ? TestFail : TestSuccess;
+		}
+	}
+
+	report->perfCounters.measured = FALSE;
+
+	TestAllocationTrackerPtr allocationTracker = context->allocationTracker;
+	if (allocationTracker != NULL)
+	{
+		StopTestAllocations(allocationTracker, &report->allocations);
+		if (allocationTracker->heapProfile != NULL)
+		{
+			WriteTestHeapProfile(testSuit, testIndex, allocationTracker->heapProfile);
+		}
+
+		// A leak fails a test that passed otherwise
+		if (testSuit->options.leakCheck == TRUE && report->allocations.tracked == TRUE && report->allocations.leakedBlocks > 0 && report->result == TestSuccess)
+		{
+			ReportTestLeaks(testSuit, testIndex, allocationTracker);
+			context->failCount++;
+			report->result = TestFail;
+		}
+	}
+	else
+	{
+		report->allocations.tracked = FALSE;
+	}
+
+	slot->cpuNanoseconds += GetThreadCpuTime() - startCpuTime;
+	slot->cycles += ReadCycleCounter() - startCycles;
+	report->elapsedNanoseconds = GetMonotonicTime() - slot->beginTime;
+	report->cpuNanoseconds = slot->cpuNanoseconds;
+	report->cycles = slot->cycles;
+
+	// The last test of the case tears the shared fixture down, and its failures fail that test
+	int failCount = context->failCount;
+	ReleaseTestFixture(testSuit, testIndex);
+	if (context->failCount > failCount && report->result == TestSuccess)
+	{
+		report->result = TestFail;
+	}
+
+	report->exitRequested = (context->onGoing == TestExit) ? TRUE : FALSE;
+	report->signalNumber = 0;
+	report->exitStatus = 0;
+	report->timeoutMilliseconds = slot->timeoutMilliseconds;
+	report->benchmark = context->benchmark;
+	report->cached = FALSE;
+
+	_testContext = previousContext;
+
+	if (report->exitRequested == TRUE && slot->position < runner->exitPosition)
+	{
+		runner->exitPosition = slot->position;
+		SetExitTestSuit(testSuit);
+	}
+
+	// A test waits for the earlier tests still running, and one after the exit is never reported
+	TestAsyncResultPtr result = &runner->results[slot->position];
+	result->finished = TRUE;
+	if (slot->position == runner->replayPosition && slot->position <= runner->exitPosition)
+	{
+		ReplayTestResult(testSuit, testIndex, context->failureLog, context->failureLogLength, report);
+		result->replayed = TRUE;
+	}
+	else if (slot->position <= runner->exitPosition && context->failureLogLength > 0)
+	{
+		result->failureLog = (char*)malloc(context->failureLogLength);
+		if (result->failureLog != NULL)
+		{
+			memcpy(result->failureLog, context->failureLog, context->failureLogLength);
+			result->failureLogLength = context->failureLogLength;
+		}
+		else
+		{
+			// Report it out of order rather than lose its failures
+			ReplayTestResult(testSuit, testIndex, context->failureLog, context->failureLogLength, report);
+			result->replayed = TRUE;
+		}
+	}
+	ReplayFinishedAsyncTests(runner);
+
+	slot->testIndex = -1;
+	runner->numberOfRunningTests--;
+}
+
+/**
+ * @fn static void ReplayFinishedAsyncTests(TestAsyncRunnerPtr runner)
+ * @brief 다음 실행 순서부터 이미 끝난 테스트들의 보관한 결과를 차례대로 리포터에 전달하는 함수(종료를 요청한 테스트 뒤의 테스트는 전달하지 않는다)
+ * @param runner 실행 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void ReplayFinishedAsyncTests(TestAsyncRunnerPtr runner)
+{
+	TestSuitPtr testSuit = runner->testSuit;
+	while (runner->replayPosition < runner->numberOfTests && runner->replayPosition <= runner->exitPosition)
+	{
+		TestAsyncResultPtr result = &runner->results[runner->replayPosition];
+		if (result->finished == FALSE)
+		{
+			break;
+		}
+
+		if (result->replayed == FALSE)
+		{
+			int testIndex = runner->selectedTests[runner->replayPosition];
+			ReplayTestResult(testSuit, testIndex, result->failureLog, result->failureLogLength, &testSuit->testReports[testIndex]);
+			result->replayed = TRUE;
+		}
+		free(result->failureLog);
+		result->failureLog = NULL;
+		runner->replayPosition++;
+	}
+}
+
+/**
+ * @fn static int GetAsyncWaitTimeout(TestAsyncRunnerPtr runner)
+ * @brief 진행 중인 테스트의 가장 가까운 제한 시각까지 남은 시간을 계산하는 함수
+ * @param runner 실행 상태(입력)
+ * @return 남은 시간(밀리초, epoll_wait 함수의 timeout 값), 제한 시간이 있는 테스트가 없으면 -1 반환
+ */
+static int GetAsyncWaitTimeout(TestAsyncRunnerPtr runner)
+{
+	long long now = GetMonotonicTime();
+	long long timeout = -1;
+
+	int slotIndex = 0;
+	for (; slotIndex < runner->numberOfSlots; slotIndex++)
+	{
+		TestAsyncSlotPtr slot = &runner->slots[slotIndex];
+		if (slot->testIndex < 0 || slot->deadline == 0)
+		{
+			continue;
+		}
+
+		// Round up so that the loop does not wake up just before the deadline
+		long long remaining = (slot->deadline > now) ? (slot->deadline - now + 999999LL) / 1000000LL : 0;
+		if (timeout < 0 || remaining < timeout)
+		{
+			timeout = remaining;
+		}
+	}
+
+	return (timeout > 0x7fffffffLL) ? 0x7fffffff : (int)timeout;
+}
+
+/**
+ * @fn static unsigned int ToEpollEvents(int events)
+ * @brief TestAsyncEvent 비트 조합을 epoll 이벤트로 변환하는 함수
+ * @param events TestAsyncEvent 비트 조합(입력)
+ * @return epoll 이벤트 반환(오류와 연결 끊김은 항상 전달된다)
+ */
+static unsigned int ToEpollEvents(int events)
+{
+	unsigned int epollEvents = 0;
+	if ((events & TestAsyncRead) != 0)
+	{
+		epollEvents |= EPOLLIN;
+	}
+	if ((events & TestAsyncWrite) != 0)
+	{
+		epollEvents |= EPOLLOUT;
+	}
+
+	return epollEvents;
+}
+
+/**
+ * @fn static int FromEpollEvents(unsigned int epollEvents)
+ * @brief 받은 epoll 이벤트를 TestAsyncEvent 비트 조합으로 변환하는 함수
+ * @param epollEvents 받은 epoll 이벤트(입력)
+ * @return TestAsyncEvent 비트 조합 반환
+ */
+static int FromEpollEvents(unsigned int epollEvents)
+{
+	int events = 0;
+	if ((epollEvents & EPOLLIN) != 0)
+	{
+		events |= TestAsyncRead;
+	}
+	if ((epollEvents & EPOLLOUT) != 0)
+	{
+		events |= TestAsyncWrite;
+	}
+	if ((epollEvents & (EPOLLERR | EPOLLHUP)) != 0)
+	{
+		events |= TestAsyncHangup;
+	}
+
+	return events;
+}
@@ -0,0 +1,538 @@
+#include "ttlib_internal.h"
+
+#include <math.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 기준 결과 파일의 첫 줄
+#define TEST_BASELINE_HEADER "# ttlib benchmark baseline: tag testCase.testName count ns/op...\n"
+
+// 유의미한 차이로 판단할 Mann-Whitney U 검정의 단측 유의 수준
+#define TEST_BASELINE_SIGNIFICANCE 0.05
+
+// 테스트 하나의 기준 결과와 이번 측정 결과
+typedef struct _test_baseline_entry_t
+{
+	// 기준 결과 파일에 기록된 표본(iteration 당 나노초, 오름차순, 기록이 없으면 NULL)
+	double *baselineSamples;
+	// 기준 결과 표본 개수
+	int numberOfBaselineSamples;
+	// 기준 결과가 기록된 줄 번호(실패 정보에 사용)
+	int lineNumber;
+	// 이번에 측정한 표본(측정하지 않았으면 NULL)
+	double *samples;
+	// 이번에 측정한 표본 개수
+	int numberOfSamples;
+} TestBaselineEntry, *TestBaselineEntryPtr;
+
+// 현재 빌드 태그의 기준 결과를 테스트 번호별로 관리하기 위한 구조체
+typedef struct _test_baseline_t
+{
+	// 테스트 번호별 기준 결과와 측정 결과 리스트(testPtrContainer 와 같은 순서)
+	TestBaselineEntryPtr entries;
+	// 리스트 크기(전체 테스트 개수)
+	int numberOfEntries;
+} TestBaseline, *TestBaselinePtr;
+
+// 순위 계산에 사용하는 표본 하나의 정보
+typedef struct _test_rank_item_t
+{
+	// 표본 값
+	double value;
+	// 이번에 측정한 표본인지 여부
+	int isCurrent;
+} TestRankItem, *TestRankItemPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int ParseBaselineLine(TestSuitPtr testSuit, char *line, double **samples, int *numberOfSamples);
+static int ShouldWriteBaseline(TestSuitPtr testSuit, const TestBaselineEntry *entry);
+static double GetMannWhitneyPValue(const double *baselineSamples, int numberOfBaselineSamples, const double *samples, int numberOfSamples);
+static double GetNormalUpperTail(double z);
+static int CompareRankItems(const void *left, const void *right);
+static int CompareSamples(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int LoadBenchmarkBaseline(TestSuitPtr testSuit)
+ * @brief 기준 결과 파일에서 현재 빌드 태그의 기준 결과를 읽는 함수
+ * 기준 결과 파일 형식 : 한 줄에 "빌드태그 testCase.testName 표본개수 표본...", '#' 으로 시작하는 줄은 무시한다.
+ * 같은 테스트가 여러 번 기록되어 있으면 마지막 기록을 사용한다. 파일이 없으면 기준 결과 없이 시작한다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int LoadBenchmarkBaseline(TestSuitPtr testSuit)
+{
+	DeleteBenchmarkBaseline(testSuit);
+
+	TestBaselinePtr baseline = (TestBaselinePtr)calloc(1, sizeof(TestBaseline));
+	if (baseline == NULL)
+	{
+		return -1;
+	}
+
+	baseline->numberOfEntries = testSuit->numberOfTests;
+	baseline->entries = (TestBaselineEntryPtr)calloc((size_t)((testSuit->numberOfTests > 0) ? testSuit->numberOfTests : 1), sizeof(TestBaselineEntry));
+	if (baseline->entries == NULL)
+	{
+		free(baseline);
+		return -1;
+	}
+	testSuit->baseline = baseline;
+
+	FILE *input = fopen(testSuit->options.baselinePath, "r");
+	if (input == NULL)
+	{
+		return 0;
+	}
+
+	char *line = NULL;
+	size_t lineCapacity = 0;
+	int lineNumber = 0;
+	while (getline(&line, &lineCapacity, input) > 0)
+	{
+		lineNumber++;
+
+		double *samples = NULL;
+		int numberOfSamples = 0;
+		int testIndex = ParseBaselineLine(testSuit, line, &samples, &numberOfSamples);
+		if (testIndex < 0)
+		{
+			continue;
+		}
+
+		TestBaselineEntryPtr entry = &baseline->entries[testIndex];
+		free(entry->baselineSamples);
+		qsort(samples, (size_t)numberOfSamples, sizeof(double), CompareSamples);
+		entry->baselineSamples = samples;
+		entry->numberOfBaselineSamples = numberOfSamples;
+		entry->lineNumber = lineNumber;
+	}
+	free(line);
+	fclose(input);
+
+	return 0;
+}
+
+/**
+ * @fn void CompareBenchmarkBaseline(TestContextPtr context, const double *samples, int numberOfSamples)
+ * @brief 벤치마크 측정 표본을 기준 결과와 비교하여 결과를 context->benchmark 에 저장하는 함수
+ * 두 표본에 Mann-Whitney U 검정(정규 근사, 동순위 보정)을 적용하여 유의 수준 0.05 에서 느려졌고
+ * 중앙값 증가율이 실행 옵션의 기준(regressionThreshold)을 넘으면 성능 저하로 판단하여 현재 테스트의 실패로 기록한다.
+ * 측정 표본은 실행이 끝난 뒤 기준 결과 파일에 기록할 수 있도록 복사해 둔다.
+ * RunBenchmark 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param context 벤치마크를 실행 중인 TestContext 객체(입력, 출력)
+ * @param samples 측정 표본(iteration 당 나노초, 입력)
+ * @param numberOfSamples 측정 표본 개수(입력)
+ * @return 반환값 없음
+ */
+void CompareBenchmarkBaseline(TestContextPtr context, const double *samples, int numberOfSamples)
+{
+	TestSuitPtr testSuit = context->testSuit;
+	TestBaselinePtr baseline = testSuit->baseline;
+	if (baseline == NULL || context->testIndex >= baseline->numberOfEntries || numberOfSamples <= 0)
+	{
+		return;
+	}
+
+	TestBaselineEntryPtr entry = &baseline->entries[context->testIndex];
+	free(entry->samples);
+	entry->samples = (double*)malloc(sizeof(double) * (size_t)numberOfSamples);
+	entry->numberOfSamples = (entry->samples != NULL) ? numberOfSamples : 0;
+	if (entry->samples != NULL)
+	{
+		memcpy(entry->samples, samples, sizeof(double) * (size_t)numberOfSamples);
+	}
+
+	TestBenchmarkResultPtr result = &context->benchmark;
+	if (entry->baselineSamples == NULL)
+	{
+		result->baselineStatus = TestBaselineNew;
+		return;
+	}
+
+	int count = entry->numberOfBaselineSamples;
+	double baselineMedian = (count % 2 == 1) ? entry->baselineSamples[count / 2] : (entry->baselineSamples[count / 2 - 1] + entry->baselineSamples[count / 2]) / 2.0;
+
+	result->baselineMedianNanoseconds = baselineMedian;
+	result->changePercent = (baselineMedian > 0.0) ? (result->medianNanoseconds - baselineMedian) * 100.0 / baselineMedian : 0.0;
+	result->pValue = GetMannWhitneyPValue(entry->baselineSamples, count, samples, numberOfSamples);
+	result->baselineStatus = TestBaselineUnchanged;
+
+	if (result->pValue < TEST_BASELINE_SIGNIFICANCE && result->changePercent > (double)testSuit->options.regressionThreshold)
+	{
+		result->baselineStatus = TestBaselineRegressed;
+		testSuit->numberOfRegressions++;
+
+		ReportTestFailure("BENCHMARK_BASELINE", testSuit->options.baselinePath, entry->lineNumber, "성능 저하 (tag:%s, median:%.2f ns/op -> %.2f ns/op, %+.1f%%, p:%.4f, threshold:%d%%)", testSuit->options.baselineTag, baselineMedian, result->medianNanoseconds, result->changePercent, result->pValue, testSuit->options.regressionThreshold);
+		context->failCount++;
+	}
+	else if (result->changePercent < -(double)testSuit->options.regressionThreshold && GetMannWhitneyPValue(samples, numberOfSamples, entry->baselineSamples, count) < TEST_BASELINE_SIGNIFICANCE)
+	{
+		result->baselineStatus = TestBaselineImproved;
+	}
+}
+
+/**
+ * @fn int SaveBenchmarkBaseline(TestSuitPtr testSuit)
+ * @brief 이번에 측정한 벤치마크 표본을 기준 결과 파일에 기록하는 함수
+ * 기준 결과가 없던 벤치마크는 항상 기록하고, 이미 기준 결과가 있는 벤치마크는 updateBaseline 옵션이 있을 때만 갱신한다.
+ * 다른 빌드 태그와 현재 실행 파일에 없는 테스트의 기록은 그대로 유지한다.
+ * 임시 파일에 기록한 뒤 rename 하므로 기록 중에 다른 실행이 읽어도 깨진 파일을 보지 않는다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 성공 시 0(기록할 내용이 없는 경우 포함), 실패 시 -1 반환
+ */
+int SaveBenchmarkBaseline(TestSuitPtr testSuit)
+{
+	TestBaselinePtr baseline = testSuit->baseline;
+	if (baseline == NULL)
+	{
+		return 0;
+	}
+
+	int numberOfUpdates = 0;
+	int testIndex = 0;
+	for (; testIndex < baseline->numberOfEntries; testIndex++)
+	{
+		if (ShouldWriteBaseline(testSuit, &baseline->entries[testIndex]) == TRUE)
+		{
+			numberOfUpdates++;
+		}
+	}
+	if (numberOfUpdates == 0)
+	{
+		return 0;
+	}
+
+	const char *path = testSuit->options.baselinePath;
+	size_t pathLength = strlen(path);
+	char *temporaryPath = (char*)malloc(pathLength + 32);
+	if (temporaryPath == NULL)
+	{
+		return -1;
+	}
+	snprintf(temporaryPath, pathLength + 32, "%s.%ld.tmp", path, (long)getpid());
+
+	FILE *output = fopen(temporaryPath, "w");
+	if (output == NULL)
+	{
+		free(temporaryPath);
+		return -1;
+	}
+	fputs(TEST_BASELINE_HEADER, output);
+
+	// Keep the records which are not replaced by this run
+	FILE *input = fopen(path, "r");
+	if (input != NULL)
+	{
+		char *line = NULL;
+		size_t lineCapacity = 0;
+		while (getline(&line, &lineCapacity, input) > 0)
+		{
+			if (line[0] == '#')
+			{
+				continue;
+			}
+
+			char *record = strdup(line);
+			if (record == NULL)
+			{
+				continue;
+			}
+
+			double *samples = NULL;
+			int numberOfSamples = 0;
+			testIndex = ParseBaselineLine(testSuit, line, &samples, &numberOfSamples);
+			free(samples);
+			if (testIndex < 0 || ShouldWriteBaseline(testSuit, &baseline->entries[testIndex]) == FALSE)
+			{
+				fputs(record, output);
+				if (record[strlen(record) - 1] != '\n')
+				{
+					fputc('\n', output);
+				}
+			}
+			free(record);
+		}
+		free(line);
+		fclose(input);
+	}
+
+	// Append the measurements of this run
+	for (testIndex = 0; testIndex < baseline->numberOfEntries; testIndex++)
+	{
+		TestBaselineEntryPtr entry = &baseline->entries[testIndex];
+		if (ShouldWriteBaseline(testSuit, entry) == FALSE)
+		{
+			continue;
+		}
+
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		fprintf(output, "%s %s.%s %d", testSuit->options.baselineTag, test->testCase, test->testName, entry->numberOfSamples);
+		int sampleIndex = 0;
+		for (; sampleIndex < entry->numberOfSamples; sampleIndex++)
+		{
+			fprintf(output, " %.3f", entry->samples[sampleIndex]);
+		}
+		fputc('\n', output);
+	}
+
+	int result = (fclose(output) == 0 && rename(temporaryPath, path) == 0) ? 0 : -1;
+	if (result != 0)
+	{
+		unlink(temporaryPath);
+	}
+	free(temporaryPath);
+
+	return result;
+}
+
+/**
+ * @fn void DeleteBenchmarkBaseline(TestSuitPtr testSuit)
+ * @brief TestSuit 객체의 벤치마크 기준 결과를 삭제하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteBenchmarkBaseline(TestSuitPtr testSuit)
+{
+	TestBaselinePtr baseline = testSuit->baseline;
+	if (baseline == NULL)
+	{
+		return;
+	}
+
+	int testIndex = 0;
+	for (; testIndex < baseline->numberOfEntries; testIndex++)
+	{
+		free(baseline->entries[testIndex].baselineSamples);
+		free(baseline->entries[testIndex].samples);
+	}
+	free(baseline->entries);
+	free(baseline);
+	testSuit->baseline = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int ParseBaselineLine(TestSuitPtr testSuit, char *line, double **samples, int *numberOfSamples)
+ * @brief 기준 결과 파일의 한 줄을 해석하여 현재 빌드 태그의 테스트 번호와 표본을 얻는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param line 해석할 줄(입력, 해석 중에 변경된다)
+ * @param samples 새로 할당한 표본 리스트를 저장할 변수(출력, 성공 시 호출한 쪽에서 해제)
+ * @param numberOfSamples 표본 개수를 저장할 변수(출력)
+ * @return 성공 시 테스트 번호, 다른 빌드 태그이거나 현재 실행 파일에 없는 테스트이거나 잘못된 줄이면 -1 반환
+ */
+static int ParseBaselineLine(TestSuitPtr testSuit, char *line, double **samples, int *numberOfSamples)
+{
+	*samples = NULL;
+	*numberOfSamples = 0;
+
+	if (line[0] == '#')
+	{
+		return -1;
+	}
+
+	char *savePointer = NULL;
+	char *tag = strtok_r(line, " \t\r\n", &savePointer);
+	char *testCase = strtok_r(NULL, " \t\r\n", &savePointer);
+	char *count = strtok_r(NULL, " \t\r\n", &savePointer);
+	if (tag == NULL || testCase == NULL || count == NULL || strcmp(tag, testSuit->options.baselineTag) != 0)
+	{
+		return -1;
+	}
+
+	char *testName = strchr(testCase, '.');
+	if (testName == NULL)
+	{
+		return -1;
+	}
+	*testName++ = '\0';
+
+	int testIndex = FindTest(testSuit, testCase, testName);
+	char *end = NULL;
+	long numberOfValues = strtol(count, &end, 10);
+	if (testIndex < 0 || *end != '\0' || numberOfValues <= 0 || numberOfValues > 1000000)
+	{
+		return -1;
+	}
+
+	double *values = (double*)malloc(sizeof(double) * (size_t)numberOfValues);
+	if (values == NULL)
+	{
+		return -1;
+	}
+
+	int valueIndex = 0;
+	for (; valueIndex < (int)numberOfValues; valueIndex++)
+	{
+		char *value = strtok_r(NULL, " \t\r\n", &savePointer);
+		if (value == NULL)
+		{
+			free(values);
+			return -1;
+		}
+
+		values[valueIndex] = strtod(value, &end);
+		if (end == value || *end != '\0' || values[valueIndex] < 0.0)
+		{
+			free(values);
+			return -1;
+		}
+	}
+
+	*samples = values;
+	*numberOfSamples = (int)numberOfValues;
+
+	return testIndex;
+}
+
+/**
+ * @fn static int ShouldWriteBaseline(TestSuitPtr testSuit, const TestBaselineEntry *entry)
+ * @brief 이번 측정 결과를 기준 결과 파일에 기록해야 하는지 확인하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param entry 테스트 하나의 기준 결과와 측정 결과(입력)
+ * @return 기록해야 하면 TRUE, 아니면 FALSE 반환
+ */
+static int ShouldWriteBaseline(TestSuitPtr testSuit, const TestBaselineEntry *entry)
+{
+	if (entry->samples == NULL)
+	{
+		return FALSE;
+	}
+
+	return (entry->baselineSamples == NULL || testSuit->options.updateBaseline == TRUE) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static double GetMannWhitneyPValue(const double *baselineSamples, int numberOfBaselineSamples, const double *samples, int numberOfSamples)
+ * @brief 측정 표본이 기준 표본보다 크지 않다는 가설에 대한 Mann-Whitney U 검정의 단측 p 값을 계산하는 함수
+ * 표본 수가 적지 않다고 보고(각각 8 개 이상 권장) 동순위 보정과 연속성 보정을 적용한 정규 근사를 사용한다.
+ * 두 표본의 분포 모양을 가정하지 않으므로 실행 시간처럼 꼬리가 긴 측정값에 적합하다.
+ * @param baselineSamples 기준 표본 리스트(입력)
+ * @param numberOfBaselineSamples 기준 표본 개수(입력)
+ * @param samples 측정 표본 리스트(입력)
+ * @param numberOfSamples 측정 표본 개수(입력)
+ * @return p 값(0.0 ~ 1.0, 계산할 수 없으면 1.0) 반환
+ */
+static double GetMannWhitneyPValue(const double *baselineSamples, int numberOfBaselineSamples, const double *samples, int numberOfSamples)
+{
+	int numberOfItems = numberOfBaselineSamples + numberOfSamples;
+	if (numberOfBaselineSamples <= 0 || numberOfSamples <= 0)
+	{
+		return 1.0;
+	}
+
+	TestRankItemPtr items = (TestRankItemPtr)malloc(sizeof(TestRankItem) * (size_t)numberOfItems);
+	if (items == NULL)
+	{
+		return 1.0;
+	}
+
+	int itemIndex = 0;
+	for (; itemIndex < numberOfBaselineSamples; itemIndex++)
+	{
+		items[itemIndex].value = baselineSamples[itemIndex];
+		items[itemIndex].isCurrent = FALSE;
+	}
+	for (itemIndex = 0; itemIndex < numberOfSamples; itemIndex++)
+	{
+		items[numberOfBaselineSamples + itemIndex].value = samples[itemIndex];
+		items[numberOfBaselineSamples + itemIndex].isCurrent = TRUE;
+	}
+	qsort(items, (size_t)numberOfItems, sizeof(TestRankItem), CompareRankItems);
+
+	// Tied values share the average of their ranks
+	double rankSum = 0.0;
+	double tieSum = 0.0;
+	int start = 0;
+	while (start < numberOfItems)
+	{
+		int end = start + 1;
+		while (end < numberOfItems && items[end].value == items[start].value)
+		{
+			end++;
+		}
+
+		double rank = (double)(start + 1 + end) / 2.0;
+		for (itemIndex = start; itemIndex < end; itemIndex++)
+		{
+			if (items[itemIndex].isCurrent == TRUE)
+			{
+				rankSum += rank;
+			}
+		}
+
+		double tieLength = (double)(end - start);
+		tieSum += tieLength * tieLength * tieLength - tieLength;
+		start = end;
+	}
+	free(items);
+
+	double n1 = (double)numberOfBaselineSamples;
+	double n2 = (double)numberOfSamples;
+	double n = n1 + n2;
+	double u = rankSum - n2 * (n2 + 1.0) / 2.0;
+	double mean = n1 * n2 / 2.0;
+	double variance = n1 * n2 / 12.0 * ((n + 1.0) - tieSum / (n * (n - 1.0)));
+	if (variance <= 0.0)
+	{
+		return 1.0;
+	}
+
+	return GetNormalUpperTail((u - mean - 0.5) / sqrt(variance));
+}
+
+/**
+ * @fn static double GetNormalUpperTail(double z)
+ * @brief 표준 정규 분포에서 z 보다 큰 값이 나올 확률을 계산하는 함수
+ * 여오차 함수(erfc)로 계산한다.
+ * @param z 표준 정규 분포 값(입력)
+ * @return 확률 반환
+ */
+static double GetNormalUpperTail(double z)
+{
+	return 0.5 * erfc(z / M_SQRT2);
+}
+
+/**
+ * @fn static int CompareRankItems(const void *left, const void *right)
+ * @brief 순위 계산에 사용하는 표본을 값의 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 표본(입력)
+ * @param right 비교할 표본(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareRankItems(const void *left, const void *right)
+{
+	double leftValue = ((const TestRankItem*)left)->value;
+	double rightValue = ((const TestRankItem*)right)->value;
+
+	return (leftValue > rightValue) - (leftValue < rightValue);
+}
+
+/**
+ * @fn static int CompareSamples(const void *left, const void *right)
+ * @brief 표본 값을 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 표본 값(입력)
+ * @param right 비교할 표본 값(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareSamples(const void *left, const void *right)
+{
+	double leftValue = *(const double*)left;
+	double rightValue = *(const double*)right;
+
+	return (leftValue > rightValue) - (leftValue < rightValue);
+}
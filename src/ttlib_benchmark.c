@@ -0,0 +1,264 @@
+#include "ttlib_internal.h"
+
+#include <math.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 반복 한 번의 iteration 수 상한
+#define TEST_BENCHMARK_MAX_ITERATIONS 1000000000LL
+
+// 반복 한 번의 최소 측정 시간(나노초, 시계 읽기 비용이 결과에 섞이지 않도록 사용)
+#define TEST_BENCHMARK_MIN_REPETITION_TIME 100000LL
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static long long MeasureBenchmark(TestBenchmarkFunc body, long long iterations);
+static long long CalibrateBenchmark(TestBenchmarkFunc body, long long targetNanoseconds);
+static double GetPercentile(const double *sortedValues, int count, double percentile);
+static int CompareDoubles(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void RunBenchmark(TestBenchmarkFunc body)
+ * @brief BENCHMARK 매크로 함수로 정의한 측정 대상 코드를 실행하고 iteration 당 실행 시간 통계를 현재 TestContext 객체에 저장하는 함수
+ * 벤치마크 모드(--benchmark)가 아니면 측정 대상 코드를 한 번만 실행하여 동작 여부만 확인한다.
+ * 벤치마크 모드에서는 반복 한 번이 (측정 시간 / 반복 횟수) 이상 걸리도록 iteration 수를 맞춘 뒤(이 과정이 예열을 겸한다),
+ * 같은 iteration 수로 지정한 횟수만큼 반복 측정하여 최소, 중앙값, 평균, 표준편차, p99 값을 계산한다.
+ * 측정 중에 검사 매크로 함수가 실패하면 측정을 멈춘다. 모든 반복 측정을 마쳤으면 기준 결과(baseline)와 비교한다.
+ * @param body 측정 대상 코드를 지정한 횟수만큼 실행하는 함수(입력)
+ * @return 반환값 없음
+ */
+void RunBenchmark(TestBenchmarkFunc body)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || body == NULL)
+	{
+		return;
+	}
+
+	TestBenchmarkResultPtr result = &context->benchmark;
+	TestOptionsPtr options = &context->testSuit->options;
+
+	if (options->runBenchmarks == FALSE)
+	{
+		body(1);
+		return;
+	}
+
+	int repetitions = (options->benchmarkRepetitions > 0) ? options->benchmarkRepetitions : 1;
+	long long targetNanoseconds = (long long)options->benchmarkMilliseconds * 1000000LL / repetitions;
+	if (targetNanoseconds < TEST_BENCHMARK_MIN_REPETITION_TIME)
+	{
+		targetNanoseconds = TEST_BENCHMARK_MIN_REPETITION_TIME;
+	}
+
+	long long iterations = CalibrateBenchmark(body, targetNanoseconds);
+	if (context->failCount > 0)
+	{
+		return;
+	}
+
+	// The sample buffer and the statistics are library work, not allocations of the benchmark
+	PauseTestAllocations();
+	double *samples = (double*)malloc(sizeof(double) * (size_t)repetitions);
+	ResumeTestAllocations();
+	if (samples == NULL)
+	{
+		return;
+	}
+
+	// Restart the hardware counters so that they cover the measured repetitions only
+	TestPerfCountersPtr perfCounters = (options->perfCounters == TRUE) ? context->perfCounters : NULL;
+	if (perfCounters != NULL)
+	{
+		StartTestPerfCounters(perfCounters);
+	}
+
+	long long totalNanoseconds = 0;
+	int numberOfSamples = 0;
+	for (; numberOfSamples < repetitions; numberOfSamples++)
+	{
+		long long elapsedNanoseconds = MeasureBenchmark(body, iterations);
+		if (context->failCount > 0)
+		{
+			break;
+		}
+
+		totalNanoseconds += elapsedNanoseconds;
+		samples[numberOfSamples] = (double)elapsedNanoseconds / (double)iterations;
+	}
+
+	if (perfCounters != NULL)
+	{
+		PauseTestPerfCounters(perfCounters);
+	}
+
+	PauseTestAllocations();
+
+	if (numberOfSamples > 0)
+	{
+		double sum = 0.0;
+		int sampleIndex = 0;
+		for (; sampleIndex < numberOfSamples; sampleIndex++)
+		{
+			sum += samples[sampleIndex];
+		}
+		double mean = sum / numberOfSamples;
+
+		double squaredSum = 0.0;
+		for (sampleIndex = 0; sampleIndex < numberOfSamples; sampleIndex++)
+		{
+			squaredSum += (samples[sampleIndex] - mean) * (samples[sampleIndex] - mean);
+		}
+
+		qsort(samples, (size_t)numberOfSamples, sizeof(double), CompareDoubles);
+
+		result->iterations = iterations;
+		result->repetitions = numberOfSamples;
+		result->minimumNanoseconds = samples[0];
+		result->medianNanoseconds = GetPercentile(samples, numberOfSamples, 0.5);
+		result->meanNanoseconds = mean;
+		result->stddevNanoseconds = (numberOfSamples > 1) ? sqrt(squaredSum / (numberOfSamples - 1)) : 0.0;
+		result->p99Nanoseconds = GetPercentile(samples, numberOfSamples, 0.99);
+
+		double totalSeconds = (double)totalNanoseconds / 1000000000.0;
+		double totalIterations = (double)iterations * numberOfSamples;
+		result->bytesPerSecond = (totalSeconds > 0.0) ? (double)result->bytesPerIteration * totalIterations / totalSeconds : 0.0;
+		result->itemsPerSecond = (totalSeconds > 0.0) ? (double)result->itemsPerIteration * totalIterations / totalSeconds : 0.0;
+
+		if (numberOfSamples == repetitions)
+		{
+			CompareBenchmarkBaseline(context, samples, numberOfSamples);
+		}
+	}
+
+	free(samples);
+
+	ResumeTestAllocations();
+}
+
+/**
+ * @fn void SetBenchmarkCounters(long long bytesPerIteration, long long itemsPerIteration)
+ * @brief 측정 대상 코드가 iteration 한 번에 처리하는 바이트 수와 항목 수를 지정하는 함수(초당 처리량 계산에 사용, 음수면 변경하지 않음)
+ * @param bytesPerIteration iteration 당 처리 바이트 수(입력)
+ * @param itemsPerIteration iteration 당 처리 항목 수(입력)
+ * @return 반환값 없음
+ */
+void SetBenchmarkCounters(long long bytesPerIteration, long long itemsPerIteration)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL)
+	{
+		return;
+	}
+
+	if (bytesPerIteration >= 0)
+	{
+		context->benchmark.bytesPerIteration = bytesPerIteration;
+	}
+	if (itemsPerIteration >= 0)
+	{
+		context->benchmark.itemsPerIteration = itemsPerIteration;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static long long MeasureBenchmark(TestBenchmarkFunc body, long long iterations)
+ * @brief 측정 대상 코드를 지정한 횟수만큼 실행하고 걸린 시간을 반환하는 함수
+ * @param body 측정 대상 코드를 실행하는 함수(입력)
+ * @param iterations 실행 횟수(입력)
+ * @return 실행 시간(나노초) 반환
+ */
+static long long MeasureBenchmark(TestBenchmarkFunc body, long long iterations)
+{
+	long long startTime = GetMonotonicTime();
+	body(iterations);
+
+	return GetMonotonicTime() - startTime;
+}
+
+/**
+ * @fn static long long CalibrateBenchmark(TestBenchmarkFunc body, long long targetNanoseconds)
+ * @brief 반복 한 번의 실행 시간이 목표 시간 이상이 되는 iteration 수를 찾는 함수
+ * 1 회부터 시작하여 측정 시간과 목표 시간의 비율만큼(최소 2 배, 최대 10 배) iteration 수를 늘린다.
+ * @param body 측정 대상 코드를 실행하는 함수(입력)
+ * @param targetNanoseconds 반복 한 번의 목표 실행 시간(나노초, 입력)
+ * @return iteration 수 반환
+ */
+static long long CalibrateBenchmark(TestBenchmarkFunc body, long long targetNanoseconds)
+{
+	long long iterations = 1;
+	while (iterations < TEST_BENCHMARK_MAX_ITERATIONS)
+	{
+		long long elapsedNanoseconds = MeasureBenchmark(body, iterations);
+		if (elapsedNanoseconds >= targetNanoseconds || _testContext->failCount > 0)
+		{
+			break;
+		}
+
+		// Aim a little past the target so that one more round usually suffices
+		double scale = (elapsedNanoseconds > 0) ? (double)targetNanoseconds * 1.2 / (double)elapsedNanoseconds : 10.0;
+		if (scale < 2.0)
+		{
+			scale = 2.0;
+		}
+		else if (scale > 10.0)
+		{
+			scale = 10.0;
+		}
+
+		double nextIterations = (double)iterations * scale;
+		iterations = (nextIterations < (double)TEST_BENCHMARK_MAX_ITERATIONS) ? (long long)nextIterations : TEST_BENCHMARK_MAX_ITERATIONS;
+	}
+
+	return iterations;
+}
+
+/**
+ * @fn static double GetPercentile(const double *sortedValues, int count, double percentile)
+ * @brief 정렬된 값 리스트에서 백분위 값을 선형 보간으로 계산하는 함수
+ * @param sortedValues 오름차순으로 정렬된 값 리스트(입력)
+ * @param count 값 개수(1 이상, 입력)
+ * @param percentile 백분위(0.0 ~ 1.0, 입력)
+ * @return 백분위 값 반환
+ */
+static double GetPercentile(const double *sortedValues, int count, double percentile)
+{
+	double position = percentile * (count - 1);
+	int lower = (int)position;
+	if (lower >= count - 1)
+	{
+		return sortedValues[count - 1];
+	}
+
+	double fraction = position - lower;
+
+	return sortedValues[lower] + (sortedValues[lower + 1] - sortedValues[lower]) * fraction;
+}
+
+/**
+ * @fn static int CompareDoubles(const void *left, const void *right)
+ * @brief 실수 값을 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 값(입력)
+ * @param right 비교할 값(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareDoubles(const void *left, const void *right)
+{
+	double leftValue = *(const double*)left;
+	double rightValue = *(const double*)right;
+
+	return (leftValue > rightValue) - (leftValue < rightValue);
+}
+
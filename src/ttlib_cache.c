@@ -0,0 +1,1230 @@
+#include "ttlib_internal.h"
+
+#include <fcntl.h>
+#include <link.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 결과 캐시 파일의 첫 줄
+#define TEST_CACHE_HEADER "# ttlib cache: fingerprint testCase.testName\n"
+
+// 코드를 읽어 둘 최대 실행 파일 및 공유 라이브러리 개수
+#define TEST_CACHE_MAX_IMAGES 16
+
+// 코드가 참조하는 읽기 전용 문자열을 지문에 포함할 최대 길이
+#define TEST_CACHE_MAX_STRING 256
+
+// 코드가 참조하는 데이터 객체의 초기 내용을 지문에 포함할 최대 크기
+#define TEST_CACHE_MAX_OBJECT 4096
+
+// FNV-1a 해시의 초기값과 곱하는 소수
+#define TEST_CACHE_HASH_BASIS 14695981039346656037ULL
+#define TEST_CACHE_HASH_PRIME 1099511628211ULL
+
+// 실행 파일 또는 공유 라이브러리의 함수 또는 데이터 객체 심볼 하나
+typedef struct _test_code_symbol_t
+{
+	// 심볼의 시작 주소(적재 주소 반영)
+	uintptr_t address;
+	// 심볼 크기(0 이면 알 수 없음)
+	size_t size;
+	// 심볼 이름(ELF 파일 매핑 안의 문자열)
+	const char *name;
+	// 함수 심볼인지 여부(FALSE 면 데이터 객체)
+	int isFunction;
+	// 함수 코드의 해시 값(호출하는 함수는 이름으로 반영, 0 이면 아직 계산하지 않음)
+	unsigned long long hash;
+	// 함수 코드가 직접 호출하거나 주소를 얻는 함수들의 심볼 번호 리스트
+	size_t *callees;
+	// 호출하는 함수 개수
+	size_t numberOfCallees;
+	// 마지막으로 방문한 지문 계산 번호(같은 테스트에서 두 번 반영하지 않기 위해 사용)
+	int visited;
+} TestCodeSymbol, *TestCodeSymbolPtr;
+
+// 실행 파일 또는 공유 라이브러리의 메모리에 적재되는 섹션 하나
+typedef struct _test_code_section_t
+{
+	// 섹션의 시작 주소(적재 주소 반영)
+	uintptr_t address;
+	// 섹션 크기
+	size_t size;
+	// 섹션 이름(ELF 파일 매핑 안의 문자열)
+	const char *name;
+	// 섹션 플래그(SHF_WRITE, SHF_EXECINSTR)
+	unsigned long flags;
+	// 파일에 내용이 없는 섹션(.bss)인지 여부
+	int noBits;
+	// 섹션 내용의 ELF 파일 안 위치
+	size_t fileOffset;
+} TestCodeSection, *TestCodeSectionPtr;
+
+// 실행 파일 또는 공유 라이브러리 하나의 심볼과 섹션 정보
+typedef struct _test_code_image_t
+{
+	// 적재 주소(dl_phdr_info.dlpi_addr)
+	uintptr_t base;
+	// 주소 순으로 정렬된 심볼 리스트
+	TestCodeSymbolPtr symbols;
+	// 심볼 개수
+	size_t numberOfSymbols;
+	// 주소 순으로 정렬된 섹션 리스트
+	TestCodeSectionPtr sections;
+	// 섹션 개수
+	int numberOfSections;
+	// 심볼과 섹션 이름이 들어 있는 ELF 파일 매핑
+	void *image;
+	// ELF 파일 매핑 크기
+	size_t imageSize;
+} TestCodeImage, *TestCodeImagePtr;
+
+// 테스트별 지문과 결과 재사용 여부
+typedef struct _test_cache_t
+{
+	// 테스트 번호별 지문(0 이면 계산하지 못해 캐시하지 않음)
+	unsigned long long *fingerprints;
+	// 테스트 번호별 이전 성공 결과 재사용 여부
+	int *cachedTests;
+	// 결과를 재사용하는 테스트 개수
+	int numberOfCachedTests;
+	// 읽어 둔 실행 파일 및 공유 라이브러리 리스트
+	TestCodeImage images[TEST_CACHE_MAX_IMAGES];
+	// 읽어 둔 실행 파일 및 공유 라이브러리 개수
+	int numberOfImages;
+} TestCache, *TestCachePtr;
+
+// 주소가 속한 실행 파일 또는 공유 라이브러리를 찾기 위한 구조체(dl_iterate_phdr 콜백에서 사용)
+typedef struct _test_code_module_t
+{
+	// 찾을 주소
+	uintptr_t address;
+	// 주소가 속한 객체의 경로(실행 파일은 빈 문자열)
+	const char *path;
+	// 주소가 속한 객체의 적재 주소
+	uintptr_t base;
+	// 찾았는지 여부
+	int found;
+} TestCodeModule, *TestCodeModulePtr;
+
+// 공유 라이브러리들의 파일 정보를 지문에 반영하기 위한 구조체(dl_iterate_phdr 콜백에서 사용)
+typedef struct _test_cache_salt_t
+{
+	// 코드를 직접 읽은 객체들(파일 정보 대신 코드로 반영되므로 제외한다)
+	TestCachePtr cache;
+	// 해시 값
+	unsigned long long hash;
+} TestCacheSalt, *TestCacheSaltPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned long long ComputeTestFingerprint(TestSuitPtr testSuit, int testIndex);
+static int HashCodeRoot(TestCachePtr cache, uintptr_t address, int generation, unsigned long long *hash);
+static unsigned long long HashCodeSymbol(TestCodeImagePtr image, size_t symbolIndex);
+static int HashCodeReference(TestCodeImagePtr image, TestCodeSymbolPtr symbol, uintptr_t target, unsigned long long *hash);
+static int IsMemoryOpcode(unsigned char opcode);
+static int AddCodeCallee(TestCodeSymbolPtr symbol, size_t calleeIndex);
+static unsigned long long HashDataFile(const char *path, unsigned long long hash);
+static unsigned long long ComputeTestSalt(TestSuitPtr testSuit);
+static int HashSharedObject(struct dl_phdr_info *info, size_t size, void *data);
+static int ParseCacheLine(TestSuitPtr testSuit, char *line, unsigned long long *fingerprint);
+static TestCodeImagePtr GetCodeImage(TestCachePtr cache, uintptr_t address);
+static int LoadCodeImage(TestCodeImagePtr image, const char *path);
+static int FindCodeModule(struct dl_phdr_info *info, size_t size, void *data);
+static const TestCodeSection *FindCodeSection(TestCodeImagePtr image, uintptr_t address);
+static long FindCodeSymbol(TestCodeImagePtr image, uintptr_t address);
+static unsigned long long HashBytes(unsigned long long hash, const void *data, size_t length);
+static unsigned long long HashString(unsigned long long hash, const char *text);
+static int CompareCodeSymbols(const void *left, const void *right);
+static int CompareCodeSections(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestInitializationResult RegisterTestData(TestSuitPtr testSuit, TestDataPtrContainer begin, TestDataPtrContainer end)
+ * @brief 링커 섹션(ttlib_data)에 배치된 테스트 데이터 파일 레코드 리스트를 TestSuit 객체에 연결하는 함수
+ * 선언이 하나도 없으면 begin 과 end 가 모두 NULL 이다.
+ * @param testSuit 전체 테스트 관리 구조체(출력)
+ * @param begin 테스트 데이터 파일 레코드 리스트의 시작(__start_ttlib_data, 입력)
+ * @param end 테스트 데이터 파일 레코드 리스트의 끝(__stop_ttlib_data, 입력)
+ * @return 성공 시 TestInitializationResultSuccess, 실패 시 TestInitializationResultFail 반환
+ */
+TestInitializationResult RegisterTestData(TestSuitPtr testSuit, TestDataPtrContainer begin, TestDataPtrContainer end)
+{
+	// Check parameter
+	if (testSuit == NULL || begin > end)
+	{
+		return TestInitializationResultFail;
+	}
+
+	testSuit->dataPtrContainer = begin;
+	testSuit->numberOfData = (begin == NULL) ? 0 : (int)(end - begin);
+
+	return TestInitializationResultSuccess;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int PrepareTestCache(TestSuitPtr testSuit)
+ * @brief 선택된 테스트들의 지문을 계산하고, 결과 캐시 파일에 같은 지문으로 성공이 기록된 테스트를 재사용 대상으로 표시하는 함수
+ * 지문은 테스트 함수와 테스트 케이스의 픽스처 함수에서 시작하여 직접 호출하거나 주소를 얻는 함수들의 코드(ELF 심볼 테이블로 찾는다),
+ * 코드가 참조하는 읽기 전용 문자열과 데이터, TEST_DATA 로 선언한 파일 내용, 결과에 영향을 주는 실행 옵션,
+ * 코드를 읽지 않은 공유 라이브러리의 파일 정보(크기, 수정 시각)로 계산한다.
+ * 일반 테스트(TestKindTest)만 캐시하며, 벤치마크 모드와 퍼징 모드에서는 사용하지 않는다.
+ * RunAllTests 함수에서 테스트를 선택한 뒤 픽스처를 준비하기 전에 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 결과를 재사용하는 테스트 개수, 실패 시 -1 반환
+ */
+int PrepareTestCache(TestSuitPtr testSuit)
+{
+	DeleteTestCache(testSuit);
+
+	if (testSuit->options.cachePath == NULL || testSuit->options.runBenchmarks == TRUE || testSuit->options.fuzzTarget != NULL || testSuit->numberOfTests == 0)
+	{
+		return 0;
+	}
+
+	TestCachePtr cache = (TestCachePtr)calloc(1, sizeof(TestCache));
+	if (cache == NULL)
+	{
+		return -1;
+	}
+	testSuit->cache = cache;
+
+	cache->fingerprints = (unsigned long long*)calloc((size_t)testSuit->numberOfTests, sizeof(unsigned long long));
+	cache->cachedTests = (int*)calloc((size_t)testSuit->numberOfTests, sizeof(int));
+	if (cache->fingerprints == NULL || cache->cachedTests == NULL)
+	{
+		DeleteTestCache(testSuit);
+		return -1;
+	}
+
+	int selectedIndex = 0;
+	for (; selectedIndex < testSuit->numberOfSelectedTests; selectedIndex++)
+	{
+		int testIndex = testSuit->selectedTests[selectedIndex];
+		cache->fingerprints[testIndex] = ComputeTestFingerprint(testSuit, testIndex);
+	}
+
+	// The salt covers what the code scan does not read, so it is computed after the images are loaded
+	unsigned long long salt = ComputeTestSalt(testSuit);
+	for (selectedIndex = 0; selectedIndex < testSuit->numberOfSelectedTests; selectedIndex++)
+	{
+		int testIndex = testSuit->selectedTests[selectedIndex];
+		if (cache->fingerprints[testIndex] != 0)
+		{
+			unsigned long long fingerprint = HashBytes(cache->fingerprints[testIndex], &salt, sizeof(salt));
+			cache->fingerprints[testIndex] = (fingerprint != 0) ? fingerprint : 1;
+		}
+	}
+
+	FILE *input = fopen(testSuit->options.cachePath, "r");
+	if (input == NULL)
+	{
+		return 0;
+	}
+
+	char *line = NULL;
+	size_t lineCapacity = 0;
+	while (getline(&line, &lineCapacity, input) > 0)
+	{
+		unsigned long long fingerprint = 0;
+		int testIndex = ParseCacheLine(testSuit, line, &fingerprint);
+		if (testIndex >= 0 && cache->fingerprints[testIndex] != 0 && cache->fingerprints[testIndex] == fingerprint && cache->cachedTests[testIndex] == FALSE)
+		{
+			cache->cachedTests[testIndex] = TRUE;
+			cache->numberOfCachedTests++;
+		}
+	}
+	free(line);
+	fclose(input);
+
+	return cache->numberOfCachedTests;
+}
+
+/**
+ * @fn int IsTestResultCached(TestSuitPtr testSuit, int testIndex)
+ * @brief 테스트의 이전 성공 결과를 재사용할지 여부를 반환하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 재사용하면 TRUE, 실행해야 하면 FALSE 반환
+ */
+int IsTestResultCached(TestSuitPtr testSuit, int testIndex)
+{
+	if (testSuit->cache == NULL || testIndex < 0 || testIndex >= testSuit->numberOfTests)
+	{
+		return FALSE;
+	}
+
+	return testSuit->cache->cachedTests[testIndex];
+}
+
+/**
+ * @fn int GetNumberOfCachedTests(TestSuitPtr testSuit)
+ * @brief 이전 성공 결과를 재사용하는 테스트 개수를 반환하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 결과를 재사용하는 테스트 개수 반환(결과 캐시를 사용하지 않으면 0)
+ */
+int GetNumberOfCachedTests(TestSuitPtr testSuit)
+{
+	return (testSuit->cache != NULL) ? testSuit->cache->numberOfCachedTests : 0;
+}
+
+/**
+ * @fn int SaveTestCache(TestSuitPtr testSuit)
+ * @brief 이번 실행에서 성공한 테스트들의 지문을 결과 캐시 파일에 반영하는 함수
+ * 이번에 실행되지 않은 테스트(다른 샤드, 다른 실행 파일의 테스트 포함)의 기록은 그대로 유지하고,
+ * 실패했거나 지문을 계산하지 못한 테스트의 기록은 지워서 다음 실행에서 다시 실행되게 한다.
+ * 임시 파일에 기록한 뒤 rename 하므로 기록 중에 다른 실행이 읽어도 깨진 파일을 보지 않는다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int SaveTestCache(TestSuitPtr testSuit)
+{
+	TestCachePtr cache = testSuit->cache;
+	const char *path = testSuit->options.cachePath;
+	if (cache == NULL || path == NULL || testSuit->testReports == NULL)
+	{
+		return 0;
+	}
+
+	size_t pathLength = strlen(path);
+	char *temporaryPath = (char*)malloc(pathLength + 32);
+	if (temporaryPath == NULL)
+	{
+		return -1;
+	}
+	snprintf(temporaryPath, pathLength + 32, "%s.%ld.tmp", path, (long)getpid());
+
+	FILE *output = fopen(temporaryPath, "w");
+	if (output == NULL)
+	{
+		free(temporaryPath);
+		return -1;
+	}
+	fputs(TEST_CACHE_HEADER, output);
+
+	// Keep the records of tests which did not run this time
+	FILE *input = fopen(path, "r");
+	if (input != NULL)
+	{
+		char *line = NULL;
+		size_t lineCapacity = 0;
+		while (getline(&line, &lineCapacity, input) > 0)
+		{
+			if (line[0] == '#')
+			{
+				continue;
+			}
+
+			char *record = strdup(line);
+			if (record == NULL)
+			{
+				continue;
+			}
+
+			unsigned long long fingerprint = 0;
+			int testIndex = ParseCacheLine(testSuit, line, &fingerprint);
+			if (testIndex < 0 || testSuit->testReports[testIndex].result == TestNotRun)
+			{
+				fputs(record, output);
+				if (record[strlen(record) - 1] != '\n')
+				{
+					fputc('\n', output);
+				}
+			}
+			free(record);
+		}
+		free(line);
+		fclose(input);
+	}
+
+	// Append the tests which passed this time, including the reused ones
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		if (testSuit->testReports[testIndex].result != TestSuccess || cache->fingerprints[testIndex] == 0)
+		{
+			continue;
+		}
+
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		fprintf(output, "%016llx %s.%s\n", cache->fingerprints[testIndex], test->testCase, test->testName);
+	}
+
+	int result = (fclose(output) == 0 && rename(temporaryPath, path) == 0) ? 0 : -1;
+	if (result != 0)
+	{
+		unlink(temporaryPath);
+	}
+	free(temporaryPath);
+
+	return result;
+}
+
+/**
+ * @fn void DeleteTestCache(TestSuitPtr testSuit)
+ * @brief 테스트별 지문과 읽어 둔 실행 파일 정보를 삭제하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestCache(TestSuitPtr testSuit)
+{
+	TestCachePtr cache = testSuit->cache;
+	if (cache == NULL)
+	{
+		return;
+	}
+
+	int imageIndex = 0;
+	for (; imageIndex < cache->numberOfImages; imageIndex++)
+	{
+		TestCodeImagePtr image = &cache->images[imageIndex];
+		size_t symbolIndex = 0;
+		for (; symbolIndex < image->numberOfSymbols; symbolIndex++)
+		{
+			free(image->symbols[symbolIndex].callees);
+		}
+		free(image->symbols);
+		free(image->sections);
+		if (image->image != NULL)
+		{
+			munmap(image->image, image->imageSize);
+		}
+	}
+
+	free(cache->fingerprints);
+	free(cache->cachedTests);
+	free(cache);
+	testSuit->cache = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static unsigned long long ComputeTestFingerprint(TestSuitPtr testSuit, int testIndex)
+ * @brief 테스트 하나의 지문(실행 옵션과 공유 라이브러리 정보 제외)을 계산하는 함수
+ * 테스트 함수나 픽스처 함수의 심볼을 찾지 못하면(심볼 테이블이 없는 실행 파일 등) 캐시하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 성공 시 지문, 캐시할 수 없으면 0 반환
+ */
+static unsigned long long ComputeTestFingerprint(TestSuitPtr testSuit, int testIndex)
+{
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+	if (test->kind != TestKindTest)
+	{
+		return 0;
+	}
+
+	unsigned long long hash = TEST_CACHE_HASH_BASIS;
+	hash = HashString(hash, test->testCase);
+	hash = HashString(hash, test->testName);
+	hash = HashBytes(hash, &test->timeoutMilliseconds, sizeof(test->timeoutMilliseconds));
+
+	// Each test marks the functions it reaches with its own generation
+	int generation = testIndex + 1;
+	if (HashCodeRoot(testSuit->cache, (uintptr_t)test->testFunc, generation, &hash) != 0)
+	{
+		return 0;
+	}
+
+	// The fixtures of the case run with the test, in the order of their kinds
+	int kind = TestFixtureSetup;
+	for (; kind <= TestFixtureSharedTeardown; kind++)
+	{
+		int fixtureIndex = 0;
+		for (; fixtureIndex < testSuit->numberOfFixtures; fixtureIndex++)
+		{
+			TestFixturePtr fixture = testSuit->fixturePtrContainer[fixtureIndex];
+			if (fixture->kind != kind || strcmp(fixture->testCase, test->testCase) != 0)
+			{
+				continue;
+			}
+
+			hash = HashBytes(hash, &kind, sizeof(kind));
+			if (HashCodeRoot(testSuit->cache, (uintptr_t)fixture->fixtureFunc, generation, &hash) != 0)
+			{
+				return 0;
+			}
+		}
+	}
+
+	int dataIndex = 0;
+	for (; dataIndex < testSuit->numberOfData; dataIndex++)
+	{
+		TestDataPtr data = testSuit->dataPtrContainer[dataIndex];
+		if (strcmp(data->testCase, test->testCase) == 0 && strcmp(data->testName, test->testName) == 0)
+		{
+			hash = HashDataFile(data->path, HashString(hash, data->path));
+		}
+	}
+
+	return (hash != 0) ? hash : 1;
+}
+
+/**
+ * @fn static int HashCodeRoot(TestCachePtr cache, uintptr_t address, int generation, unsigned long long *hash)
+ * @brief 함수와 그 함수에서 직접 호출하는 함수들을 너비 우선으로 따라가며 코드 해시 값을 반영하는 함수
+ * 같은 지문 계산 번호로 이미 방문한 함수는 다시 반영하지 않으므로 재귀 호출과 공통 함수가 한 번씩만 반영된다.
+ * @param cache 테스트 결과 캐시(입력, 출력)
+ * @param address 시작 함수의 주소(입력)
+ * @param generation 지문 계산 번호(입력)
+ * @param hash 해시 값(입력, 출력)
+ * @return 성공 시 0, 시작 함수의 심볼을 찾지 못했으면 -1 반환
+ */
+static int HashCodeRoot(TestCachePtr cache, uintptr_t address, int generation, unsigned long long *hash)
+{
+	TestCodeImagePtr image = GetCodeImage(cache, address);
+	if (image == NULL)
+	{
+		return -1;
+	}
+
+	long rootIndex = FindCodeSymbol(image, address);
+	if (rootIndex < 0 || image->symbols[rootIndex].address != address || image->symbols[rootIndex].isFunction == FALSE)
+	{
+		return -1;
+	}
+
+	size_t *queue = (size_t*)malloc(sizeof(size_t) * image->numberOfSymbols);
+	if (queue == NULL)
+	{
+		return -1;
+	}
+
+	size_t head = 0;
+	size_t tail = 0;
+	if (image->symbols[rootIndex].visited != generation)
+	{
+		image->symbols[rootIndex].visited = generation;
+		queue[tail++] = (size_t)rootIndex;
+	}
+
+	while (head < tail)
+	{
+		size_t symbolIndex = queue[head++];
+		unsigned long long symbolHash = HashCodeSymbol(image, symbolIndex);
+		*hash = HashBytes(*hash, &symbolHash, sizeof(symbolHash));
+
+		TestCodeSymbolPtr symbol = &image->symbols[symbolIndex];
+		size_t calleeIndex = 0;
+		for (; calleeIndex < symbol->numberOfCallees; calleeIndex++)
+		{
+			TestCodeSymbolPtr callee = &image->symbols[symbol->callees[calleeIndex]];
+			if (callee->visited != generation)
+			{
+				callee->visited = generation;
+				queue[tail++] = symbol->callees[calleeIndex];
+			}
+		}
+	}
+	free(queue);
+
+	return 0;
+}
+
+/**
+ * @fn static unsigned long long HashCodeSymbol(TestCodeImagePtr image, size_t symbolIndex)
+ * @brief 함수 하나의 코드 해시 값을 계산하고 직접 호출하는 함수 리스트를 만드는 함수(처음 계산한 값을 재사용한다)
+ * x86-64 코드의 rel32 값은 다른 코드가 추가되면 함께 바뀌므로, call, jmp, jcc 명령어와 RIP 상대 주소 ModR/M 바이트 뒤의 4 바이트를 상대 주소로 보고
+ * 가리키는 곳이 함수 시작이면 함수 이름으로, 데이터이면 객체 이름이나 문자열 내용으로 바꿔 반영한다.
+ * 명령어 경계를 해석하지 않는 근사 방식이라 우연히 일치한 값 때문에 코드가 같아도 지문이 달라질 수 있지만(불필요한 재실행),
+ * 바뀐 코드 바이트는 항상 반영된다. 다른 아키텍처에서는 코드 바이트를 그대로 반영한다.
+ * @param image 함수가 속한 실행 파일 정보(입력, 출력)
+ * @param symbolIndex 함수의 심볼 번호(입력)
+ * @return 코드 해시 값 반환
+ */
+static unsigned long long HashCodeSymbol(TestCodeImagePtr image, size_t symbolIndex)
+{
+	TestCodeSymbolPtr symbol = &image->symbols[symbolIndex];
+	if (symbol->hash != 0)
+	{
+		return symbol->hash;
+	}
+
+	unsigned long long hash = HashString(TEST_CACHE_HASH_BASIS, symbol->name);
+	const unsigned char *code = (const unsigned char*)symbol->address;
+
+	size_t position = 0;
+	while (position < symbol->size)
+	{
+#if defined(__x86_64__)
+		// Only the displacements after call, jmp, jcc and RIP-relative ModR/M bytes are taken as addresses
+		int isDisplacement = FALSE;
+		if (position >= 1 && (code[position - 1] == 0xe8 || code[position - 1] == 0xe9))
+		{
+			isDisplacement = TRUE;
+		}
+		else if (position >= 2 && (code[position - 1] & 0xc7) == 0x05 && IsMemoryOpcode(code[position - 2]) == TRUE)
+		{
+			isDisplacement = TRUE;
+		}
+		else if (position >= 2 && code[position - 2] == 0x0f && (code[position - 1] & 0xf0) == 0x80)
+		{
+			isDisplacement = TRUE;
+		}
+
+		if (isDisplacement == TRUE && position + 4 <= symbol->size)
+		{
+			int32_t displacement = 0;
+			memcpy(&displacement, code + position, sizeof(displacement));
+			uintptr_t target = symbol->address + position + 4 + (uintptr_t)(intptr_t)displacement;
+
+			// Jumps inside the function do not move with the rest of the code
+			if ((target < symbol->address || target >= symbol->address + symbol->size) && HashCodeReference(image, symbol, target, &hash) == TRUE)
+			{
+				position += 4;
+				continue;
+			}
+		}
+#endif
+		hash = (hash ^ code[position]) * TEST_CACHE_HASH_PRIME;
+		position++;
+	}
+
+	symbol->hash = (hash != 0) ? hash : 1;
+
+	return symbol->hash;
+}
+
+/**
+ * @fn static int HashCodeReference(TestCodeImagePtr image, TestCodeSymbolPtr symbol, uintptr_t target, unsigned long long *hash)
+ * @brief 코드가 상대 주소로 가리키는 곳을 위치와 무관한 값으로 해시 값에 반영하는 함수
+ * 함수 시작이면 이름을 반영하고 호출하는 함수 리스트에 추가하며, 데이터 객체이면 이름, 크기, 객체 안의 위치와 ELF 파일에 기록된 초기 내용을
+ * (쓰기 가능한 객체는 앞선 테스트가 바꿨을 수 있으므로 메모리 대신 파일에서 읽는다, .bss 는 내용 대신 크기만),
+ * 심볼이 없는 읽기 전용 데이터이면 문자열 리터럴로 보고 NULL 문자까지의 내용을 반영한다.
+ * PLT, GOT 안이면 섹션 이름과 섹션 안의 위치를 반영한다.
+ * 다른 함수의 중간이나 심볼이 없는 그 밖의 데이터를 가리키는 값은 대부분 주소처럼 보이는 상수이므로 상대 주소로 보지 않는다.
+ * @param image 함수가 속한 실행 파일 정보(입력, 출력)
+ * @param symbol 코드를 읽는 함수 심볼(입력, 출력)
+ * @param target 상대 주소가 가리키는 주소(입력)
+ * @param hash 해시 값(입력, 출력)
+ * @return 반영했으면 TRUE, 적재된 섹션 밖이라 상대 주소가 아니면 FALSE 반환
+ */
+static int HashCodeReference(TestCodeImagePtr image, TestCodeSymbolPtr symbol, uintptr_t target, unsigned long long *hash)
+{
+	const TestCodeSection *section = FindCodeSection(image, target);
+	if (section == NULL)
+	{
+		return FALSE;
+	}
+
+	long targetIndex = FindCodeSymbol(image, target);
+	const TestCodeSymbol *targetSymbol = (targetIndex >= 0) ? &image->symbols[targetIndex] : NULL;
+	int readOnly = ((section->flags & SHF_WRITE) == 0 && section->noBits == FALSE) ? TRUE : FALSE;
+
+	if ((section->flags & SHF_EXECINSTR) != 0)
+	{
+		if (targetSymbol != NULL && targetSymbol->isFunction == TRUE && targetSymbol->address == target)
+		{
+			*hash = HashString(HashString(*hash, "F"), targetSymbol->name);
+			AddCodeCallee(symbol, (size_t)targetIndex);
+			return TRUE;
+		}
+
+		// Inside another function body it is almost always an immediate that only looks like an address
+		if (strncmp(section->name, ".plt", 4) != 0)
+		{
+			return FALSE;
+		}
+	}
+	else if (targetSymbol != NULL)
+	{
+		uintptr_t offset = target - targetSymbol->address;
+		*hash = HashString(HashString(*hash, "O"), targetSymbol->name);
+		*hash = HashBytes(*hash, &offset, sizeof(offset));
+		*hash = HashBytes(*hash, &targetSymbol->size, sizeof(targetSymbol->size));
+
+		// Take the initial contents from the file, the same for read-only and writable objects
+		const TestCodeSection *objectSection = FindCodeSection(image, targetSymbol->address);
+		if (objectSection != NULL && objectSection->noBits == FALSE)
+		{
+			size_t objectOffset = objectSection->fileOffset + (targetSymbol->address - objectSection->address);
+			size_t length = objectSection->address + objectSection->size - targetSymbol->address;
+			length = (targetSymbol->size < length) ? targetSymbol->size : length;
+			length = (length < TEST_CACHE_MAX_OBJECT) ? length : TEST_CACHE_MAX_OBJECT;
+			if (objectOffset <= image->imageSize && length <= image->imageSize - objectOffset)
+			{
+				*hash = HashBytes(*hash, (const unsigned char*)image->image + objectOffset, length);
+			}
+		}
+		return TRUE;
+	}
+	else if (readOnly == TRUE && strncmp(section->name, ".rodata", 7) == 0)
+	{
+		const char *text = (const char*)target;
+		size_t limit = section->address + section->size - target;
+		size_t length = strnlen(text, (limit < TEST_CACHE_MAX_STRING) ? limit : TEST_CACHE_MAX_STRING);
+		*hash = HashBytes(HashString(*hash, "S"), text, length);
+		return TRUE;
+	}
+
+	else if (strncmp(section->name, ".got", 4) != 0 && (section->flags & SHF_EXECINSTR) == 0)
+	{
+		// Named data always has a symbol, so anything else is an immediate that only looks like an address
+		return FALSE;
+	}
+
+	uintptr_t offset = target - section->address;
+	*hash = HashString(HashString(*hash, "X"), section->name);
+	*hash = HashBytes(*hash, &offset, sizeof(offset));
+
+	return TRUE;
+}
+
+/**
+ * @fn static int IsMemoryOpcode(unsigned char opcode)
+ * @brief ModR/M 바이트로 메모리 피연산자를 지정하는 x86-64 명령어의 마지막 opcode 바이트인지 검사하는 함수
+ * mov, lea, 산술 및 비교, test, 간접 호출, 즉시값 저장, 0F 확장(movzx, movsx, SSE 이동과 연산) 명령어만 인정하여
+ * 다른 명령어의 즉시값에 들어 있는 ModR/M 모양의 바이트를 상대 주소의 시작으로 보지 않는다.
+ * @param opcode ModR/M 바로 앞 바이트(입력)
+ * @return 메모리 피연산자 명령어이면 TRUE, 아니면 FALSE 반환
+ */
+static int IsMemoryOpcode(unsigned char opcode)
+{
+	switch (opcode)
+	{
+		// add, or, adc, sbb, and, sub, xor, cmp with a register operand
+		case 0x01: case 0x03: case 0x09: case 0x0b: case 0x11: case 0x13: case 0x19: case 0x1b:
+		case 0x21: case 0x23: case 0x29: case 0x2b: case 0x31: case 0x33: case 0x39: case 0x3b:
+		// movsxd, group 1 with an immediate, test, mov, lea
+		case 0x63: case 0x80: case 0x81: case 0x83: case 0x84: case 0x85: case 0x88: case 0x89:
+		case 0x8a: case 0x8b: case 0x8d:
+		// mov with an immediate, group 3 and 5 (including indirect call and jmp)
+		case 0xc6: case 0xc7: case 0xf6: case 0xf7: case 0xfe: case 0xff:
+		// 0F escaped moves and arithmetic of SSE, movzx and movsx
+		case 0x10: case 0x28: case 0x2a: case 0x2c: case 0x2d: case 0x2e: case 0x2f:
+		case 0x54: case 0x57: case 0x58: case 0x59: case 0x5c: case 0x5e: case 0x6e: case 0x6f:
+		case 0x7e: case 0x7f: case 0xb6: case 0xb7: case 0xbe: case 0xbf: case 0xd6:
+			return TRUE;
+		default:
+			return FALSE;
+	}
+}
+
+/**
+ * @fn static int AddCodeCallee(TestCodeSymbolPtr symbol, size_t calleeIndex)
+ * @brief 함수가 호출하는 함수 리스트에 심볼 번호를 추가하는 함수(이미 있으면 추가하지 않는다)
+ * @param symbol 코드를 읽는 함수 심볼(입력, 출력)
+ * @param calleeIndex 호출하는 함수의 심볼 번호(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int AddCodeCallee(TestCodeSymbolPtr symbol, size_t calleeIndex)
+{
+	size_t position = 0;
+	for (; position < symbol->numberOfCallees; position++)
+	{
+		if (symbol->callees[position] == calleeIndex)
+		{
+			return 0;
+		}
+	}
+
+	// Grow by powers of two
+	if ((symbol->numberOfCallees & (symbol->numberOfCallees - 1)) == 0)
+	{
+		size_t capacity = (symbol->numberOfCallees == 0) ? 4 : symbol->numberOfCallees * 2;
+		size_t *callees = (size_t*)realloc(symbol->callees, sizeof(size_t) * capacity);
+		if (callees == NULL)
+		{
+			return -1;
+		}
+		symbol->callees = callees;
+	}
+	symbol->callees[symbol->numberOfCallees++] = calleeIndex;
+
+	return 0;
+}
+
+/**
+ * @fn static unsigned long long HashDataFile(const char *path, unsigned long long hash)
+ * @brief 테스트 데이터 파일의 내용을 해시 값에 반영하는 함수(파일이 없으면 없다는 사실을 반영한다)
+ * @param path 테스트 데이터 파일 경로(입력)
+ * @param hash 해시 값(입력)
+ * @return 반영한 해시 값 반환
+ */
+static unsigned long long HashDataFile(const char *path, unsigned long long hash)
+{
+	FILE *input = fopen(path, "rb");
+	if (input == NULL)
+	{
+		return HashString(hash, "-");
+	}
+
+	unsigned char buffer[4096];
+	size_t length = 0;
+	while ((length = fread(buffer, 1, sizeof(buffer), input)) > 0)
+	{
+		hash = HashBytes(hash, buffer, length);
+	}
+	fclose(input);
+
+	return HashString(hash, "+");
+}
+
+/**
+ * @fn static unsigned long long ComputeTestSalt(TestSuitPtr testSuit)
+ * @brief 모든 테스트의 지문에 공통으로 반영할 값을 계산하는 함수
+ * 결과에 영향을 주는 실행 옵션과, 코드를 읽지 않은 공유 라이브러리(libc 등)의 경로, 크기, 수정 시각을 반영한다.
+ * 속성 기반 테스트의 seed 는 지정하지 않으면 실행할 때마다 바뀌므로 반영하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 공통 해시 값 반환
+ */
+static unsigned long long ComputeTestSalt(TestSuitPtr testSuit)
+{
+	const TestOptions *options = &testSuit->options;
+
+	unsigned long long hash = TEST_CACHE_HASH_BASIS;
+	hash = HashBytes(hash, &options->timeoutMilliseconds, sizeof(options->timeoutMilliseconds));
+	hash = HashBytes(hash, &options->leakCheck, sizeof(options->leakCheck));
+	hash = HashBytes(hash, &options->propertyCases, sizeof(options->propertyCases));
+	hash = HashBytes(hash, &options->differentialCases, sizeof(options->differentialCases));
+
+	TestCacheSalt salt;
+	salt.cache = testSuit->cache;
+	salt.hash = hash;
+	dl_iterate_phdr(HashSharedObject, &salt);
+
+	return salt.hash;
+}
+
+/**
+ * @fn static int HashSharedObject(struct dl_phdr_info *info, size_t size, void *data)
+ * @brief (dl_iterate_phdr 콜백) 코드를 읽지 않은 공유 라이브러리의 파일 정보를 해시 값에 반영하는 함수
+ * @param info 실행 파일 또는 공유 라이브러리 정보(입력)
+ * @param size info 구조체 크기(입력)
+ * @param data 해시 값을 저장할 TestCacheSalt 구조체(입력, 출력)
+ * @return 계속 순회하도록 항상 0 반환
+ */
+static int HashSharedObject(struct dl_phdr_info *info, size_t size, void *data)
+{
+	(void)size;
+	TestCacheSaltPtr salt = (TestCacheSaltPtr)data;
+
+	if (info->dlpi_name == NULL || info->dlpi_name[0] == '\0')
+	{
+		return 0;
+	}
+
+	int imageIndex = 0;
+	for (; imageIndex < salt->cache->numberOfImages; imageIndex++)
+	{
+		if (salt->cache->images[imageIndex].base == (uintptr_t)info->dlpi_addr)
+		{
+			return 0;
+		}
+	}
+
+	struct stat status;
+	if (stat(info->dlpi_name, &status) != 0)
+	{
+		return 0;
+	}
+
+	long long fileSize = (long long)status.st_size;
+	long long modifiedSeconds = (long long)status.st_mtim.tv_sec;
+	long long modifiedNanoseconds = (long long)status.st_mtim.tv_nsec;
+	salt->hash = HashString(salt->hash, info->dlpi_name);
+	salt->hash = HashBytes(salt->hash, &fileSize, sizeof(fileSize));
+	salt->hash = HashBytes(salt->hash, &modifiedSeconds, sizeof(modifiedSeconds));
+	salt->hash = HashBytes(salt->hash, &modifiedNanoseconds, sizeof(modifiedNanoseconds));
+
+	return 0;
+}
+
+/**
+ * @fn static int ParseCacheLine(TestSuitPtr testSuit, char *line, unsigned long long *fingerprint)
+ * @brief 결과 캐시 파일의 한 줄을 해석하여 테스트 번호와 지문을 얻는 함수
+ * 결과 캐시 파일 형식 : 한 줄에 "지문(16 진수) testCase.testName", '#' 으로 시작하는 줄은 무시한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param line 해석할 줄(입력, 해석 중에 변경된다)
+ * @param fingerprint 지문을 저장할 변수(출력)
+ * @return 성공 시 테스트 번호, 현재 실행 파일에 없는 테스트이거나 잘못된 줄이면 -1 반환
+ */
+static int ParseCacheLine(TestSuitPtr testSuit, char *line, unsigned long long *fingerprint)
+{
+	if (line[0] == '#')
+	{
+		return -1;
+	}
+
+	char *end = NULL;
+	*fingerprint = strtoull(line, &end, 16);
+	if (end == line || *end != ' ')
+	{
+		return -1;
+	}
+
+	char *testCase = end + 1;
+	char *testName = strchr(testCase, '.');
+	if (testName == NULL)
+	{
+		return -1;
+	}
+	*testName++ = '\0';
+	testName[strcspn(testName, "\r\n")] = '\0';
+
+	return FindTest(testSuit, testCase, testName);
+}
+
+/**
+ * @fn static TestCodeImagePtr GetCodeImage(TestCachePtr cache, uintptr_t address)
+ * @brief 주소가 속한 실행 파일 또는 공유 라이브러리의 심볼과 섹션 정보를 얻는 함수(처음 필요할 때 읽는다)
+ * @param cache 테스트 결과 캐시(입력, 출력)
+ * @param address 찾을 주소(입력)
+ * @return 성공 시 실행 파일 정보, 찾지 못했거나 읽지 못했으면 NULL 반환
+ */
+static TestCodeImagePtr GetCodeImage(TestCachePtr cache, uintptr_t address)
+{
+	TestCodeModule module;
+	module.address = address;
+	module.path = NULL;
+	module.base = 0;
+	module.found = FALSE;
+	dl_iterate_phdr(FindCodeModule, &module);
+	if (module.found == FALSE)
+	{
+		return NULL;
+	}
+
+	int imageIndex = 0;
+	for (; imageIndex < cache->numberOfImages; imageIndex++)
+	{
+		if (cache->images[imageIndex].base == module.base)
+		{
+			return (cache->images[imageIndex].symbols != NULL) ? &cache->images[imageIndex] : NULL;
+		}
+	}
+	if (cache->numberOfImages >= TEST_CACHE_MAX_IMAGES)
+	{
+		return NULL;
+	}
+
+	// An image which cannot be read stays in the list so that it is not read again
+	TestCodeImagePtr image = &cache->images[cache->numberOfImages++];
+	memset(image, 0, sizeof(TestCodeImage));
+	image->base = module.base;
+
+	return (LoadCodeImage(image, module.path) == 0) ? image : NULL;
+}
+
+/**
+ * @fn static int LoadCodeImage(TestCodeImagePtr image, const char *path)
+ * @brief ELF 파일의 함수와 데이터 객체 심볼, 적재되는 섹션들을 읽는 함수
+ * 정적 함수까지 따라갈 수 있도록 .symtab 이 필요하며, strip 된 파일은 읽지 않는다(그 파일의 테스트는 캐시하지 않는다).
+ * @param image 실행 파일 정보(base 는 입력, 나머지는 출력)
+ * @param path ELF 파일 경로(빈 문자열이면 현재 실행 파일, 입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int LoadCodeImage(TestCodeImagePtr image, const char *path)
+{
+	int isExecutable = (path == NULL || *path == '\0') ? TRUE : FALSE;
+	int fd = open(isExecutable ? "/proc/self/exe" : path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	struct stat status;
+	if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(ElfW(Ehdr)))
+	{
+		close(fd);
+		return -1;
+	}
+
+	void *mapping = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		return -1;
+	}
+	image->image = mapping;
+	image->imageSize = (size_t)status.st_size;
+
+	const unsigned char *bytes = (const unsigned char*)mapping;
+	const ElfW(Ehdr) *header = (const ElfW(Ehdr)*)mapping;
+	if (memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 || header->e_shentsize != sizeof(ElfW(Shdr)) || header->e_shoff == 0 || header->e_shoff + (size_t)header->e_shnum * sizeof(ElfW(Shdr)) > image->imageSize || header->e_shstrndx >= header->e_shnum)
+	{
+		return -1;
+	}
+
+	const ElfW(Shdr) *sections = (const ElfW(Shdr)*)(bytes + header->e_shoff);
+	const ElfW(Shdr) *symbolSection = NULL;
+	int sectionIndex = 0;
+	for (; sectionIndex < header->e_shnum; sectionIndex++)
+	{
+		if (sections[sectionIndex].sh_type == SHT_SYMTAB)
+		{
+			symbolSection = &sections[sectionIndex];
+		}
+	}
+
+	const ElfW(Shdr) *nameSection = &sections[header->e_shstrndx];
+	if (symbolSection == NULL || symbolSection->sh_link >= header->e_shnum || symbolSection->sh_offset + symbolSection->sh_size > image->imageSize || nameSection->sh_offset + nameSection->sh_size > image->imageSize)
+	{
+		return -1;
+	}
+
+	const ElfW(Shdr) *stringSection = &sections[symbolSection->sh_link];
+	if (stringSection->sh_offset + stringSection->sh_size > image->imageSize)
+	{
+		return -1;
+	}
+
+	// Keep the sections mapped into memory to classify the referenced addresses
+	image->sections = (TestCodeSectionPtr)malloc(sizeof(TestCodeSection) * (size_t)header->e_shnum);
+	if (image->sections == NULL)
+	{
+		return -1;
+	}
+
+	const char *sectionNames = (const char*)(bytes + nameSection->sh_offset);
+	for (sectionIndex = 0; sectionIndex < header->e_shnum; sectionIndex++)
+	{
+		const ElfW(Shdr) *elfSection = &sections[sectionIndex];
+		if ((elfSection->sh_flags & SHF_ALLOC) == 0 || (elfSection->sh_flags & SHF_TLS) != 0 || elfSection->sh_size == 0 || elfSection->sh_name >= nameSection->sh_size)
+		{
+			continue;
+		}
+
+		TestCodeSectionPtr section = &image->sections[image->numberOfSections++];
+		section->address = image->base + (uintptr_t)elfSection->sh_addr;
+		section->size = (size_t)elfSection->sh_size;
+		section->name = sectionNames + elfSection->sh_name;
+		section->flags = (unsigned long)elfSection->sh_flags;
+		section->noBits = (elfSection->sh_type == SHT_NOBITS) ? TRUE : FALSE;
+		section->fileOffset = (size_t)elfSection->sh_offset;
+	}
+	qsort(image->sections, (size_t)image->numberOfSections, sizeof(TestCodeSection), CompareCodeSections);
+
+	const ElfW(Sym) *elfSymbols = (const ElfW(Sym)*)(bytes + symbolSection->sh_offset);
+	size_t numberOfElfSymbols = symbolSection->sh_size / sizeof(ElfW(Sym));
+	const char *strings = (const char*)(bytes + stringSection->sh_offset);
+
+	TestCodeSymbolPtr symbols = (TestCodeSymbolPtr)calloc(numberOfElfSymbols + 1, sizeof(TestCodeSymbol));
+	if (symbols == NULL)
+	{
+		return -1;
+	}
+
+	size_t numberOfSymbols = 0;
+	size_t symbolIndex = 0;
+	for (; symbolIndex < numberOfElfSymbols; symbolIndex++)
+	{
+		const ElfW(Sym) *elfSymbol = &elfSymbols[symbolIndex];
+		int type = ELF64_ST_TYPE(elfSymbol->st_info);
+		int isFunction = (type == STT_FUNC || type == STT_GNU_IFUNC) ? TRUE : FALSE;
+		if ((isFunction == FALSE && type != STT_OBJECT) || elfSymbol->st_shndx == SHN_UNDEF || elfSymbol->st_shndx >= SHN_LORESERVE || elfSymbol->st_value == 0 || elfSymbol->st_name >= stringSection->sh_size)
+		{
+			continue;
+		}
+
+		TestCodeSymbolPtr symbol = &symbols[numberOfSymbols++];
+		symbol->address = image->base + (uintptr_t)elfSymbol->st_value;
+		symbol->size = (size_t)elfSymbol->st_size;
+		symbol->name = strings + elfSymbol->st_name;
+		symbol->isFunction = isFunction;
+	}
+	qsort(symbols, numberOfSymbols, sizeof(TestCodeSymbol), CompareCodeSymbols);
+
+	image->symbols = symbols;
+	image->numberOfSymbols = numberOfSymbols;
+
+	return 0;
+}
+
+/**
+ * @fn static int FindCodeModule(struct dl_phdr_info *info, size_t size, void *data)
+ * @brief (dl_iterate_phdr 콜백) 주소가 속한 실행 파일 또는 공유 라이브러리를 찾는 함수
+ * @param info 실행 파일 또는 공유 라이브러리 정보(입력)
+ * @param size info 구조체 크기(입력)
+ * @param data 찾을 주소와 결과를 저장할 TestCodeModule 구조체(입력, 출력)
+ * @return 찾았으면 1(순회 중단), 못 찾았으면 0 반환
+ */
+static int FindCodeModule(struct dl_phdr_info *info, size_t size, void *data)
+{
+	(void)size;
+	TestCodeModulePtr module = (TestCodeModulePtr)data;
+
+	int headerIndex = 0;
+	for (; headerIndex < info->dlpi_phnum; headerIndex++)
+	{
+		const ElfW(Phdr) *header = &info->dlpi_phdr[headerIndex];
+		uintptr_t begin = (uintptr_t)info->dlpi_addr + (uintptr_t)header->p_vaddr;
+		if (header->p_type == PT_LOAD && module->address >= begin && module->address < begin + (uintptr_t)header->p_memsz)
+		{
+			module->path = info->dlpi_name;
+			module->base = (uintptr_t)info->dlpi_addr;
+			module->found = TRUE;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @fn static const TestCodeSection *FindCodeSection(TestCodeImagePtr image, uintptr_t address)
+ * @brief 주소가 속한 적재 섹션을 찾는 함수
+ * @param image 실행 파일 정보(입력)
+ * @param address 찾을 주소(입력)
+ * @return 찾았으면 섹션, 못 찾았으면 NULL 반환
+ */
+static const TestCodeSection *FindCodeSection(TestCodeImagePtr image, uintptr_t address)
+{
+	int low = 0;
+	int high = image->numberOfSections;
+	while (low < high)
+	{
+		int middle = low + (high - low) / 2;
+		if (image->sections[middle].address <= address)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	if (low > 0 && address < image->sections[low - 1].address + image->sections[low - 1].size)
+	{
+		return &image->sections[low - 1];
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static long FindCodeSymbol(TestCodeImagePtr image, uintptr_t address)
+ * @brief 주소가 속한 심볼을 찾는 함수(크기를 알 수 없는 심볼은 시작 주소가 같을 때만 찾는다)
+ * @param image 실행 파일 정보(입력)
+ * @param address 찾을 주소(입력)
+ * @return 찾았으면 심볼 번호, 못 찾았으면 -1 반환
+ */
+static long FindCodeSymbol(TestCodeImagePtr image, uintptr_t address)
+{
+	size_t low = 0;
+	size_t high = image->numberOfSymbols;
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		if (image->symbols[middle].address <= address)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	// Prefer the first of the symbols starting at the same address
+	if (low > 0)
+	{
+		size_t symbolIndex = low - 1;
+		uintptr_t start = image->symbols[symbolIndex].address;
+		while (symbolIndex > 0 && image->symbols[symbolIndex - 1].address == start)
+		{
+			symbolIndex--;
+		}
+
+		for (; symbolIndex < low; symbolIndex++)
+		{
+			const TestCodeSymbol *symbol = &image->symbols[symbolIndex];
+			if (address == symbol->address || address < symbol->address + symbol->size)
+			{
+				return (long)symbolIndex;
+			}
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @fn static unsigned long long HashBytes(unsigned long long hash, const void *data, size_t length)
+ * @brief 바이트 배열을 해시 값에 반영하는 함수(FNV-1a)
+ * @param hash 해시 값(입력)
+ * @param data 바이트 배열(입력)
+ * @param length 바이트 배열 길이(입력)
+ * @return 반영한 해시 값 반환
+ */
+static unsigned long long HashBytes(unsigned long long hash, const void *data, size_t length)
+{
+	const unsigned char *bytes = (const unsigned char*)data;
+	size_t position = 0;
+	for (; position < length; position++)
+	{
+		hash = (hash ^ bytes[position]) * TEST_CACHE_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+/**
+ * @fn static unsigned long long HashString(unsigned long long hash, const char *text)
+ * @brief 문자열을 NULL 문자까지 해시 값에 반영하는 함수(이어지는 문자열과 구분되도록 NULL 문자도 반영한다)
+ * @param hash 해시 값(입력)
+ * @param text 문자열(입력)
+ * @return 반영한 해시 값 반환
+ */
+static unsigned long long HashString(unsigned long long hash, const char *text)
+{
+	return HashBytes(hash, text, strlen(text) + 1);
+}
+
+/**
+ * @fn static int CompareCodeSymbols(const void *left, const void *right)
+ * @brief 심볼을 시작 주소의 오름차순(같으면 함수 먼저, 그다음 이름 순)으로 정렬하기 위한 비교 함수
+ * @param left 비교할 심볼(입력)
+ * @param right 비교할 심볼(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareCodeSymbols(const void *left, const void *right)
+{
+	const TestCodeSymbol *leftSymbol = (const TestCodeSymbol*)left;
+	const TestCodeSymbol *rightSymbol = (const TestCodeSymbol*)right;
+
+	if (leftSymbol->address != rightSymbol->address)
+	{
+		return (leftSymbol->address < rightSymbol->address) ? -1 : 1;
+	}
+	if (leftSymbol->isFunction != rightSymbol->isFunction)
+	{
+		return rightSymbol->isFunction - leftSymbol->isFunction;
+	}
+
+	return strcmp(leftSymbol->name, rightSymbol->name);
+}
+
+/**
+ * @fn static int CompareCodeSections(const void *left, const void *right)
+ * @brief 섹션을 시작 주소의 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 섹션(입력)
+ * @param right 비교할 섹션(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareCodeSections(const void *left, const void *right)
+{
+	uintptr_t leftAddress = ((const TestCodeSection*)left)->address;
+	uintptr_t rightAddress = ((const TestCodeSection*)right)->address;
+
+	return (leftAddress > rightAddress) - (leftAddress < rightAddress);
+}
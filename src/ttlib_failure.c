@@ -0,0 +1,950 @@
+#include "ttlib_internal.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 실패 기록 파일의 시작을 표시하는 값(NULL 문자 포함 8 바이트)
+#define TEST_FAILURE_LOG_MAGIC "TTFLOG1"
+
+// 변환 하나(예: "%-08lld")의 최대 길이(NULL 문자 포함, 더 길면 기록하지 않고 바로 포맷팅한다)
+#define TEST_FAILURE_SPEC_SIZE 32
+
+// 실패 메시지를 포맷팅할 때 먼저 사용하는 스택 버퍼 크기(더 길면 힙에 할당)
+#define TEST_FAILURE_MESSAGE_SIZE 512
+
+// 호출 위치 해시 테이블의 초기 크기(2 의 거듭제곱)
+#define TEST_FAILURE_SITE_TABLE_SIZE 64
+
+// 포맷 문자열의 변환 하나가 사용하는 인자 형식
+typedef enum _test_failure_argument_e
+{
+	// 인자를 사용하지 않음(%%)
+	TestFailureArgumentNone = 0,
+	// int(%d, %u, %x, %c 등)
+	TestFailureArgumentInt,
+	// long(%ld 등)
+	TestFailureArgumentLong,
+	// long long(%lld 등)
+	TestFailureArgumentLongLong,
+	// size_t(%zu 등)
+	TestFailureArgumentSize,
+	// intmax_t(%jd 등)
+	TestFailureArgumentIntMax,
+	// ptrdiff_t(%td 등)
+	TestFailureArgumentPtrDiff,
+	// double(%f, %g 등)
+	TestFailureArgumentDouble,
+	// long double(%Lf 등)
+	TestFailureArgumentLongDouble,
+	// 포인터(%p)
+	TestFailureArgumentPointer,
+	// 문자열(%s, 내용을 복사하여 기록한다)
+	TestFailureArgumentString,
+	// 기록할 수 없는 변환(*, $, %n, %ls 등, 이 포맷 문자열의 실패는 바로 포맷팅한다)
+	TestFailureArgumentUnsupported
+} TestFailureArgument;
+
+// 실패 기록 파일의 항목 종류
+typedef enum _test_failure_log_entry_type_e
+{
+	// 호출 위치 기술자(매크로 함수 이름, 파일 이름, 포맷 문자열), 처음 사용될 때 한 번 기록된다
+	TestFailureLogSite = 1,
+	// 뒤따르는 실패의 테스트(테스트 케이스, 테스트 이름)
+	TestFailureLogTest,
+	// 호출 위치 번호와 인자 값 기록
+	TestFailureLogFailure,
+	// 포맷팅된 실패(매크로 함수 이름, 파일 이름, 메시지)
+	TestFailureLogMessage
+} TestFailureLogEntryType;
+
+// 실패 기록 파일의 항목 헤더(헤더 뒤에 length 바이트의 데이터가 붙는다)
+typedef struct _test_failure_log_entry_t
+{
+	// 항목 종류(TestFailureLogEntryType)
+	int type;
+	// 호출 위치 번호(Site, Failure) 또는 테스트 번호(Test)
+	int id;
+	// 소스 줄 번호(Site, Message)
+	int lineNumber;
+	// 헤더 뒤에 붙은 데이터 길이
+	int length;
+} TestFailureLogEntry, *TestFailureLogEntryPtr;
+
+// 실패 기록 파일의 출력 상태
+typedef struct _test_failure_log_t
+{
+	// 출력 파일
+	FILE *file;
+	// 기록한 호출 위치 기술자의 해시 테이블(열린 주소 방식)
+	const TestFailureSite **sites;
+	// 해시 테이블 항목별 호출 위치 번호(기록한 순서)
+	int *siteIds;
+	// 해시 테이블 크기(2 의 거듭제곱)
+	int capacity;
+	// 기록한 호출 위치 개수
+	int numberOfSites;
+	// 마지막으로 실패를 기록한 테스트 번호(-1 이면 없음)
+	int testIndex;
+	// 쓰기 실패 여부
+	int error;
+} TestFailureLog, *TestFailureLogPtr;
+
+// 실패 기록 파일에서 읽은 호출 위치 기술자
+typedef struct _test_failure_log_site_t
+{
+	// 매크로 함수 이름, 파일 이름, 포맷 문자열이 차례로 붙은 항목 데이터(해제 대상)
+	char *data;
+	// 매크로 함수 이름
+	const char *macroName;
+	// 소스 파일 이름
+	const char *fileName;
+	// 포맷 문자열
+	const char *format;
+	// 소스 줄 번호
+	int lineNumber;
+} TestFailureLogSiteEntry, *TestFailureLogSiteEntryPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static const char *ParseFailureConversion(const char *conversion, TestFailureArgument *argument);
+static size_t AppendFailureText(char *buffer, size_t size, size_t length, const char *text, size_t textLength);
+static size_t AppendFailureDecimal(char *buffer, size_t size, size_t length, long long value);
+static int GetFailureSiteId(TestFailureLogPtr log, const TestFailureSite *site, int *isNew);
+static void WriteFailureLogEntry(TestFailureLogPtr log, int type, int id, int lineNumber, const char *data, size_t length);
+static int ReadFailureLogStrings(const char *data, int length, const char **strings, int numberOfStrings);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn long long DecodeTestFailureLog(const char *path, FILE *output)
+ * @brief --failure-log 로 저장한 바이너리 실패 기록 파일을 읽어 실패 메시지를 포맷팅하여 출력하는 함수(ttdecode 에서 사용)
+ * 호출 위치 기술자와 인자 값으로 console 리포터와 같은 형식의 실패 줄을 만든다. 기록을 만든 프로그램과 같은 아키텍처에서 읽어야 한다.
+ * @param path 실패 기록 파일 경로(입력)
+ * @param output 출력 대상(입력)
+ * @return 성공 시 출력한 실패 개수, 파일을 열 수 없거나 기록이 손상되었으면 -1 반환(손상되기 전까지의 실패는 출력된다)
+ */
+long long DecodeTestFailureLog(const char *path, FILE *output)
+{
+	// Check parameter
+	if (path == NULL || output == NULL)
+	{
+		return -1;
+	}
+
+	FILE *file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		return -1;
+	}
+
+	char magic[sizeof(TEST_FAILURE_LOG_MAGIC)];
+	if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, TEST_FAILURE_LOG_MAGIC, sizeof(magic)) != 0)
+	{
+		fclose(file);
+		return -1;
+	}
+
+	TestFailureLogSiteEntryPtr sites = NULL;
+	int numberOfSites = 0;
+	long long numberOfFailures = 0;
+	char stackMessage[TEST_FAILURE_MESSAGE_SIZE];
+
+	TestFailureLogEntry entry;
+	while (TRUE)
+	{
+		// A header cut off in the middle means the file was truncated
+		size_t headerLength = fread(&entry, 1, sizeof(entry), file);
+		if (headerLength != sizeof(entry))
+		{
+			numberOfFailures = (headerLength == 0 && ferror(file) == 0) ? numberOfFailures : -1;
+			break;
+		}
+
+		char *data = (entry.length >= 0) ? (char*)malloc((size_t)entry.length + 1) : NULL;
+		if (data == NULL || fread(data, 1, (size_t)entry.length, file) != (size_t)entry.length)
+		{
+			free(data);
+			numberOfFailures = -1;
+			break;
+		}
+		data[entry.length] = '\0';
+
+		const char *strings[3];
+		if (entry.type == TestFailureLogSite)
+		{
+			// Sites are numbered in the order they were written
+			TestFailureLogSiteEntryPtr newSites = (entry.id == numberOfSites) ? (TestFailureLogSiteEntryPtr)realloc(sites, sizeof(TestFailureLogSiteEntry) * (size_t)(numberOfSites + 1)) : NULL;
+			if (newSites != NULL)
+			{
+				sites = newSites;
+			}
+			if (newSites == NULL || ReadFailureLogStrings(data, entry.length, strings, 3) != 0)
+			{
+				free(data);
+				numberOfFailures = -1;
+				break;
+			}
+			sites[numberOfSites].data = data;
+			sites[numberOfSites].macroName = strings[0];
+			sites[numberOfSites].fileName = strings[1];
+			sites[numberOfSites].format = strings[2];
+			sites[numberOfSites].lineNumber = entry.lineNumber;
+			numberOfSites++;
+			continue;
+		}
+
+		int valid = TRUE;
+		if (entry.type == TestFailureLogTest && ReadFailureLogStrings(data, entry.length, strings, 2) == 0)
+		{
+			fprintf(output, "\n{ (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s }\n", entry.id + 1, strings[0], strings[1]);
+		}
+		else if (entry.type == TestFailureLogMessage && ReadFailureLogStrings(data, entry.length, strings, 3) == 0)
+		{
+			fprintf(output, "(FAIL) [%s] %s (file:%s, line:%d)\n", strings[0], strings[2], strings[1], entry.lineNumber);
+			numberOfFailures++;
+		}
+		else if (entry.type == TestFailureLogFailure && entry.id >= 0 && entry.id < numberOfSites)
+		{
+			TestFailureLogSiteEntryPtr site = &sites[entry.id];
+			char *message = stackMessage;
+			int length = FormatTestFailureMessage(site->format, data, (size_t)entry.length, stackMessage, sizeof(stackMessage));
+			if (length >= (int)sizeof(stackMessage))
+			{
+				message = (char*)malloc((size_t)length + 1);
+				if (message != NULL)
+				{
+					FormatTestFailureMessage(site->format, data, (size_t)entry.length, message, (size_t)length + 1);
+				}
+			}
+
+			valid = (length >= 0 && message != NULL) ? TRUE : FALSE;
+			if (valid == TRUE)
+			{
+				fprintf(output, "(FAIL) [%s] %s (file:%s, line:%d)\n", site->macroName, message, site->fileName, site->lineNumber);
+				numberOfFailures++;
+			}
+			if (message != stackMessage)
+			{
+				free(message);
+			}
+		}
+		else
+		{
+			valid = FALSE;
+		}
+		free(data);
+
+		if (valid == FALSE)
+		{
+			numberOfFailures = -1;
+			break;
+		}
+	}
+
+	int siteIndex = 0;
+	for (; siteIndex < numberOfSites; siteIndex++)
+	{
+		free(sites[siteIndex].data);
+	}
+	free(sites);
+	fclose(file);
+
+	return numberOfFailures;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn long long EncodeTestFailureArguments(const char *format, va_list args, char *buffer, size_t size)
+ * @brief 포맷 문자열이 사용하는 인자 값들을 포맷팅하지 않고 바이너리로 기록하는 함수(RecordTestFailure 에서 사용)
+ * 정수와 포인터는 8 바이트, 실수는 그 형식의 크기로, 문자열은 길이(int, NULL 이면 -1)와 NULL 문자를 포함한 내용으로 기록한다.
+ * 형식 정보는 기록하지 않고 FormatTestFailureMessage 가 같은 포맷 문자열을 다시 해석한다.
+ * @param format 실패 메시지 포맷 문자열(입력)
+ * @param args 포맷 문자열의 인자 리스트(입력, 사용 후에는 정해지지 않은 상태가 되므로 va_copy 한 값을 전달한다)
+ * @param buffer 기록할 버퍼(출력, size 가 0 이면 NULL 가능)
+ * @param size 버퍼 크기(입력, 기록 길이가 더 크면 버퍼 내용은 정해지지 않으므로 필요한 크기로 다시 호출한다)
+ * @return 기록 길이(바이트), 기록할 수 없는 변환이 있으면 -1 반환
+ */
+long long EncodeTestFailureArguments(const char *format, va_list args, char *buffer, size_t size)
+{
+	long long length = 0;
+	const char *position = format;
+	while ((position = strchr(position, '%')) != NULL)
+	{
+		TestFailureArgument argument;
+		position = ParseFailureConversion(position, &argument);
+
+		long long integer = 0;
+		size_t valueSize = sizeof(long long);
+		const void *value = &integer;
+		double real = 0.0;
+		long double longReal = 0.0L;
+		void *pointer = NULL;
+		switch (argument)
+		{
+			case TestFailureArgumentNone:
+				continue;
+			case TestFailureArgumentInt:
+				integer = va_arg(args, int);
+				break;
+			case TestFailureArgumentLong:
+				integer = va_arg(args, long);
+				break;
+			case TestFailureArgumentLongLong:
+				integer = va_arg(args, long long);
+				break;
+			case TestFailureArgumentSize:
+				integer = (long long)va_arg(args, size_t);
+				break;
+			case TestFailureArgumentIntMax:
+				integer = (long long)va_arg(args, intmax_t);
+				break;
+			case TestFailureArgumentPtrDiff:
+				integer = (long long)va_arg(args, ptrdiff_t);
+				break;
+			case TestFailureArgumentDouble:
+				real = va_arg(args, double);
+				value = &real;
+				valueSize = sizeof(double);
+				break;
+			case TestFailureArgumentLongDouble:
+				longReal = va_arg(args, long double);
+				value = &longReal;
+				valueSize = sizeof(long double);
+				break;
+			case TestFailureArgumentPointer:
+				pointer = va_arg(args, void*);
+				value = &pointer;
+				valueSize = sizeof(void*);
+				break;
+			case TestFailureArgumentString:
+			{
+				// The string may be gone by report time, so its contents are copied
+				const char *string = va_arg(args, const char*);
+				int stringLength = (string != NULL) ? (int)strlen(string) : -1;
+				valueSize = sizeof(int) + ((string != NULL) ? (size_t)stringLength + 1 : 0);
+				if ((size_t)length + valueSize <= size)
+				{
+					memcpy(buffer + length, &stringLength, sizeof(int));
+					if (string != NULL)
+					{
+						memcpy(buffer + length + sizeof(int), string, (size_t)stringLength + 1);
+					}
+				}
+				length += (long long)valueSize;
+				continue;
+			}
+			default:
+				return -1;
+		}
+
+		if ((size_t)length + valueSize <= size)
+		{
+			memcpy(buffer + length, value, valueSize);
+		}
+		length += (long long)valueSize;
+	}
+
+	return length;
+}
+
+/**
+ * @fn int FormatTestFailureMessage(const char *format, const char *arguments, size_t argumentsLength, char *buffer, size_t size)
+ * @brief EncodeTestFailureArguments 로 기록한 인자 값으로 실패 메시지를 포맷팅하는 함수(리포터에 전달할 때와 ttdecode 에서 사용)
+ * 변환마다 기록된 값을 원래 형식으로 되돌려 snprintf 로 포맷팅하므로 printf 와 같은 결과를 만든다.
+ * @param format 실패 메시지 포맷 문자열(입력)
+ * @param arguments 인자 값 기록(입력)
+ * @param argumentsLength 인자 값 기록 길이(입력)
+ * @param buffer 메시지를 저장할 버퍼(출력, size 가 0 이면 NULL 가능)
+ * @param size 버퍼 크기(입력, 넘치는 메시지는 잘리고 항상 NULL 문자로 끝난다)
+ * @return 메시지 전체 길이(NULL 문자 제외, size 이상이면 잘린 것), 기록이 포맷 문자열과 맞지 않으면 -1 반환
+ */
+int FormatTestFailureMessage(const char *format, const char *arguments, size_t argumentsLength, char *buffer, size_t size)
+{
+	size_t length = 0;
+	size_t offset = 0;
+	const char *position = format;
+	while (*position != '\0')
+	{
+		if (*position != '%')
+		{
+			// Copy the text up to the next conversion at once
+			const char *next = strchr(position, '%');
+			size_t textLength = (next != NULL) ? (size_t)(next - position) : strlen(position);
+			length = AppendFailureText(buffer, size, length, position, textLength);
+			position += textLength;
+			continue;
+		}
+
+		TestFailureArgument argument;
+		const char *end = ParseFailureConversion(position, &argument);
+		if (argument == TestFailureArgumentUnsupported)
+		{
+			return -1;
+		}
+
+		size_t specLength = (size_t)(end - position);
+		char spec[TEST_FAILURE_SPEC_SIZE];
+		memcpy(spec, position, specLength);
+		spec[specLength] = '\0';
+		position = end;
+
+		if (argument == TestFailureArgumentNone)
+		{
+			length = AppendFailureText(buffer, size, length, "%", 1);
+			continue;
+		}
+
+		// Decimal and string conversions without flags, width or precision are the common case and skip snprintf
+		char type = spec[specLength - 1];
+		int plain = (strspn(spec + 1, "l") + 2 == specLength) ? TRUE : FALSE;
+
+		// Read the value in the size it was recorded with
+		size_t valueSize = sizeof(long long);
+		if (argument == TestFailureArgumentDouble)
+		{
+			valueSize = sizeof(double);
+		}
+		else if (argument == TestFailureArgumentLongDouble)
+		{
+			valueSize = sizeof(long double);
+		}
+		else if (argument == TestFailureArgumentPointer)
+		{
+			valueSize = sizeof(void*);
+		}
+		else if (argument == TestFailureArgumentString)
+		{
+			valueSize = sizeof(int);
+		}
+		if (offset + valueSize > argumentsLength)
+		{
+			return -1;
+		}
+
+		char *output = (length < size) ? buffer + length : NULL;
+		size_t available = (length < size) ? size - length : 0;
+		long long integer = 0;
+		double real = 0.0;
+		long double longReal = 0.0L;
+		void *pointer = NULL;
+		int stringLength = 0;
+		int written = 0;
+		switch (argument)
+		{
+			case TestFailureArgumentDouble:
+				memcpy(&real, arguments + offset, valueSize);
+				written = snprintf(output, available, spec, real);
+				break;
+			case TestFailureArgumentLongDouble:
+				memcpy(&longReal, arguments + offset, valueSize);
+				written = snprintf(output, available, spec, longReal);
+				break;
+			case TestFailureArgumentPointer:
+				memcpy(&pointer, arguments + offset, valueSize);
+				written = snprintf(output, available, spec, pointer);
+				break;
+			case TestFailureArgumentString:
+				memcpy(&stringLength, arguments + offset, valueSize);
+				if (stringLength >= 0 && (offset + valueSize + (size_t)stringLength + 1 > argumentsLength || arguments[offset + valueSize + (size_t)stringLength] != '\0'))
+				{
+					return -1;
+				}
+				if (plain == TRUE)
+				{
+					length = (stringLength >= 0) ? AppendFailureText(buffer, size, length, arguments + offset + valueSize, (size_t)stringLength) : AppendFailureText(buffer, size, length, "(null)", 6);
+				}
+				else
+				{
+					written = snprintf(output, available, spec, (stringLength >= 0) ? arguments + offset + valueSize : NULL);
+				}
+				valueSize += (stringLength >= 0) ? (size_t)stringLength + 1 : 0;
+				break;
+			default:
+				memcpy(&integer, arguments + offset, valueSize);
+				if (plain == TRUE && (type == 'd' || type == 'i') && argument <= TestFailureArgumentLongLong)
+				{
+					length = AppendFailureDecimal(buffer, size, length, integer);
+				}
+				else if (argument == TestFailureArgumentInt)
+				{
+					written = snprintf(output, available, spec, (int)integer);
+				}
+				else if (argument == TestFailureArgumentLong)
+				{
+					written = snprintf(output, available, spec, (long)integer);
+				}
+				else if (argument == TestFailureArgumentSize)
+				{
+					written = snprintf(output, available, spec, (size_t)integer);
+				}
+				else if (argument == TestFailureArgumentIntMax)
+				{
+					written = snprintf(output, available, spec, (intmax_t)integer);
+				}
+				else if (argument == TestFailureArgumentPtrDiff)
+				{
+					written = snprintf(output, available, spec, (ptrdiff_t)integer);
+				}
+				else
+				{
+					written = snprintf(output, available, spec, integer);
+				}
+				break;
+		}
+		if (written < 0)
+		{
+			return -1;
+		}
+
+		offset += valueSize;
+		length += (size_t)written;
+	}
+
+	if (size > 0)
+	{
+		buffer[(length < size) ? length : size - 1] = '\0';
+	}
+
+	return (int)length;
+}
+
+/**
+ * @fn int OpenTestFailureLog(TestSuitPtr testSuit)
+ * @brief --failure-log 로 지정한 실패 기록 파일을 새로 만드는 함수(이미 열려 있으면 닫고 다시 만든다)
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공(또는 지정하지 않음) 시 0, 실패 시 -1 반환
+ */
+int OpenTestFailureLog(TestSuitPtr testSuit)
+{
+	CloseTestFailureLog(testSuit);
+	if (testSuit->options.failureLogPath == NULL)
+	{
+		return 0;
+	}
+
+	TestFailureLogPtr log = (TestFailureLogPtr)calloc(1, sizeof(TestFailureLog));
+	if (log == NULL)
+	{
+		return -1;
+	}
+
+	log->capacity = TEST_FAILURE_SITE_TABLE_SIZE;
+	log->sites = (const TestFailureSite**)calloc((size_t)log->capacity, sizeof(TestFailureSite*));
+	log->siteIds = (int*)calloc((size_t)log->capacity, sizeof(int));
+	log->file = fopen(testSuit->options.failureLogPath, "wb");
+	log->testIndex = -1;
+	if (log->sites == NULL || log->siteIds == NULL || log->file == NULL || fwrite(TEST_FAILURE_LOG_MAGIC, 1, sizeof(TEST_FAILURE_LOG_MAGIC), log->file) != sizeof(TEST_FAILURE_LOG_MAGIC))
+	{
+		if (log->file != NULL)
+		{
+			fclose(log->file);
+		}
+		free(log->sites);
+		free(log->siteIds);
+		free(log);
+		return -1;
+	}
+
+	testSuit->failureLogFile = log;
+
+	return 0;
+}
+
+/**
+ * @fn void WriteTestFailureLog(TestSuitPtr testSuit, int testIndex, const TestFailureRecord *record, const char *data)
+ * @brief 테스트의 실패 기록 하나를 포맷팅하지 않고 실패 기록 파일에 추가하는 함수(ReplayTestResult 에서 리포터 뮤텍스를 잡은 채 호출)
+ * 테스트가 바뀌면 테스트 항목을, 호출 위치가 처음 나오면 기술자 항목을 먼저 기록한다. 실패 기록 파일을 지정하지 않았으면 아무것도 하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param testIndex 테스트 번호(입력)
+ * @param record 실패 기록 헤더(입력)
+ * @param data 헤더 뒤에 붙은 데이터(입력)
+ * @return 반환값 없음
+ */
+void WriteTestFailureLog(TestSuitPtr testSuit, int testIndex, const TestFailureRecord *record, const char *data)
+{
+	TestFailureLogPtr log = testSuit->failureLogFile;
+	if (log == NULL)
+	{
+		return;
+	}
+
+	if (log->testIndex != testIndex)
+	{
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		size_t caseLength = strlen(test->testCase) + 1;
+		size_t nameLength = strlen(test->testName) + 1;
+		char *names = (char*)malloc(caseLength + nameLength);
+		if (names == NULL)
+		{
+			log->error = TRUE;
+			return;
+		}
+		memcpy(names, test->testCase, caseLength);
+		memcpy(names + caseLength, test->testName, nameLength);
+		WriteFailureLogEntry(log, TestFailureLogTest, testIndex, 0, names, caseLength + nameLength);
+		free(names);
+		log->testIndex = testIndex;
+	}
+
+	if (record->site == NULL)
+	{
+		size_t length = (size_t)record->macroLength + (size_t)record->fileLength + (size_t)record->messageLength + 3;
+		WriteFailureLogEntry(log, TestFailureLogMessage, 0, record->lineNumber, data, length);
+		return;
+	}
+
+	int isNew = FALSE;
+	int siteId = GetFailureSiteId(log, record->site, &isNew);
+	if (siteId < 0)
+	{
+		log->error = TRUE;
+		return;
+	}
+
+	if (isNew == TRUE)
+	{
+		const TestFailureSite *site = record->site;
+		size_t macroLength = strlen(site->macroName) + 1;
+		size_t fileLength = strlen(site->fileName) + 1;
+		size_t formatLength = strlen(site->format) + 1;
+		char *strings = (char*)malloc(macroLength + fileLength + formatLength);
+		if (strings == NULL)
+		{
+			log->error = TRUE;
+			return;
+		}
+		memcpy(strings, site->macroName, macroLength);
+		memcpy(strings + macroLength, site->fileName, fileLength);
+		memcpy(strings + macroLength + fileLength, site->format, formatLength);
+		WriteFailureLogEntry(log, TestFailureLogSite, siteId, site->lineNumber, strings, macroLength + fileLength + formatLength);
+		free(strings);
+	}
+
+	WriteFailureLogEntry(log, TestFailureLogFailure, siteId, 0, data, (size_t)record->messageLength);
+}
+
+/**
+ * @fn void FlushTestFailureLog(TestSuitPtr testSuit)
+ * @brief 실패 기록 파일의 출력 버퍼를 비우는 함수(작업자 프로세스를 만들기 전에 호출)
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 반환값 없음
+ */
+void FlushTestFailureLog(TestSuitPtr testSuit)
+{
+	TestFailureLogPtr log = testSuit->failureLogFile;
+	if (log != NULL && fflush(log->file) != 0)
+	{
+		log->error = TRUE;
+	}
+}
+
+/**
+ * @fn int CloseTestFailureLog(TestSuitPtr testSuit)
+ * @brief 실패 기록 파일을 닫고 출력 상태를 삭제하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 모든 기록을 저장했으면(또는 열린 파일이 없으면) 0, 쓰기에 실패했으면 -1 반환
+ */
+int CloseTestFailureLog(TestSuitPtr testSuit)
+{
+	TestFailureLogPtr log = testSuit->failureLogFile;
+	if (log == NULL)
+	{
+		return 0;
+	}
+
+	int result = (fclose(log->file) != 0 || log->error == TRUE) ? -1 : 0;
+	free(log->sites);
+	free(log->siteIds);
+	free(log);
+	testSuit->failureLogFile = NULL;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static const char *ParseFailureConversion(const char *conversion, TestFailureArgument *argument)
+ * @brief 포맷 문자열의 변환 하나('%' 부터)를 해석하여 사용하는 인자 형식을 구하는 함수
+ * 플래그, 폭, 정밀도, 길이 수정자를 지원하며, '*' 폭, 위치 지정('$'), %n, %m, 넓은 문자 변환은 기록할 수 없는 변환으로 본다.
+ * @param conversion '%' 문자 위치(입력)
+ * @param argument 인자 형식(출력)
+ * @return 변환 다음 문자 위치 반환
+ */
+static const char *ParseFailureConversion(const char *conversion, TestFailureArgument *argument)
+{
+	const char *position = conversion + 1;
+	*argument = TestFailureArgumentUnsupported;
+	if (*position == '%')
+	{
+		*argument = TestFailureArgumentNone;
+		return position + 1;
+	}
+
+	// Flags, width and precision
+	while (*position != '\0' && strchr("-+ #0'", *position) != NULL)
+	{
+		position++;
+	}
+	while (isdigit((unsigned char)*position))
+	{
+		position++;
+	}
+	if (*position == '.')
+	{
+		position++;
+		while (isdigit((unsigned char)*position))
+		{
+			position++;
+		}
+	}
+
+	// Length modifier
+	char modifier = '\0';
+	if (*position != '\0' && strchr("hlLqjzZt", *position) != NULL)
+	{
+		modifier = *position++;
+		if ((modifier == 'h' || modifier == 'l') && *position == modifier)
+		{
+			// hh stays an int, ll is stored as long long
+			modifier = (modifier == 'l') ? 'q' : 'h';
+			position++;
+		}
+	}
+
+	char type = *position;
+	if (type == '\0' || position - conversion + 2 > TEST_FAILURE_SPEC_SIZE)
+	{
+		return (type == '\0') ? position : position + 1;
+	}
+
+	if (strchr("diouxXc", type) != NULL)
+	{
+		switch (modifier)
+		{
+			case '\0':
+			case 'h':
+				*argument = TestFailureArgumentInt;
+				break;
+			case 'l':
+				*argument = (type == 'c') ? TestFailureArgumentUnsupported : TestFailureArgumentLong;
+				break;
+			case 'q':
+			case 'L':
+				*argument = TestFailureArgumentLongLong;
+				break;
+			case 'j':
+				*argument = TestFailureArgumentIntMax;
+				break;
+			case 'z':
+			case 'Z':
+				*argument = TestFailureArgumentSize;
+				break;
+			case 't':
+				*argument = TestFailureArgumentPtrDiff;
+				break;
+			default:
+				break;
+		}
+	}
+	else if (strchr("feEgGaA", type) != NULL)
+	{
+		if (modifier == 'L')
+		{
+			*argument = TestFailureArgumentLongDouble;
+		}
+		else if (modifier == '\0' || modifier == 'l')
+		{
+			*argument = TestFailureArgumentDouble;
+		}
+	}
+	else if (type == 'p' && modifier == '\0')
+	{
+		*argument = TestFailureArgumentPointer;
+	}
+	else if (type == 's' && modifier == '\0')
+	{
+		*argument = TestFailureArgumentString;
+	}
+
+	return position + 1;
+}
+
+/**
+ * @fn static size_t AppendFailureText(char *buffer, size_t size, size_t length, const char *text, size_t textLength)
+ * @brief 포맷팅 중인 메시지 뒤에 문자열을 버퍼 크기만큼 이어 붙이는 함수(NULL 문자는 마지막에 붙인다)
+ * @param buffer 메시지 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @param length 지금까지의 메시지 길이(입력)
+ * @param text 이어 붙일 문자열(입력)
+ * @param textLength 이어 붙일 문자열 길이(입력)
+ * @return 이어 붙인 뒤의 메시지 길이(잘린 부분 포함) 반환
+ */
+static size_t AppendFailureText(char *buffer, size_t size, size_t length, const char *text, size_t textLength)
+{
+	if (length + 1 < size)
+	{
+		size_t copyLength = (textLength < size - length - 1) ? textLength : size - length - 1;
+		memcpy(buffer + length, text, copyLength);
+	}
+
+	return length + textLength;
+}
+
+/**
+ * @fn static size_t AppendFailureDecimal(char *buffer, size_t size, size_t length, long long value)
+ * @brief 포맷팅 중인 메시지 뒤에 정수를 10 진수로 이어 붙이는 함수(%d 와 같은 결과)
+ * @param buffer 메시지 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @param length 지금까지의 메시지 길이(입력)
+ * @param value 정수 값(입력)
+ * @return 이어 붙인 뒤의 메시지 길이(잘린 부분 포함) 반환
+ */
+static size_t AppendFailureDecimal(char *buffer, size_t size, size_t length, long long value)
+{
+	char digits[24];
+	char *position = digits + sizeof(digits);
+
+	// Work on the magnitude as unsigned so that the smallest value does not overflow
+	unsigned long long magnitude = (value < 0) ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+	do
+	{
+		*--position = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+	if (value < 0)
+	{
+		*--position = '-';
+	}
+
+	return AppendFailureText(buffer, size, length, position, (size_t)(digits + sizeof(digits) - position));
+}
+
+/**
+ * @fn static int GetFailureSiteId(TestFailureLogPtr log, const TestFailureSite *site, int *isNew)
+ * @brief 호출 위치 기술자의 번호를 찾고, 처음 나온 기술자이면 새 번호를 붙이는 함수
+ * @param log 실패 기록 파일의 출력 상태(입력, 출력)
+ * @param site 호출 위치 기술자(입력)
+ * @param isNew 새 번호를 붙였는지 여부(출력)
+ * @return 성공 시 호출 위치 번호, 실패 시 -1 반환
+ */
+static int GetFailureSiteId(TestFailureLogPtr log, const TestFailureSite *site, int *isNew)
+{
+	// Keep the table at most half full
+	if ((log->numberOfSites + 1) * 2 > log->capacity)
+	{
+		int capacity = log->capacity * 2;
+		const TestFailureSite **sites = (const TestFailureSite**)calloc((size_t)capacity, sizeof(TestFailureSite*));
+		int *siteIds = (int*)calloc((size_t)capacity, sizeof(int));
+		if (sites == NULL || siteIds == NULL)
+		{
+			free(sites);
+			free(siteIds);
+			return -1;
+		}
+
+		int slot = 0;
+		for (; slot < log->capacity; slot++)
+		{
+			if (log->sites[slot] == NULL)
+			{
+				continue;
+			}
+			size_t newSlot = ((uintptr_t)log->sites[slot] >> 3) & (size_t)(capacity - 1);
+			while (sites[newSlot] != NULL)
+			{
+				newSlot = (newSlot + 1) & (size_t)(capacity - 1);
+			}
+			sites[newSlot] = log->sites[slot];
+			siteIds[newSlot] = log->siteIds[slot];
+		}
+
+		free(log->sites);
+		free(log->siteIds);
+		log->sites = sites;
+		log->siteIds = siteIds;
+		log->capacity = capacity;
+	}
+
+	size_t slot = ((uintptr_t)site >> 3) & (size_t)(log->capacity - 1);
+	while (log->sites[slot] != NULL)
+	{
+		if (log->sites[slot] == site)
+		{
+			*isNew = FALSE;
+			return log->siteIds[slot];
+		}
+		slot = (slot + 1) & (size_t)(log->capacity - 1);
+	}
+
+	log->sites[slot] = site;
+	log->siteIds[slot] = log->numberOfSites++;
+	*isNew = TRUE;
+
+	return log->siteIds[slot];
+}
+
+/**
+ * @fn static void WriteFailureLogEntry(TestFailureLogPtr log, int type, int id, int lineNumber, const char *data, size_t length)
+ * @brief 실패 기록 파일에 항목 하나를 쓰는 함수(실패하면 쓰기 실패로 표시한다)
+ * @param log 실패 기록 파일의 출력 상태(입력, 출력)
+ * @param type 항목 종류(입력)
+ * @param id 호출 위치 번호 또는 테스트 번호(입력)
+ * @param lineNumber 소스 줄 번호(입력)
+ * @param data 항목 데이터(입력)
+ * @param length 항목 데이터 길이(입력)
+ * @return 반환값 없음
+ */
+static void WriteFailureLogEntry(TestFailureLogPtr log, int type, int id, int lineNumber, const char *data, size_t length)
+{
+	TestFailureLogEntry entry;
+	entry.type = type;
+	entry.id = id;
+	entry.lineNumber = lineNumber;
+	entry.length = (int)length;
+
+	if (fwrite(&entry, sizeof(entry), 1, log->file) != 1 || (length > 0 && fwrite(data, 1, length, log->file) != length))
+	{
+		log->error = TRUE;
+	}
+}
+
+/**
+ * @fn static int ReadFailureLogStrings(const char *data, int length, const char **strings, int numberOfStrings)
+ * @brief 항목 데이터에서 NULL 문자로 구분된 문자열들의 위치를 구하는 함수
+ * @param data 항목 데이터(입력, data[length] 는 NULL 문자)
+ * @param length 항목 데이터 길이(입력)
+ * @param strings 문자열 위치 리스트(출력)
+ * @param numberOfStrings 구할 문자열 개수(입력)
+ * @return 성공 시 0, 문자열이 모자라면 -1 반환
+ */
+static int ReadFailureLogStrings(const char *data, int length, const char **strings, int numberOfStrings)
+{
+	int offset = 0;
+	int stringIndex = 0;
+	for (; stringIndex < numberOfStrings; stringIndex++)
+	{
+		if (offset >= length)
+		{
+			return -1;
+		}
+		strings[stringIndex] = data + offset;
+		offset += (int)strlen(data + offset) + 1;
+	}
+
+	return (offset <= length) ? 0 : -1;
+}
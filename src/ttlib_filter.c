@@ -0,0 +1,621 @@
+#include "ttlib_internal.h"
+
+#include <fnmatch.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 해시 테이블의 빈 슬롯을 나타내는 값
+#define TEST_NAME_INDEX_EMPTY (-1)
+
+// 등록된 테스트 이름(testCase.testName)과 테스트 케이스 이름에 대한 해시 인덱스(개방 주소법)
+// 정확한 이름과 "testCase.*" 패턴은 이 인덱스로 찾으므로 선택 비용이 전체 테스트 개수가 아닌 일치하는 테스트 개수에 비례한다.
+typedef struct _test_name_index_t
+{
+	// 해시 테이블 크기(2 의 거듭제곱)
+	int capacity;
+	// 전체 이름별 테스트 번호 슬롯
+	int *nameSlots;
+	// 테스트 케이스 이름별 첫 번째 테스트 번호 슬롯
+	int *caseSlots;
+	// 같은 테스트 케이스의 다음 테스트 번호(테스트 번호 오름차순, 없으면 TEST_NAME_INDEX_EMPTY)
+	int *nextInCase;
+} TestNameIndex, *TestNameIndexPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static TestNameIndexPtr GetTestNameIndex(TestSuitPtr testSuit);
+static unsigned int HashString(unsigned int hash, const char *text, size_t length);
+static unsigned int HashTestName(const char *testCase, size_t caseLength, const char *testName);
+static int LookupTestCase(TestSuitPtr testSuit, TestNameIndexPtr index, const char *testCase, size_t caseLength);
+static int MatchTestName(TestPtr test, const char *pattern);
+static int MatchAnyPattern(TestPtr test, char *patterns);
+static int HasGlobCharacter(const char *text, size_t length);
+static int SelectByPattern(TestSuitPtr testSuit, const char *pattern, int *selected, int numberOfSelected, int *capacity, int **selectedContainer);
+static int IsSelectableTest(TestSuitPtr testSuit, int testIndex);
+static int SelectFuzzTarget(TestSuitPtr testSuit, int *selected);
+static int CompareTestIndexes(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int FindTest(TestSuitPtr testSuit, const char *testCase, const char *testName)
+ * @brief 테스트 케이스 이름과 테스트 이름으로 등록된 테스트의 번호를 찾는 함수(해시 인덱스 사용)
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testCase 테스트 케이스 이름(입력)
+ * @param testName 테스트 이름(입력)
+ * @return 성공 시 테스트 번호(0 부터 시작), 없거나 실패 시 -1 반환
+ */
+int FindTest(TestSuitPtr testSuit, const char *testCase, const char *testName)
+{
+	// Check parameter
+	if (testSuit == NULL || testCase == NULL || testName == NULL)
+	{
+		return -1;
+	}
+
+	TestNameIndexPtr index = GetTestNameIndex(testSuit);
+	if (index == NULL)
+	{
+		return -1;
+	}
+
+	size_t caseLength = strlen(testCase);
+	unsigned int mask = (unsigned int)index->capacity - 1;
+	unsigned int slot = HashTestName(testCase, caseLength, testName) & mask;
+	while (index->nameSlots[slot] != TEST_NAME_INDEX_EMPTY)
+	{
+		TestPtr test = testSuit->testPtrContainer[index->nameSlots[slot]];
+		if (strcmp(test->testCase, testCase) == 0 && strcmp(test->testName, testName) == 0)
+		{
+			return index->nameSlots[slot];
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int SelectTests(TestSuitPtr testSuit)
+ * @brief 실행 옵션의 필터에 맞는 테스트들을 골라 실행할 테스트 번호 리스트(selectedTests)를 만드는 함수
+ * 필터 형식 : 양성패턴[:양성패턴...][-음성패턴[:음성패턴...]] (패턴은 testCase.testName 에 대한 glob, 예: "Str*.*-*.Slow*")
+ * 정확한 이름과 "testCase.*" 형태의 양성 패턴은 해시 인덱스로 찾고, 그 밖의 glob 패턴만 전체 테스트를 검사한다.
+ * 선택된 테스트는 테스트 번호(정의 순서) 순서로 정렬된다. 벤치마크 모드이면 벤치마크만, 퍼징 모드이면 지정한 퍼징 테스트만 선택한다.
+ * 감시 모드가 바뀐 소스 파일을 지정했으면 그 파일들에 정의된 테스트만 선택한다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 선택된 테스트 개수, 실패 시 -1 반환
+ */
+int SelectTests(TestSuitPtr testSuit)
+{
+	int numberOfTests = testSuit->numberOfTests;
+	const char *filter = testSuit->options.filter;
+
+	free(testSuit->selectedTests);
+	testSuit->selectedTests = NULL;
+	testSuit->numberOfSelectedTests = 0;
+
+	int capacity = (filter == NULL) ? numberOfTests : 16;
+	int *selected = (int*)malloc(sizeof(int) * (size_t)((capacity > 0) ? capacity : 1));
+	if (selected == NULL)
+	{
+		return -1;
+	}
+
+	// Fuzzing mode selects only the named fuzz test regardless of the filter
+	if (testSuit->options.fuzzTarget != NULL)
+	{
+		testSuit->selectedTests = selected;
+		testSuit->numberOfSelectedTests = SelectFuzzTarget(testSuit, selected);
+		return testSuit->numberOfSelectedTests;
+	}
+
+	// Without a filter every test is selected in definition order
+	if (filter == NULL)
+	{
+		int numberOfSelected = 0;
+		int testIndex = 0;
+		for (; testIndex < numberOfTests; testIndex++)
+		{
+			if (IsSelectableTest(testSuit, testIndex) == TRUE)
+			{
+				selected[numberOfSelected++] = testIndex;
+			}
+		}
+		testSuit->selectedTests = selected;
+		testSuit->numberOfSelectedTests = numberOfSelected;
+		return numberOfSelected;
+	}
+
+	// Split the filter into the positive and negative pattern lists
+	char *positives = strdup(filter);
+	if (positives == NULL)
+	{
+		free(selected);
+		return -1;
+	}
+	char *negatives = strchr(positives, '-');
+	if (negatives != NULL)
+	{
+		*negatives++ = '\0';
+	}
+
+	int numberOfSelected = 0;
+	char *next = positives;
+	do
+	{
+		char *pattern = next;
+		next = strchr(pattern, ':');
+		if (next != NULL)
+		{
+			*next++ = '\0';
+		}
+
+		numberOfSelected = SelectByPattern(testSuit, (*pattern == '\0') ? "*" : pattern, selected, numberOfSelected, &capacity, &selected);
+		if (numberOfSelected < 0)
+		{
+			free(positives);
+			free(selected);
+			return -1;
+		}
+	} while (next != NULL);
+
+	// Sort into definition order and remove duplicates matched by several patterns
+	qsort(selected, (size_t)numberOfSelected, sizeof(int), CompareTestIndexes);
+	int numberOfUnique = 0;
+	int selectedIndex = 0;
+	for (; selectedIndex < numberOfSelected; selectedIndex++)
+	{
+		if (numberOfUnique > 0 && selected[numberOfUnique - 1] == selected[selectedIndex])
+		{
+			continue;
+		}
+		if (IsSelectableTest(testSuit, selected[selectedIndex]) == FALSE)
+		{
+			continue;
+		}
+		if (negatives != NULL && MatchAnyPattern(testSuit->testPtrContainer[selected[selectedIndex]], negatives) == TRUE)
+		{
+			continue;
+		}
+		selected[numberOfUnique++] = selected[selectedIndex];
+	}
+
+	free(positives);
+	testSuit->selectedTests = selected;
+	testSuit->numberOfSelectedTests = numberOfUnique;
+
+	return numberOfUnique;
+}
+
+/**
+ * @fn void DeleteTestNameIndex(TestSuitPtr testSuit)
+ * @brief TestSuit 객체의 테스트 이름 해시 인덱스를 삭제하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestNameIndex(TestSuitPtr testSuit)
+{
+	TestNameIndexPtr index = testSuit->nameIndex;
+	if (index == NULL)
+	{
+		return;
+	}
+
+	free(index->nameSlots);
+	free(index);
+	testSuit->nameIndex = NULL;
+}
+
+/**
+ * @fn void PrintTestList(TestSuitPtr testSuit)
+ * @brief 선택된 테스트들의 이름을 한 줄에 하나씩 testCase.testName 형식으로 출력하는 함수(--list 옵션)
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 반환값 없음
+ */
+void PrintTestList(TestSuitPtr testSuit)
+{
+	int selectedIndex = 0;
+	for (; selectedIndex < testSuit->numberOfSelectedTests; selectedIndex++)
+	{
+		TestPtr test = testSuit->testPtrContainer[testSuit->selectedTests[selectedIndex]];
+		printf("%s.%s\n", test->testCase, test->testName);
+	}
+	fflush(stdout);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static TestNameIndexPtr GetTestNameIndex(TestSuitPtr testSuit)
+ * @brief 테스트 이름 해시 인덱스를 반환하는 함수(처음 호출될 때 한 번만 생성한다)
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 해시 인덱스, 실패 시 NULL 반환
+ */
+static TestNameIndexPtr GetTestNameIndex(TestSuitPtr testSuit)
+{
+	if (testSuit->nameIndex != NULL)
+	{
+		return testSuit->nameIndex;
+	}
+
+	int numberOfTests = testSuit->numberOfTests;
+
+	// Keep the load factor at or below one half
+	int capacity = 16;
+	while (capacity < numberOfTests * 2)
+	{
+		capacity *= 2;
+	}
+
+	TestNameIndexPtr index = (TestNameIndexPtr)malloc(sizeof(TestNameIndex));
+	if (index == NULL)
+	{
+		return NULL;
+	}
+
+	// The three arrays share one allocation
+	index->capacity = capacity;
+	index->nameSlots = (int*)malloc(sizeof(int) * ((size_t)capacity * 2 + (size_t)numberOfTests));
+	if (index->nameSlots == NULL)
+	{
+		free(index);
+		return NULL;
+	}
+	index->caseSlots = index->nameSlots + capacity;
+	index->nextInCase = index->caseSlots + capacity;
+	memset(index->nameSlots, 0xff, sizeof(int) * (size_t)capacity * 2);
+
+	unsigned int mask = (unsigned int)capacity - 1;
+
+	// Insert in reverse order so that each test case chain is in ascending order
+	int testIndex = numberOfTests - 1;
+	for (; testIndex >= 0; testIndex--)
+	{
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		size_t caseLength = strlen(test->testCase);
+
+		unsigned int slot = HashTestName(test->testCase, caseLength, test->testName) & mask;
+		while (index->nameSlots[slot] != TEST_NAME_INDEX_EMPTY)
+		{
+			slot = (slot + 1) & mask;
+		}
+		index->nameSlots[slot] = testIndex;
+
+		slot = HashString(2166136261u, test->testCase, caseLength) & mask;
+		while (index->caseSlots[slot] != TEST_NAME_INDEX_EMPTY && strcmp(testSuit->testPtrContainer[index->caseSlots[slot]]->testCase, test->testCase) != 0)
+		{
+			slot = (slot + 1) & mask;
+		}
+		index->nextInCase[testIndex] = index->caseSlots[slot];
+		index->caseSlots[slot] = testIndex;
+	}
+
+	testSuit->nameIndex = index;
+
+	return index;
+}
+
+/**
+ * @fn static unsigned int HashString(unsigned int hash, const char *text, size_t length)
+ * @brief 문자열을 FNV-1a 방식으로 해시 값에 누적하는 함수
+ * @param hash 누적할 해시 값(입력)
+ * @param text 문자열(입력)
+ * @param length 문자열 길이(입력)
+ * @return 누적된 해시 값 반환
+ */
+static unsigned int HashString(unsigned int hash, const char *text, size_t length)
+{
+	size_t position = 0;
+	for (; position < length; position++)
+	{
+		hash ^= (unsigned char)text[position];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ * @fn static unsigned int HashTestName(const char *testCase, size_t caseLength, const char *testName)
+ * @brief 전체 테스트 이름(testCase.testName)의 해시 값을 계산하는 함수
+ * @param testCase 테스트 케이스 이름(입력)
+ * @param caseLength 테스트 케이스 이름 길이(입력)
+ * @param testName 테스트 이름(입력)
+ * @return 해시 값 반환
+ */
+static unsigned int HashTestName(const char *testCase, size_t caseLength, const char *testName)
+{
+	unsigned int hash = HashString(2166136261u, testCase, caseLength);
+	hash = HashString(hash, ".", 1);
+
+	return HashString(hash, testName, strlen(testName));
+}
+
+/**
+ * @fn static int LookupTestCase(TestSuitPtr testSuit, TestNameIndexPtr index, const char *testCase, size_t caseLength)
+ * @brief 테스트 케이스 이름으로 그 케이스의 첫 번째 테스트 번호를 찾는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param index 해시 인덱스(입력)
+ * @param testCase 테스트 케이스 이름(NULL 문자로 끝나지 않아도 된다, 입력)
+ * @param caseLength 테스트 케이스 이름 길이(입력)
+ * @return 성공 시 첫 번째 테스트 번호, 없으면 TEST_NAME_INDEX_EMPTY 반환
+ */
+static int LookupTestCase(TestSuitPtr testSuit, TestNameIndexPtr index, const char *testCase, size_t caseLength)
+{
+	unsigned int mask = (unsigned int)index->capacity - 1;
+	unsigned int slot = HashString(2166136261u, testCase, caseLength) & mask;
+	while (index->caseSlots[slot] != TEST_NAME_INDEX_EMPTY)
+	{
+		const char *candidate = testSuit->testPtrContainer[index->caseSlots[slot]]->testCase;
+		if (strncmp(candidate, testCase, caseLength) == 0 && candidate[caseLength] == '\0')
+		{
+			return index->caseSlots[slot];
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	return TEST_NAME_INDEX_EMPTY;
+}
+
+/**
+ * @fn static int MatchTestName(TestPtr test, const char *pattern)
+ * @brief 전체 테스트 이름(testCase.testName)이 glob 패턴과 일치하는지 검사하는 함수
+ * '.' 이 없는 패턴은 테스트 케이스 이름과 일치해도 일치한 것으로 본다(예: "StrLib" 은 StrLib 케이스 전체).
+ * @param test 검사할 테스트(입력)
+ * @param pattern glob 패턴(입력)
+ * @return 일치하면 TRUE, 아니면 FALSE 반환
+ */
+static int MatchTestName(TestPtr test, const char *pattern)
+{
+	char stackName[256];
+	char *name = stackName;
+
+	size_t length = strlen(test->testCase) + strlen(test->testName) + 2;
+	if (length > sizeof(stackName))
+	{
+		name = (char*)malloc(length);
+		if (name == NULL)
+		{
+			return FALSE;
+		}
+	}
+	snprintf(name, length, "%s.%s", test->testCase, test->testName);
+
+	int result = (fnmatch(pattern, name, 0) == 0) ? TRUE : FALSE;
+	if (result == FALSE && strchr(pattern, '.') == NULL)
+	{
+		result = (fnmatch(pattern, test->testCase, 0) == 0) ? TRUE : FALSE;
+	}
+	if (name != stackName)
+	{
+		free(name);
+	}
+
+	return result;
+}
+
+/**
+ * @fn static int MatchAnyPattern(TestPtr test, char *patterns)
+ * @brief 전체 테스트 이름이 ':' 로 구분된 패턴들 중 하나라도 일치하는지 검사하는 함수
+ * @param test 검사할 테스트(입력)
+ * @param patterns ':' 로 구분된 glob 패턴 리스트(입력, 검사 중에만 일시적으로 변경된다)
+ * @return 일치하면 TRUE, 아니면 FALSE 반환
+ */
+static int MatchAnyPattern(TestPtr test, char *patterns)
+{
+	char *pattern = patterns;
+	while (pattern != NULL)
+	{
+		char *next = strchr(pattern, ':');
+		if (next != NULL)
+		{
+			*next = '\0';
+		}
+
+		int result = (*pattern != '\0') ? MatchTestName(test, pattern) : FALSE;
+
+		if (next != NULL)
+		{
+			*next++ = ':';
+		}
+		if (result == TRUE)
+		{
+			return TRUE;
+		}
+		pattern = next;
+	}
+
+	return FALSE;
+}
+
+/**
+ * @fn static int HasGlobCharacter(const char *text, size_t length)
+ * @brief 문자열에 glob 특수 문자(*, ?, [, \)가 있는지 검사하는 함수
+ * @param text 검사할 문자열(입력)
+ * @param length 검사할 길이(입력)
+ * @return 있으면 TRUE, 없으면 FALSE 반환
+ */
+static int HasGlobCharacter(const char *text, size_t length)
+{
+	size_t position = 0;
+	for (; position < length; position++)
+	{
+		if (text[position] == '*' || text[position] == '?' || text[position] == '[' || text[position] == '\\')
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/**
+ * @fn static int SelectByPattern(TestSuitPtr testSuit, const char *pattern, int *selected, int numberOfSelected, int *capacity, int **selectedContainer)
+ * @brief 양성 패턴 하나와 일치하는 테스트 번호들을 선택 리스트에 추가하는 함수
+ * "testCase.testName" 은 전체 이름 해시로, "testCase.*" 와 "testCase" 는 테스트 케이스 해시로 찾고, 나머지는 전체 테스트를 검사한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param pattern 양성 패턴(입력)
+ * @param selected 선택 리스트(입력)
+ * @param numberOfSelected 선택 리스트에 저장된 개수(입력)
+ * @param capacity 선택 리스트 크기(입력, 출력)
+ * @param selectedContainer 크기가 늘어난 선택 리스트를 저장할 포인터(출력)
+ * @return 성공 시 선택 리스트에 저장된 개수, 실패 시 -1 반환
+ */
+static int SelectByPattern(TestSuitPtr testSuit, const char *pattern, int *selected, int numberOfSelected, int *capacity, int **selectedContainer)
+{
+	TestNameIndexPtr index = GetTestNameIndex(testSuit);
+	if (index == NULL)
+	{
+		return -1;
+	}
+
+	const char *dot = strchr(pattern, '.');
+	size_t caseLength = (dot != NULL) ? (size_t)(dot - pattern) : strlen(pattern);
+	int caseIsExact = (HasGlobCharacter(pattern, caseLength) == FALSE) ? TRUE : FALSE;
+
+	int testIndex = TEST_NAME_INDEX_EMPTY;
+	int scanAll = FALSE;
+	int wholeCase = FALSE;
+	int exactName = FALSE;
+	if (caseIsExact == TRUE && (dot == NULL || strcmp(dot, ".*") == 0))
+	{
+		// "testCase" or "testCase.*" selects a whole test case chain
+		testIndex = LookupTestCase(testSuit, index, pattern, caseLength);
+		wholeCase = TRUE;
+	}
+	else if (caseIsExact == TRUE && HasGlobCharacter(dot + 1, strlen(dot + 1)) == FALSE)
+	{
+		// An exact name selects at most one test
+		char *testCase = strndup(pattern, caseLength);
+		if (testCase == NULL)
+		{
+			return -1;
+		}
+		testIndex = FindTest(testSuit, testCase, dot + 1);
+		free(testCase);
+		exactName = TRUE;
+	}
+	else if (caseIsExact == TRUE)
+	{
+		// Only the tests of one test case can match
+		testIndex = LookupTestCase(testSuit, index, pattern, caseLength);
+	}
+	else
+	{
+		testIndex = 0;
+		scanAll = TRUE;
+	}
+
+	while (testIndex >= 0 && testIndex < testSuit->numberOfTests)
+	{
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		if (wholeCase == TRUE || exactName == TRUE || MatchTestName(test, pattern) == TRUE)
+		{
+			if (numberOfSelected == *capacity)
+			{
+				int *grown = (int*)realloc(selected, sizeof(int) * (size_t)(*capacity) * 2);
+				if (grown == NULL)
+				{
+					return -1;
+				}
+				selected = grown;
+				*selectedContainer = grown;
+				*capacity *= 2;
+			}
+			selected[numberOfSelected++] = testIndex;
+		}
+
+		if (scanAll == TRUE)
+		{
+			testIndex++;
+		}
+		else
+		{
+			testIndex = (exactName == TRUE) ? TEST_NAME_INDEX_EMPTY : index->nextInCase[testIndex];
+		}
+	}
+
+	return numberOfSelected;
+}
+
+/**
+ * @fn static int IsSelectableTest(TestSuitPtr testSuit, int testIndex)
+ * @brief 실행 옵션에 따라 선택할 수 있는 테스트인지 검사하는 함수(벤치마크 모드이면 벤치마크만, 아니면 모두, 감시 모드가 지정한 소스 파일이 있으면 그 파일의 테스트만)
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 선택할 수 있으면 TRUE, 아니면 FALSE 반환
+ */
+static int IsSelectableTest(TestSuitPtr testSuit, int testIndex)
+{
+	if (IsWatchedTestSource(testSuit, testIndex) == FALSE)
+	{
+		return FALSE;
+	}
+
+	if (testSuit->options.runBenchmarks == FALSE)
+	{
+		return TRUE;
+	}
+
+	return (testSuit->testPtrContainer[testIndex]->kind == TestKindBenchmark) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static int SelectFuzzTarget(TestSuitPtr testSuit, int *selected)
+ * @brief 퍼징 모드에서 실행 옵션에 지정한 이름(testCase.testName)의 퍼징 테스트를 찾는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param selected 선택된 테스트 번호를 저장할 리스트(출력, 하나 이상의 크기)
+ * @return 찾으면 1, 없으면 0 반환
+ */
+static int SelectFuzzTarget(TestSuitPtr testSuit, int *selected)
+{
+	const char *fuzzTarget = testSuit->options.fuzzTarget;
+	const char *separator = strchr(fuzzTarget, '.');
+	if (separator == NULL)
+	{
+		return 0;
+	}
+
+	char *testCase = strndup(fuzzTarget, (size_t)(separator - fuzzTarget));
+	if (testCase == NULL)
+	{
+		return 0;
+	}
+	int testIndex = FindTest(testSuit, testCase, separator + 1);
+	free(testCase);
+
+	if (testIndex < 0 || testSuit->testPtrContainer[testIndex]->kind != TestKindFuzz)
+	{
+		return 0;
+	}
+	selected[0] = testIndex;
+
+	return 1;
+}
+
+/**
+ * @fn static int CompareTestIndexes(const void *left, const void *right)
+ * @brief 테스트 번호를 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 테스트 번호(입력)
+ * @param right 비교할 테스트 번호(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareTestIndexes(const void *left, const void *right)
+{
+	return *(const int*)left - *(const int*)right;
+}
+
@@ -0,0 +1,514 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 테스트 케이스에 픽스처가 없음을 나타내는 값
+#define TEST_FIXTURE_NONE (-1)
+
+// 공유 픽스처의 상태
+typedef enum _TestSharedFixtureState_t
+{
+	// 아직 만들지 않았거나 정리됨
+	TestSharedFixtureNone = 0,
+	// 만들어져 테스트들이 사용 중
+	TestSharedFixtureBuilt,
+	// SHARED_SETUP 이 실패함(정리 함수는 실행한다)
+	TestSharedFixtureFailed,
+	// 포크 서버가 작업자 프로세스를 만들기 전에 만듦(작업자 프로세스는 물려받아 사용만 하고, 만든 프로세스가 정리한다)
+	TestSharedFixtureSnapshot
+} TestSharedFixtureState;
+
+// 테스트 케이스 하나의 픽스처 함수와 공유 픽스처 상태
+typedef struct _test_case_fixture_t
+{
+	// 테스트 케이스 이름
+	const char *testCase;
+	// 종류별 픽스처 함수(TestFixtureKind 순서, 없으면 NULL)
+	TestFixtureFunc fixtureFuncs[TestFixtureSharedTeardown + 1];
+	// SHARED_SETUP 레코드(실패를 SHARED_SETUP 을 정의한 위치로 기록한다, 없으면 NULL)
+	TestFixturePtr sharedSetup;
+	// 아직 끝나지 않은 선택된 테스트 개수(0 이 되면 공유 픽스처를 정리한다)
+	int remainingTests;
+	// 공유 픽스처 상태(TestSharedFixtureState)
+	int state;
+	// 공유 픽스처를 만들고 정리하는 동안 같은 테스트 케이스의 다른 작업자 스레드를 기다리게 하는 잠금
+	pthread_mutex_t lock;
+} TestCaseFixture, *TestCaseFixturePtr;
+
+// 픽스처가 있는 테스트 케이스 리스트와 테스트별 테스트 케이스 픽스처 번호
+typedef struct _test_fixture_index_t
+{
+	// 테스트 케이스 픽스처 리스트
+	TestCaseFixturePtr caseFixtures;
+	// 테스트 케이스 픽스처 개수
+	int numberOfCaseFixtures;
+	// 테스트 번호별 테스트 케이스 픽스처 번호(없으면 TEST_FIXTURE_NONE)
+	int *testFixtures;
+	// 포크 서버로 공유 픽스처를 미리 만든 프로세스 ID(TestSharedFixtureSnapshot 상태의 공유 픽스처는 이 프로세스만 정리한다)
+	pid_t snapshotPid;
+} TestFixtureIndex, *TestFixtureIndexPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static TestCaseFixturePtr GetTestCaseFixture(TestSuitPtr testSuit, int testIndex);
+static int HasSharedFixture(TestCaseFixturePtr caseFixture);
+static int FindCaseFixture(TestFixtureIndexPtr fixtureIndex, const char *testCase);
+static int OwnsSharedFixture(TestFixtureIndexPtr fixtureIndex, TestCaseFixturePtr caseFixture);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestInitializationResult RegisterTestFixtures(TestSuitPtr testSuit, TestFixturePtrContainer begin, TestFixturePtrContainer end)
+ * @brief 링커 섹션(ttlib_fixtures)에 배치된 픽스처 레코드 리스트를 TestSuit 객체에 연결하는 함수
+ * 픽스처가 하나도 없으면 begin 과 end 가 모두 NULL 이며, 이때 테스트 실행에 추가 비용이 없다.
+ * @param testSuit 전체 테스트 관리 구조체(출력)
+ * @param begin 픽스처 레코드 리스트의 시작(__start_ttlib_fixtures, 입력)
+ * @param end 픽스처 레코드 리스트의 끝(__stop_ttlib_fixtures, 입력)
+ * @return 성공 시 TestInitializationResultSuccess, 실패 시 TestInitializationResultFail 반환
+ */
+TestInitializationResult RegisterTestFixtures(TestSuitPtr testSuit, TestFixturePtrContainer begin, TestFixturePtrContainer end)
+{
+	// Check parameter
+	if (testSuit == NULL || begin > end)
+	{
+		return TestInitializationResultFail;
+	}
+
+	testSuit->fixturePtrContainer = begin;
+	testSuit->numberOfFixtures = (begin == NULL) ? 0 : (int)(end - begin);
+	DeleteTestFixtures(testSuit);
+
+	return TestInitializationResultSuccess;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int PrepareTestFixtures(TestSuitPtr testSuit)
+ * @brief 등록된 픽스처를 테스트 케이스별로 모으고 선택된 테스트마다 사용할 테스트 케이스 픽스처를 연결하는 함수
+ * 공유 픽스처는 테스트 케이스의 선택된 테스트 개수를 세어 두었다가 마지막 테스트가 끝나면 정리한다.
+ * 같은 테스트 케이스에 같은 종류의 픽스처가 둘 이상 있으면(다른 소스 파일에서 정의) 실패한다.
+ * RunAllTests 함수에서 테스트를 선택한 뒤 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int PrepareTestFixtures(TestSuitPtr testSuit)
+{
+	DeleteTestFixtures(testSuit);
+
+	if (testSuit->numberOfFixtures == 0 || testSuit->numberOfTests == 0)
+	{
+		return 0;
+	}
+
+	TestFixtureIndexPtr fixtureIndex = (TestFixtureIndexPtr)calloc(1, sizeof(TestFixtureIndex));
+	if (fixtureIndex == NULL)
+	{
+		return -1;
+	}
+	testSuit->fixtureIndex = fixtureIndex;
+
+	fixtureIndex->caseFixtures = (TestCaseFixturePtr)calloc((size_t)testSuit->numberOfFixtures, sizeof(TestCaseFixture));
+	fixtureIndex->testFixtures = (int*)malloc((size_t)testSuit->numberOfTests * sizeof(int));
+	if (fixtureIndex->caseFixtures == NULL || fixtureIndex->testFixtures == NULL)
+	{
+		DeleteTestFixtures(testSuit);
+		return -1;
+	}
+
+	// Group the fixture functions by test case
+	int fixtureIndexInSuit = 0;
+	for (; fixtureIndexInSuit < testSuit->numberOfFixtures; fixtureIndexInSuit++)
+	{
+		TestFixturePtr fixture = testSuit->fixturePtrContainer[fixtureIndexInSuit];
+		if (fixture->kind < TestFixtureSetup || fixture->kind > TestFixtureSharedTeardown)
+		{
+			continue;
+		}
+
+		int caseIndex = FindCaseFixture(fixtureIndex, fixture->testCase);
+		if (caseIndex == TEST_FIXTURE_NONE)
+		{
+			caseIndex = fixtureIndex->numberOfCaseFixtures++;
+			fixtureIndex->caseFixtures[caseIndex].testCase = fixture->testCase;
+			pthread_mutex_init(&fixtureIndex->caseFixtures[caseIndex].lock, NULL);
+		}
+
+		TestCaseFixturePtr caseFixture = &fixtureIndex->caseFixtures[caseIndex];
+		if (caseFixture->fixtureFuncs[fixture->kind] != NULL)
+		{
+			printf("테스트 픽스처 중복 정의 (case:%s, kind:%d)\n", fixture->testCase, fixture->kind);
+			DeleteTestFixtures(testSuit);
+			return -1;
+		}
+		caseFixture->fixtureFuncs[fixture->kind] = fixture->fixtureFunc;
+		if (fixture->kind == TestFixtureSharedSetup)
+		{
+			caseFixture->sharedSetup = fixture;
+		}
+	}
+
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		fixtureIndex->testFixtures[testIndex] = TEST_FIXTURE_NONE;
+	}
+
+	// Count the selected tests of each case so that the last one tears the shared fixture down
+	// (the tests reusing a cached result do not run, so they neither build nor tear down the shared fixture)
+	int selectedIndex = 0;
+	for (; selectedIndex < testSuit->numberOfSelectedTests; selectedIndex++)
+	{
+		testIndex = testSuit->selectedTests[selectedIndex];
+		int caseIndex = FindCaseFixture(fixtureIndex, testSuit->testPtrContainer[testIndex]->testCase);
+		fixtureIndex->testFixtures[testIndex] = caseIndex;
+		if (caseIndex != TEST_FIXTURE_NONE && IsTestResultCached(testSuit, testIndex) == FALSE)
+		{
+			fixtureIndex->caseFixtures[caseIndex].remainingTests++;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @fn int AcquireTestFixture(TestSuitPtr testSuit, int testIndex)
+ * @brief 테스트가 사용할 공유 픽스처를 준비하는 함수(테스트 케이스에서 처음 호출될 때 SHARED_SETUP 을 실행한다)
+ * 현재 스레드의 TestContext 객체에서 실행되므로 SHARED_SETUP 의 실패는 처음 실행된 테스트의 실패로 기록된다.
+ * 공유 픽스처를 사용하는 테스트마다 SHARED_SETUP 을 정의한 위치로 실패를 하나 더 기록한다.
+ * 작업자 스레드들은 테스트 케이스의 잠금으로 한 번만 만들고, 작업자 프로세스는 각자 처음 사용할 때 만든다(포크 서버가 미리 만들었으면 물려받아 사용한다).
+ * 테스트 실행 시간과 메모리 할당 기록을 시작하기 전에 호출해야 한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 실행할 테스트 번호(입력)
+ * @return 공유 픽스처가 없거나 준비되면 0, SHARED_SETUP 이 실패했으면 실패를 기록하고 -1 반환
+ */
+int AcquireTestFixture(TestSuitPtr testSuit, int testIndex)
+{
+	TestCaseFixturePtr caseFixture = GetTestCaseFixture(testSuit, testIndex);
+	if (caseFixture == NULL || HasSharedFixture(caseFixture) == FALSE)
+	{
+		return 0;
+	}
+
+	pthread_mutex_lock(&caseFixture->lock);
+	if (caseFixture->state == TestSharedFixtureNone)
+	{
+		int failCount = _testContext->failCount;
+		if (caseFixture->fixtureFuncs[TestFixtureSharedSetup] != NULL)
+		{
+			caseFixture->fixtureFuncs[TestFixtureSharedSetup]();
+		}
+		caseFixture->state = (_testContext->failCount > failCount) ? TestSharedFixtureFailed : TestSharedFixtureBuilt;
+	}
+	int state = caseFixture->state;
+	pthread_mutex_unlock(&caseFixture->lock);
+
+	if (state == TestSharedFixtureFailed)
+	{
+		// The state only becomes failed after SHARED_SETUP ran, so its record is set
+		ReportTestFailure("SHARED_SETUP", caseFixture->sharedSetup->fileName, caseFixture->sharedSetup->lineNumber, "공유 픽스처 생성 실패 (case:%s)", caseFixture->testCase);
+		_testContext->failCount++;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @fn TestResult RunTestFunction(TestSuitPtr testSuit, int testIndex)
+ * @brief 테스트 케이스의 SETUP, 테스트 함수, TEARDOWN 을 차례대로 실행하는 함수
+ * SETUP 이 실패하면 테스트 함수는 실행하지 않지만 TEARDOWN 은 실행한다.
+ * 제한 시간이 지나 테스트 함수를 빠져나오면 TEARDOWN 은 실행되지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 실행할 테스트 번호(입력)
+ * @return 테스트 실행 결과 반환
+ */
+TestResult RunTestFunction(TestSuitPtr testSuit, int testIndex)
+{
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+	TestCaseFixturePtr caseFixture = GetTestCaseFixture(testSuit, testIndex);
+	if (caseFixture == NULL)
+	{
+		return test->testFunc(testSuit);
+	}
+
+	if (caseFixture->fixtureFuncs[TestFixtureSetup] != NULL)
+	{
+		caseFixture->fixtureFuncs[TestFixtureSetup]();
+	}
+
+	TestResult result = TestFail;
+	if (_testContext->failCount == 0)
+	{
+		result = test->testFunc(testSuit);
+	}
+
+	if (caseFixture->fixtureFuncs[TestFixtureTeardown] != NULL)
+	{
+		caseFixture->fixtureFuncs[TestFixtureTeardown]();
+	}
+
+	return (_testContext->failCount > 0) ? TestFail : result;
+}
+
+/**
+ * @fn void RunTestCaseFixture(TestSuitPtr testSuit, int testIndex, int kind)
+ * @brief 테스트 케이스의 SETUP 이나 TEARDOWN 하나를 현재 스레드의 TestContext 객체에서 실행하는 함수(없으면 아무것도 하지 않는다)
+ * 시작 코드와 끝나는 시점이 떨어져 있는 ASYNC_TEST 를 동시에 진행할 때 RunTestFunction 대신 사용한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 실행 중인 테스트 번호(입력)
+ * @param kind 실행할 픽스처 종류(입력, TestFixtureSetup 또는 TestFixtureTeardown)
+ * @return 반환값 없음
+ */
+void RunTestCaseFixture(TestSuitPtr testSuit, int testIndex, int kind)
+{
+	TestCaseFixturePtr caseFixture = GetTestCaseFixture(testSuit, testIndex);
+	if (caseFixture != NULL && caseFixture->fixtureFuncs[kind] != NULL)
+	{
+		caseFixture->fixtureFuncs[kind]();
+	}
+}
+
+/**
+ * @fn void ReleaseTestFixture(TestSuitPtr testSuit, int testIndex)
+ * @brief 끝난 테스트를 공유 픽스처에서 빼고, 테스트 케이스의 마지막 테스트이면 SHARED_TEARDOWN 을 실행하는 함수
+ * 현재 스레드의 TestContext 객체에서 실행되므로 SHARED_TEARDOWN 의 실패는 마지막 테스트의 실패로 기록된다.
+ * 작업자 프로세스는 테스트 케이스의 일부 테스트만 실행하므로 보통 FinishTestFixtures 에서 정리한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 끝난 테스트 번호(입력)
+ * @return 반환값 없음
+ */
+void ReleaseTestFixture(TestSuitPtr testSuit, int testIndex)
+{
+	TestCaseFixturePtr caseFixture = GetTestCaseFixture(testSuit, testIndex);
+	if (caseFixture == NULL || HasSharedFixture(caseFixture) == FALSE)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&caseFixture->lock);
+	caseFixture->remainingTests--;
+	if (caseFixture->remainingTests == 0 && caseFixture->state != TestSharedFixtureNone && OwnsSharedFixture(testSuit->fixtureIndex, caseFixture) == TRUE)
+	{
+		if (caseFixture->fixtureFuncs[TestFixtureSharedTeardown] != NULL)
+		{
+			caseFixture->fixtureFuncs[TestFixtureSharedTeardown]();
+		}
+		caseFixture->state = TestSharedFixtureNone;
+	}
+	pthread_mutex_unlock(&caseFixture->lock);
+}
+
+/**
+ * @fn int BuildTestFixtureSnapshot(TestSuitPtr testSuit)
+ * @brief 포크 서버 모드에서 작업자 프로세스를 만들기 전에 선택된 테스트 케이스들의 SHARED_SETUP 을 한 번씩 실행하는 함수
+ * 이후에 만드는 작업자 프로세스들은 만들어진 공유 픽스처를 copy-on-write 로 물려받으므로 테스트마다 새 프로세스에서 실행해도 생성 비용은 한 번만 든다.
+ * 실행 중인 테스트가 없으므로 별도의 TestContext 객체에서 실행한다. 실패한 공유 픽스처는 SHARED_TEARDOWN 으로 정리하고 만들지 않은 상태로 두어,
+ * 작업자 프로세스가 처음 사용할 때 다시 만들면서 실패를 그 테스트에 기록하게 한다.
+ * RunTestsInProcesses 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 미리 만든 공유 픽스처 개수 반환
+ */
+int BuildTestFixtureSnapshot(TestSuitPtr testSuit)
+{
+	TestFixtureIndexPtr fixtureIndex = testSuit->fixtureIndex;
+	if (fixtureIndex == NULL)
+	{
+		return 0;
+	}
+
+	TestContextPtr previousContext = _testContext;
+	fixtureIndex->snapshotPid = getpid();
+
+	int numberOfSnapshots = 0;
+	int caseIndex = 0;
+	for (; caseIndex < fixtureIndex->numberOfCaseFixtures; caseIndex++)
+	{
+		TestCaseFixturePtr caseFixture = &fixtureIndex->caseFixtures[caseIndex];
+		if (caseFixture->remainingTests == 0 || caseFixture->state != TestSharedFixtureNone || caseFixture->fixtureFuncs[TestFixtureSharedSetup] == NULL)
+		{
+			continue;
+		}
+
+		TestContext context;
+		InitializeTestContext(&context, testSuit, FALSE);
+		context.testIndex = -1;
+		_testContext = &context;
+
+		caseFixture->fixtureFuncs[TestFixtureSharedSetup]();
+		if (context.failCount == 0)
+		{
+			caseFixture->state = TestSharedFixtureSnapshot;
+			numberOfSnapshots++;
+		}
+		else if (caseFixture->fixtureFuncs[TestFixtureSharedTeardown] != NULL)
+		{
+			// Leave the failure to the worker which builds it again, reported on its test
+			caseFixture->fixtureFuncs[TestFixtureSharedTeardown]();
+		}
+
+		_testContext = previousContext;
+		ReleaseTestContext(&context);
+	}
+
+	return numberOfSnapshots;
+}
+
+/**
+ * @fn void FinishTestFixtures(TestSuitPtr testSuit)
+ * @brief 아직 정리되지 않은 공유 픽스처의 SHARED_TEARDOWN 을 실행하는 함수
+ * ASSERT 실패로 실행이 중단되었거나 작업자 프로세스가 종료할 때 남은 공유 픽스처를 정리한다.
+ * 포크 서버가 미리 만든 공유 픽스처는 작업자 프로세스에서는 정리하지 않고, 모든 테스트가 끝난 뒤 만든 프로세스에서 정리한다.
+ * 실행 중인 테스트가 없으므로 별도의 TestContext 객체에서 실행하고, 실패하면 표준 에러로 알린다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 반환값 없음
+ */
+void FinishTestFixtures(TestSuitPtr testSuit)
+{
+	TestFixtureIndexPtr fixtureIndex = testSuit->fixtureIndex;
+	if (fixtureIndex == NULL)
+	{
+		return;
+	}
+
+	TestContextPtr previousContext = _testContext;
+
+	int caseIndex = 0;
+	for (; caseIndex < fixtureIndex->numberOfCaseFixtures; caseIndex++)
+	{
+		TestCaseFixturePtr caseFixture = &fixtureIndex->caseFixtures[caseIndex];
+		if (caseFixture->state == TestSharedFixtureNone || OwnsSharedFixture(fixtureIndex, caseFixture) == FALSE)
+		{
+			continue;
+		}
+
+		if (caseFixture->fixtureFuncs[TestFixtureSharedTeardown] != NULL)
+		{
+			TestContext context;
+			InitializeTestContext(&context, testSuit, FALSE);
+			context.testIndex = -1;
+			_testContext = &context;
+
+			caseFixture->fixtureFuncs[TestFixtureSharedTeardown]();
+			if (context.failCount > 0)
+			{
+				fprintf(stderr, "공유 픽스처 정리 실패 (case:%s, 실패:%d)\n", caseFixture->testCase, context.failCount);
+			}
+
+			_testContext = previousContext;
+			ReleaseTestContext(&context);
+		}
+		caseFixture->state = TestSharedFixtureNone;
+	}
+}
+
+/**
+ * @fn void DeleteTestFixtures(TestSuitPtr testSuit)
+ * @brief 테스트 케이스별 픽스처 상태를 삭제하는 함수(정리되지 않은 공유 픽스처는 정리하지 않는다)
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestFixtures(TestSuitPtr testSuit)
+{
+	TestFixtureIndexPtr fixtureIndex = testSuit->fixtureIndex;
+	if (fixtureIndex == NULL)
+	{
+		return;
+	}
+
+	if (fixtureIndex->caseFixtures != NULL)
+	{
+		int caseIndex = 0;
+		for (; caseIndex < fixtureIndex->numberOfCaseFixtures; caseIndex++)
+		{
+			pthread_mutex_destroy(&fixtureIndex->caseFixtures[caseIndex].lock);
+		}
+	}
+	free(fixtureIndex->caseFixtures);
+	free(fixtureIndex->testFixtures);
+	free(fixtureIndex);
+	testSuit->fixtureIndex = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static TestCaseFixturePtr GetTestCaseFixture(TestSuitPtr testSuit, int testIndex)
+ * @brief 테스트가 속한 테스트 케이스의 픽스처를 반환하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 테스트 케이스 픽스처, 없으면 NULL 반환
+ */
+static TestCaseFixturePtr GetTestCaseFixture(TestSuitPtr testSuit, int testIndex)
+{
+	TestFixtureIndexPtr fixtureIndex = testSuit->fixtureIndex;
+	if (fixtureIndex == NULL || fixtureIndex->testFixtures[testIndex] == TEST_FIXTURE_NONE)
+	{
+		return NULL;
+	}
+
+	return &fixtureIndex->caseFixtures[fixtureIndex->testFixtures[testIndex]];
+}
+
+/**
+ * @fn static int HasSharedFixture(TestCaseFixturePtr caseFixture)
+ * @brief 테스트 케이스에 SHARED_SETUP 이나 SHARED_TEARDOWN 이 있는지 확인하는 함수
+ * @param caseFixture 테스트 케이스 픽스처(입력)
+ * @return 있으면 TRUE, 없으면 FALSE 반환
+ */
+static int HasSharedFixture(TestCaseFixturePtr caseFixture)
+{
+	return (caseFixture->fixtureFuncs[TestFixtureSharedSetup] != NULL || caseFixture->fixtureFuncs[TestFixtureSharedTeardown] != NULL) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static int FindCaseFixture(TestFixtureIndexPtr fixtureIndex, const char *testCase)
+ * @brief 테스트 케이스 이름으로 테스트 케이스 픽스처 번호를 찾는 함수(픽스처가 있는 테스트 케이스는 적으므로 순차 검색)
+ * @param fixtureIndex 픽스처 상태(입력)
+ * @param testCase 테스트 케이스 이름(입력)
+ * @return 테스트 케이스 픽스처 번호, 없으면 TEST_FIXTURE_NONE 반환
+ */
+static int FindCaseFixture(TestFixtureIndexPtr fixtureIndex, const char *testCase)
+{
+	int caseIndex = 0;
+	for (; caseIndex < fixtureIndex->numberOfCaseFixtures; caseIndex++)
+	{
+		if (strcmp(fixtureIndex->caseFixtures[caseIndex].testCase, testCase) == 0)
+		{
+			return caseIndex;
+		}
+	}
+
+	return TEST_FIXTURE_NONE;
+}
+
+/**
+ * @fn static int OwnsSharedFixture(TestFixtureIndexPtr fixtureIndex, TestCaseFixturePtr caseFixture)
+ * @brief 현재 프로세스가 공유 픽스처를 정리해야 하는지 검사하는 함수(포크 서버가 미리 만든 공유 픽스처는 만든 프로세스만 정리한다)
+ * @param fixtureIndex 테스트 케이스별 픽스처 상태(입력)
+ * @param caseFixture 테스트 케이스 픽스처(입력)
+ * @return 정리해야 하면 TRUE, 아니면 FALSE 반환
+ */
+static int OwnsSharedFixture(TestFixtureIndexPtr fixtureIndex, TestCaseFixturePtr caseFixture)
+{
+	if (caseFixture->state != TestSharedFixtureSnapshot)
+	{
+		return TRUE;
+	}
+
+	return (fixtureIndex->snapshotPid == getpid()) ? TRUE : FALSE;
+}
@@ -0,0 +1,414 @@
+#include "ttlib_internal.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// libFuzzer 의 드라이버 함수(-fsanitize=fuzzer 로 링크하면 libFuzzer 가 정의하고, 아니면 약한 심볼이므로 NULL)
+extern int LLVMFuzzerRunDriver(int *argc, char ***argv, int (*callback)(const uint8_t *data, size_t size)) __attribute__((weak));
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// libFuzzer 가 만든 입력으로 실행할 퍼징 대상 함수(퍼징 모드는 순차 실행이므로 하나뿐이다)
+static TestFuzzFunc _fuzzTarget = NULL;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static char *MakeFuzzCorpusPath(TestSuitPtr testSuit, TestPtr test);
+static void ReplayFuzzCorpus(TestContextPtr context, TestFuzzFunc fuzz, const char *corpusPath);
+static int RunFuzzInput(TestContextPtr context, TestFuzzFunc fuzz, const char *inputPath);
+static int ReadFuzzInput(const char *inputPath, unsigned char **dataContainer, size_t *size);
+static int SelectFuzzInput(const struct dirent *entry);
+static void RunFuzzDriver(TestContextPtr context, TestFuzzFunc fuzz, const char *corpusPath);
+static int RunFuzzCallback(const uint8_t *data, size_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void RunFuzzTest(TestFuzzFunc fuzz)
+ * @brief 퍼징 테스트를 실행하는 함수(FUZZ_TEST 매크로 함수에서 호출)
+ * 퍼징 모드(--fuzz)이면 libFuzzer 드라이버에 퍼징 대상 함수를 전달하여 커버리지를 따라 만든 입력으로 계속 실행하고,
+ * 그 밖에는 빈 입력과 코퍼스 디렉터리(--fuzz-corpus/테스트케이스.테스트이름)에 저장된 입력 파일들로 한 번씩 실행하는 회귀 테스트로 동작한다.
+ * @param fuzz 입력 하나로 퍼징 대상 코드를 실행하는 함수(입력)
+ * @return 반환값 없음
+ */
+void RunFuzzTest(TestFuzzFunc fuzz)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || fuzz == NULL)
+	{
+		return;
+	}
+
+	TestSuitPtr testSuit = context->testSuit;
+	TestPtr test = testSuit->testPtrContainer[context->testIndex];
+
+	PauseTestAllocations();
+	char *corpusPath = MakeFuzzCorpusPath(testSuit, test);
+	ResumeTestAllocations();
+	if (testSuit->options.fuzzCorpusPath != NULL && corpusPath == NULL)
+	{
+		PRINT_FAIL("FUZZ_TEST", __FILE__, __LINE__, "%s", "코퍼스 경로 생성 실패");
+		return;
+	}
+
+	if (testSuit->options.fuzzTarget != NULL)
+	{
+		RunFuzzDriver(context, fuzz, corpusPath);
+	}
+	else
+	{
+		ReplayFuzzCorpus(context, fuzz, corpusPath);
+	}
+
+	PauseTestAllocations();
+	free(corpusPath);
+	ResumeTestAllocations();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static char *MakeFuzzCorpusPath(TestSuitPtr testSuit, TestPtr test)
+ * @brief 테스트의 코퍼스 디렉터리 경로(코퍼스디렉터리/테스트케이스.테스트이름)를 만드는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param test 퍼징 테스트(입력)
+ * @return 성공 시 새로 할당된 경로, 코퍼스 디렉터리를 지정하지 않았거나 실패 시 NULL 반환
+ */
+static char *MakeFuzzCorpusPath(TestSuitPtr testSuit, TestPtr test)
+{
+	const char *corpusRoot = testSuit->options.fuzzCorpusPath;
+	if (corpusRoot == NULL)
+	{
+		return NULL;
+	}
+
+	size_t size = strlen(corpusRoot) + strlen(test->testCase) + strlen(test->testName) + 3;
+	char *corpusPath = (char*)malloc(size);
+	if (corpusPath == NULL)
+	{
+		return NULL;
+	}
+	snprintf(corpusPath, size, "%s/%s.%s", corpusRoot, test->testCase, test->testName);
+
+	return corpusPath;
+}
+
+/**
+ * @fn static void ReplayFuzzCorpus(TestContextPtr context, TestFuzzFunc fuzz, const char *corpusPath)
+ * @brief 빈 입력과 코퍼스 디렉터리의 입력 파일들(이름 순서)로 퍼징 대상 함수를 한 번씩 실행하는 함수
+ * 실패한 입력마다 입력 파일 경로를 실패 정보로 기록하고, ASSERT 가 실패하면 나머지 입력은 실행하지 않는다.
+ * 코퍼스 디렉터리가 없으면 빈 입력만 실행한다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param fuzz 입력 하나로 퍼징 대상 코드를 실행하는 함수(입력)
+ * @param corpusPath 테스트의 코퍼스 디렉터리 경로(입력, NULL 이면 빈 입력만 실행)
+ * @return 반환값 없음
+ */
+static void ReplayFuzzCorpus(TestContextPtr context, TestFuzzFunc fuzz, const char *corpusPath)
+{
+	// The empty input always runs first, as libFuzzer does
+	if (RunFuzzInput(context, fuzz, NULL) != 0 || corpusPath == NULL)
+	{
+		return;
+	}
+
+	PauseTestAllocations();
+	struct dirent **entries = NULL;
+	int numberOfEntries = scandir(corpusPath, &entries, SelectFuzzInput, alphasort);
+	int scanError = errno;
+	ResumeTestAllocations();
+	if (numberOfEntries < 0)
+	{
+		if (scanError != ENOENT)
+		{
+			ReportTestFailure("FUZZ_TEST", corpusPath, 0, "코퍼스 디렉터리 읽기 실패 (%s)", strerror(scanError));
+			_testContext->failCount++;
+		}
+		return;
+	}
+
+	int entryIndex = 0;
+	for (; entryIndex < numberOfEntries; entryIndex++)
+	{
+		PauseTestAllocations();
+		size_t size = strlen(corpusPath) + strlen(entries[entryIndex]->d_name) + 2;
+		char *inputPath = (char*)malloc(size);
+		if (inputPath != NULL)
+		{
+			snprintf(inputPath, size, "%s/%s", corpusPath, entries[entryIndex]->d_name);
+		}
+		ResumeTestAllocations();
+
+		int result = 0;
+		if (inputPath == NULL)
+		{
+			ReportTestFailure("FUZZ_TEST", corpusPath, 0, "%s", "입력 파일 경로 생성 실패");
+			_testContext->failCount++;
+		}
+		else
+		{
+			result = RunFuzzInput(context, fuzz, inputPath);
+		}
+
+		PauseTestAllocations();
+		free(inputPath);
+		ResumeTestAllocations();
+		if (result != 0)
+		{
+			break;
+		}
+	}
+
+	PauseTestAllocations();
+	for (entryIndex = 0; entryIndex < numberOfEntries; entryIndex++)
+	{
+		free(entries[entryIndex]);
+	}
+	free(entries);
+	ResumeTestAllocations();
+}
+
+/**
+ * @fn static int RunFuzzInput(TestContextPtr context, TestFuzzFunc fuzz, const char *inputPath)
+ * @brief 입력 파일 하나(NULL 이면 빈 입력)로 퍼징 대상 함수를 실행하는 함수
+ * 입력은 파일 크기만큼만 할당하므로 AddressSanitizer 와 함께 빌드하면 입력 범위를 넘는 읽기도 검출된다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param fuzz 입력 하나로 퍼징 대상 코드를 실행하는 함수(입력)
+ * @param inputPath 입력 파일 경로(입력, NULL 이면 빈 입력)
+ * @return 계속 실행할 수 있으면 0, ASSERT 실패로 테스트 종료가 요청되었으면 -1 반환
+ */
+static int RunFuzzInput(TestContextPtr context, TestFuzzFunc fuzz, const char *inputPath)
+{
+	unsigned char *data = NULL;
+	size_t size = 0;
+
+	PauseTestAllocations();
+	int result = (inputPath != NULL) ? ReadFuzzInput(inputPath, &data, &size) : 0;
+	if (inputPath == NULL)
+	{
+		data = (unsigned char*)malloc(1);
+		result = (data != NULL) ? 0 : ENOMEM;
+	}
+	ResumeTestAllocations();
+	if (result != 0)
+	{
+		ReportTestFailure("FUZZ_TEST", (inputPath != NULL) ? inputPath : "-", 0, "입력 파일 읽기 실패 (%s)", strerror(result));
+		_testContext->failCount++;
+		return 0;
+	}
+
+	int failCount = context->failCount;
+	fuzz(data, size);
+	if (context->failCount != failCount)
+	{
+		ReportTestFailure("FUZZ_TEST", (inputPath != NULL) ? inputPath : "(빈 입력)", 0, "이 입력에서 실패 (%zu 바이트)", size);
+	}
+
+	PauseTestAllocations();
+	free(data);
+	ResumeTestAllocations();
+
+	return (context->onGoing == TestExit) ? -1 : 0;
+}
+
+/**
+ * @fn static int ReadFuzzInput(const char *inputPath, unsigned char **dataContainer, size_t *size)
+ * @brief 입력 파일 전체를 크기가 딱 맞는 새 메모리로 읽는 함수
+ * @param inputPath 입력 파일 경로(입력)
+ * @param dataContainer 읽은 입력(출력, 호출한 함수에서 해제)
+ * @param size 읽은 입력의 길이(출력)
+ * @return 성공 시 0, 실패 시 errno 값 반환
+ */
+static int ReadFuzzInput(const char *inputPath, unsigned char **dataContainer, size_t *size)
+{
+	int fd = open(inputPath, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		return errno;
+	}
+
+	struct stat status;
+	if (fstat(fd, &status) != 0)
+	{
+		int error = errno;
+		close(fd);
+		return error;
+	}
+
+	size_t length = (size_t)status.st_size;
+	unsigned char *data = (unsigned char*)malloc((length > 0) ? length : 1);
+	if (data == NULL)
+	{
+		close(fd);
+		return ENOMEM;
+	}
+
+	size_t offset = 0;
+	while (offset < length)
+	{
+		ssize_t numberOfBytes = read(fd, data + offset, length - offset);
+		if (numberOfBytes < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (numberOfBytes <= 0)
+		{
+			int error = (numberOfBytes < 0) ? errno : EIO;
+			free(data);
+			close(fd);
+			return error;
+		}
+		offset += (size_t)numberOfBytes;
+	}
+	close(fd);
+
+	*dataContainer = data;
+	*size = length;
+
+	return 0;
+}
+
+/**
+ * @fn static int SelectFuzzInput(const struct dirent *entry)
+ * @brief 코퍼스 디렉터리에서 입력 파일로 사용할 항목을 고르는 함수(숨김 파일과 디렉터리 제외)
+ * @param entry 디렉터리 항목(입력)
+ * @return 입력 파일이면 1, 아니면 0 반환
+ */
+static int SelectFuzzInput(const struct dirent *entry)
+{
+	if (entry->d_name[0] == '.')
+	{
+		return 0;
+	}
+
+	return (entry->d_type == DT_DIR) ? 0 : 1;
+}
+
+/**
+ * @fn static void RunFuzzDriver(TestContextPtr context, TestFuzzFunc fuzz, const char *corpusPath)
+ * @brief libFuzzer 드라이버로 퍼징 대상 함수를 계속 실행하는 함수(퍼징 모드)
+ * 코퍼스 디렉터리를 지정하면 새로 커버리지를 늘린 입력과 실패한 입력(crash-*, timeout-* 등)을 그 디렉터리에 저장하므로,
+ * 찾은 실패 입력은 보통 실행에서 바로 회귀 테스트로 실행된다. '--' 뒤의 명령행 인자는 libFuzzer 옵션으로 전달된다.
+ * 제한 시간과 할당 기록은 libFuzzer 의 -timeout, -rss_limit_mb 등이 대신하므로 실행하는 동안 사용하지 않는다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param fuzz 입력 하나로 퍼징 대상 코드를 실행하는 함수(입력)
+ * @param corpusPath 테스트의 코퍼스 디렉터리 경로(입력, NULL 이면 코퍼스를 저장하지 않음)
+ * @return 반환값 없음
+ */
+static void RunFuzzDriver(TestContextPtr context, TestFuzzFunc fuzz, const char *corpusPath)
+{
+	TestOptionsPtr options = &context->testSuit->options;
+	if (LLVMFuzzerRunDriver == NULL)
+	{
+		PRINT_FAIL("FUZZ_TEST", __FILE__, __LINE__, "%s", "libFuzzer 가 링크되지 않음 (-fsanitize=fuzzer 로 빌드 필요)");
+		return;
+	}
+
+	if (corpusPath != NULL && (mkdir(options->fuzzCorpusPath, 0777) != 0 && errno != EEXIST))
+	{
+		ReportTestFailure("FUZZ_TEST", options->fuzzCorpusPath, 0, "코퍼스 디렉터리 생성 실패 (%s)", strerror(errno));
+		_testContext->failCount++;
+		return;
+	}
+	if (corpusPath != NULL && (mkdir(corpusPath, 0777) != 0 && errno != EEXIST))
+	{
+		ReportTestFailure("FUZZ_TEST", corpusPath, 0, "코퍼스 디렉터리 생성 실패 (%s)", strerror(errno));
+		_testContext->failCount++;
+		return;
+	}
+
+	PauseTestAllocations();
+
+	// argv : program [corpus -artifact_prefix=corpus/] [libFuzzer options...]
+	// libFuzzer takes a non-const argv, so the corpus path is passed as a copy
+	char *corpusArgument = NULL;
+	char *artifactPrefix = NULL;
+	char **fuzzArgv = (char**)calloc((size_t)options->numberOfFuzzArguments + 4, sizeof(char*));
+	int fuzzArgc = 0;
+	if (fuzzArgv != NULL)
+	{
+		fuzzArgv[fuzzArgc++] = program_invocation_name;
+		if (corpusPath != NULL)
+		{
+			size_t size = strlen(corpusPath) + 19;
+			corpusArgument = strdup(corpusPath);
+			artifactPrefix = (char*)malloc(size);
+			if (corpusArgument != NULL && artifactPrefix != NULL)
+			{
+				snprintf(artifactPrefix, size, "-artifact_prefix=%s/", corpusPath);
+				fuzzArgv[fuzzArgc++] = corpusArgument;
+				fuzzArgv[fuzzArgc++] = artifactPrefix;
+			}
+		}
+
+		int argumentIndex = 0;
+		for (; argumentIndex < options->numberOfFuzzArguments; argumentIndex++)
+		{
+			fuzzArgv[fuzzArgc++] = options->fuzzArguments[argumentIndex];
+		}
+	}
+
+	int result = -1;
+	if (fuzzArgv != NULL && (corpusPath == NULL || (corpusArgument != NULL && artifactPrefix != NULL)))
+	{
+		// Report failures as they happen since a failing input ends the process
+		FlushTestSink(context->testSuit->reporter->sink);
+		_fuzzTarget = fuzz;
+
+		HoldTestWatchdog();
+		result = LLVMFuzzerRunDriver(&fuzzArgc, &fuzzArgv, RunFuzzCallback);
+		ReleaseTestWatchdog();
+
+		_fuzzTarget = NULL;
+	}
+
+	free(corpusArgument);
+	free(artifactPrefix);
+	free(fuzzArgv);
+	ResumeTestAllocations();
+
+	if (result != 0)
+	{
+		PRINT_FAIL("FUZZ_TEST", __FILE__, __LINE__, "libFuzzer 실행 실패 (결과:%d)", result);
+	}
+}
+
+/**
+ * @fn static int RunFuzzCallback(const uint8_t *data, size_t size)
+ * @brief libFuzzer 가 만든 입력 하나로 퍼징 대상 함수를 실행하는 함수(LLVMFuzzerTestOneInput 역할)
+ * EXPECT, ASSERT 가 실패하면 실패 정보를 출력한 뒤 프로세스를 중단시켜 libFuzzer 가 그 입력을 저장하게 한다.
+ * @param data 입력(입력, 읽기 전용)
+ * @param size 입력의 길이(입력)
+ * @return 항상 0 반환(libFuzzer 약속)
+ */
+static int RunFuzzCallback(const uint8_t *data, size_t size)
+{
+	TestContextPtr context = _testContext;
+	int failCount = context->failCount;
+
+	_fuzzTarget(data, size);
+
+	if (context->failCount != failCount)
+	{
+		ReportTestFailure("FUZZ_TEST", "-", 0, "이 입력에서 실패 (%zu 바이트)", size);
+		FlushTestSink(context->testSuit->reporter->sink);
+		abort();
+	}
+
+	return 0;
+}
@@ -0,0 +1,756 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <link.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 호출 경로 테이블의 처음 크기(2 의 거듭제곱)
+#define TEST_HEAP_STACK_TABLE_SIZE 256
+
+// backtrace 로 읽을 최대 프레임 개수(할당 함수 안쪽의 라이브러리 프레임을 건너뛰기 위해 여유를 둔다)
+#define TEST_HEAP_BACKTRACE_DEPTH (TEST_HEAP_PROFILE_DEPTH + 8)
+
+// 심볼 테이블을 캐시할 최대 실행 파일 및 공유 라이브러리 개수
+#define TEST_MAX_SYMBOL_TABLES 64
+
+// 실행 파일 또는 공유 라이브러리의 함수 심볼 하나
+typedef struct _test_symbol_t
+{
+	// 함수의 시작 주소(적재 주소 반영)
+	uintptr_t address;
+	// 함수 크기(0 이면 알 수 없음)
+	size_t size;
+	// 함수 이름(ELF 파일 매핑 안의 문자열)
+	const char *name;
+} TestSymbol, *TestSymbolPtr;
+
+// 실행 파일 또는 공유 라이브러리 하나의 함수 심볼 테이블
+typedef struct _test_symbol_table_t
+{
+	// 적재 주소(dl_phdr_info.dlpi_addr, 같은 이름의 객체를 구분한다)
+	uintptr_t base;
+	// 주소 순으로 정렬된 함수 심볼 리스트
+	TestSymbolPtr symbols;
+	// 함수 심볼 개수
+	size_t numberOfSymbols;
+	// 심볼 이름이 들어 있는 ELF 파일 매핑
+	void *image;
+	// ELF 파일 매핑 크기
+	size_t imageSize;
+	// 심볼을 찾지 못했을 때 출력할 파일 이름
+	char objectName[64];
+} TestSymbolTable, *TestSymbolTablePtr;
+
+// 주소가 속한 실행 파일 또는 공유 라이브러리를 찾기 위한 구조체(dl_iterate_phdr 콜백에서 사용)
+typedef struct _test_symbol_module_t
+{
+	// 찾을 주소
+	uintptr_t address;
+	// 주소가 속한 객체의 경로(실행 파일은 빈 문자열)
+	const char *path;
+	// 주소가 속한 객체의 적재 주소
+	uintptr_t base;
+	// 찾았는지 여부
+	int found;
+} TestSymbolModule, *TestSymbolModulePtr;
+
+// 힙 프로파일 파일에 기록할 접힌 호출 경로 한 줄(반환 주소가 달라도 함수 이름이 같은 호출 경로는 한 줄로 합친다)
+typedef struct _test_folded_stack_t
+{
+	// "테스트케이스.테스트이름;호출자;...;할당한 함수" 문자열(malloc 으로 생성)
+	char *frames;
+	// 추정 할당 크기
+	double bytes;
+} TestFoldedStack, *TestFoldedStackPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// 읽어 둔 심볼 테이블 리스트(프로세스 전체에서 공유)
+static TestSymbolTable _symbolTables[TEST_MAX_SYMBOL_TABLES];
+static int _numberOfSymbolTables = 0;
+
+// 심볼 테이블 리스트를 보호하기 위한 잠금(작업자 스레드들이 동시에 프로파일을 기록할 수 있다)
+static pthread_mutex_t _symbolLock = PTHREAD_MUTEX_INITIALIZER;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static long long GetNextSampleInterval(TestHeapProfilePtr heapProfile);
+static TestHeapStackPtr MapHeapStacks(size_t capacity);
+static int GrowHeapStacks(TestHeapProfilePtr heapProfile);
+static unsigned long long HashHeapStack(void *const *frames, int depth);
+static const TestSymbol *FindSymbol(uintptr_t address, const char **objectName, uintptr_t *offset);
+static TestSymbolTablePtr LoadSymbolTable(const char *path, uintptr_t base);
+static int FindSymbolModule(struct dl_phdr_info *info, size_t size, void *data);
+static int CompareSymbols(const void *left, const void *right);
+static char *FoldHeapStack(TestPtr test, TestHeapStackPtr stack);
+static int CompareFoldedStacks(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestHeapProfilePtr GetTestHeapProfile(TestAllocationTrackerPtr tracker, long long sampleBytes)
+ * @brief 메모리 할당 기록의 힙 프로파일을 반환하는 함수(처음 호출될 때 생성한다)
+ * backtrace 는 처음 호출될 때 libgcc_s 를 읽으며 메모리를 할당하므로, 할당 함수 안에서 처음 호출되지 않도록 여기서 미리 호출한다.
+ * @param tracker 테스트를 실행할 스레드의 메모리 할당 기록(입력, 출력)
+ * @param sampleBytes 표본 사이의 평균 할당 크기(입력)
+ * @return 성공 시 힙 프로파일, 실패 시 NULL 반환
+ */
+TestHeapProfilePtr GetTestHeapProfile(TestAllocationTrackerPtr tracker, long long sampleBytes)
+{
+	if (tracker->heapProfile != NULL)
+	{
+		return tracker->heapProfile;
+	}
+
+	TestHeapProfilePtr heapProfile = (TestHeapProfilePtr)calloc(1, sizeof(TestHeapProfile));
+	if (heapProfile == NULL)
+	{
+		return NULL;
+	}
+
+	heapProfile->stacks = MapHeapStacks(TEST_HEAP_STACK_TABLE_SIZE);
+	if (heapProfile->stacks == NULL)
+	{
+		free(heapProfile);
+		return NULL;
+	}
+	heapProfile->capacity = TEST_HEAP_STACK_TABLE_SIZE;
+	heapProfile->sampleBytes = (sampleBytes > 0) ? sampleBytes : 1;
+
+	void *frames[TEST_HEAP_BACKTRACE_DEPTH];
+	backtrace(frames, TEST_HEAP_BACKTRACE_DEPTH);
+
+	tracker->heapProfile = heapProfile;
+
+	return heapProfile;
+}
+
+/**
+ * @fn void StartTestHeapProfile(TestHeapProfilePtr heapProfile, int testIndex)
+ * @brief 이전 테스트의 표본을 지우고 새 테스트의 표본 수집을 준비하는 함수
+ * 표본 간격의 난수는 테스트 번호로 초기화하므로 같은 테스트는 실행할 때마다 같은 할당이 표본으로 선택된다.
+ * @param heapProfile 힙 프로파일(입력, 출력)
+ * @param testIndex 실행할 테스트 번호(입력)
+ * @return 반환값 없음
+ */
+void StartTestHeapProfile(TestHeapProfilePtr heapProfile, int testIndex)
+{
+	if (heapProfile->count > 0)
+	{
+		memset(heapProfile->stacks, 0, sizeof(TestHeapStack) * heapProfile->capacity);
+		heapProfile->count = 0;
+	}
+	heapProfile->overflowed = FALSE;
+	heapProfile->randomState = 0x9E3779B97F4A7C15ULL ^ ((unsigned long long)testIndex + 1);
+	heapProfile->bytesUntilSample = GetNextSampleInterval(heapProfile);
+}
+
+/**
+ * @fn void SampleTestHeapProfile(TestHeapProfilePtr heapProfile, size_t size, void *caller)
+ * @brief 표본 지점을 지난 할당의 호출 경로를 기록하는 함수(할당 함수에서 bytesUntilSample 이 0 이하가 되면 호출한다)
+ * 표본 지점은 평균 sampleBytes 바이트 간격의 푸아송 과정이므로 size 바이트 할당이 선택될 확률은 1 - exp(-size / sampleBytes) 이고,
+ * 그 역수를 곱한 크기를 기록하여 전체 할당 크기의 편향 없는 추정값을 얻는다.
+ * @param heapProfile 힙 프로파일(입력, 출력)
+ * @param size 할당 크기(입력)
+ * @param caller 할당 함수를 호출한 코드의 주소(이보다 안쪽의 프레임은 기록하지 않는다, 입력)
+ * @return 반환값 없음
+ */
+void SampleTestHeapProfile(TestHeapProfilePtr heapProfile, size_t size, void *caller)
+{
+	heapProfile->bytesUntilSample = GetNextSampleInterval(heapProfile);
+
+	// The unwinder may take locks and allocate, so keep the timeout and the allocation records away from it
+	HoldTestWatchdog();
+	PauseTestAllocations();
+
+	void *frames[TEST_HEAP_BACKTRACE_DEPTH];
+	int depth = backtrace(frames, TEST_HEAP_BACKTRACE_DEPTH);
+
+	int firstFrame = 0;
+	for (; firstFrame < depth && frames[firstFrame] != caller; firstFrame++)
+	{
+	}
+	if (firstFrame == depth)
+	{
+		firstFrame = 0;
+	}
+	depth -= firstFrame;
+	if (depth > TEST_HEAP_PROFILE_DEPTH)
+	{
+		depth = TEST_HEAP_PROFILE_DEPTH;
+	}
+
+	double probability = 1.0 - exp(-(double)size / (double)heapProfile->sampleBytes);
+	double weight = (probability > 0.0) ? (double)size / probability : (double)heapProfile->sampleBytes;
+
+	if (depth <= 0)
+	{
+		heapProfile->overflowed = TRUE;
+	}
+	// Keep the load factor at or below one half so that probe chains stay short
+	else if ((heapProfile->count + 1) * 2 > heapProfile->capacity && GrowHeapStacks(heapProfile) != 0)
+	{
+		heapProfile->overflowed = TRUE;
+	}
+	else
+	{
+		unsigned long long hash = HashHeapStack(&frames[firstFrame], depth);
+		size_t mask = heapProfile->capacity - 1;
+		size_t position = (size_t)hash & mask;
+		for (;;)
+		{
+			TestHeapStackPtr stack = &heapProfile->stacks[position];
+			if (stack->depth == 0)
+			{
+				stack->hash = hash;
+				stack->depth = depth;
+				memcpy(stack->frames, &frames[firstFrame], sizeof(void*) * (size_t)depth);
+				heapProfile->count++;
+			}
+			if (stack->hash == hash && stack->depth == depth && memcmp(stack->frames, &frames[firstFrame], sizeof(void*) * (size_t)depth) == 0)
+			{
+				stack->samples++;
+				stack->bytes += weight;
+				stack->allocations += weight / (double)((size > 0) ? size : 1);
+				break;
+			}
+			position = (position + 1) & mask;
+		}
+	}
+
+	ResumeTestAllocations();
+	ReleaseTestWatchdog();
+}
+
+/**
+ * @fn int WriteTestHeapProfile(TestSuitPtr testSuit, int testIndex, TestHeapProfilePtr heapProfile)
+ * @brief 테스트 하나의 힙 프로파일을 접힌 호출 경로(folded stack) 파일로 기록하는 함수
+ * 파일은 heapProfilePath 디렉터리의 "테스트케이스.테스트이름.heap" 이며, 한 줄에 "테스트케이스.테스트이름;호출자;...;할당한 함수 추정 할당 크기" 를 기록한다
+ * (flamegraph.pl, speedscope, inferno 등에서 바로 읽을 수 있다). 호출 경로는 테스트 함수에서 자르고, 표본이 없으면 파일을 만들지 않는다.
+ * 같은 문자열이 되는 호출 경로는 할당 크기를 더해 한 줄로 합치고, stackcollapse 스크립트의 출력처럼 호출 경로의 사전 순으로 기록한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 기록할 테스트 번호(입력)
+ * @param heapProfile 표본 수집을 마친 힙 프로파일(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int WriteTestHeapProfile(TestSuitPtr testSuit, int testIndex, TestHeapProfilePtr heapProfile)
+{
+	if (heapProfile->count == 0)
+	{
+		return 0;
+	}
+
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+	const char *directory = testSuit->options.heapProfilePath;
+	size_t pathLength = strlen(directory) + strlen(test->testCase) + strlen(test->testName) + 8;
+	char *path = (char*)malloc(pathLength);
+	if (path == NULL)
+	{
+		return -1;
+	}
+	snprintf(path, pathLength, "%s/%s.%s.heap", directory, test->testCase, test->testName);
+
+	TestFoldedStackPtr foldedStacks = (TestFoldedStackPtr)calloc(heapProfile->count, sizeof(TestFoldedStack));
+	if (foldedStacks == NULL)
+	{
+		free(path);
+		return -1;
+	}
+
+	size_t numberOfFoldedStacks = 0;
+	int folded = TRUE;
+	size_t stackIndex = 0;
+	for (; stackIndex < heapProfile->capacity && numberOfFoldedStacks < heapProfile->count; stackIndex++)
+	{
+		TestHeapStackPtr stack = &heapProfile->stacks[stackIndex];
+		if (stack->depth == 0)
+		{
+			continue;
+		}
+
+		char *frames = FoldHeapStack(test, stack);
+		if (frames == NULL)
+		{
+			folded = FALSE;
+			break;
+		}
+		foldedStacks[numberOfFoldedStacks].frames = frames;
+		foldedStacks[numberOfFoldedStacks].bytes = stack->bytes;
+		numberOfFoldedStacks++;
+	}
+	qsort(foldedStacks, numberOfFoldedStacks, sizeof(TestFoldedStack), CompareFoldedStacks);
+
+	FILE *output = (folded == TRUE) ? fopen(path, "w") : NULL;
+	free(path);
+
+	size_t foldedIndex = 0;
+	while (output != NULL && foldedIndex < numberOfFoldedStacks)
+	{
+		// Sorting put stacks that fold to the same string next to each other
+		double bytes = foldedStacks[foldedIndex].bytes;
+		size_t nextIndex = foldedIndex + 1;
+		for (; nextIndex < numberOfFoldedStacks && strcmp(foldedStacks[nextIndex].frames, foldedStacks[foldedIndex].frames) == 0; nextIndex++)
+		{
+			bytes += foldedStacks[nextIndex].bytes;
+		}
+
+		fprintf(output, "%s %lld\n", foldedStacks[foldedIndex].frames, (long long)(bytes + 0.5));
+		foldedIndex = nextIndex;
+	}
+
+	for (foldedIndex = 0; foldedIndex < numberOfFoldedStacks; foldedIndex++)
+	{
+		free(foldedStacks[foldedIndex].frames);
+	}
+	free(foldedStacks);
+
+	if (output == NULL)
+	{
+		return -1;
+	}
+
+	if (heapProfile->overflowed == TRUE)
+	{
+		fprintf(output, "%s.%s;[dropped] 0\n", test->testCase, test->testName);
+	}
+
+	return (fclose(output) == 0) ? 0 : -1;
+}
+
+/**
+ * @fn void DeleteTestHeapProfile(TestAllocationTrackerPtr tracker)
+ * @brief 메모리 할당 기록의 힙 프로파일을 삭제하는 함수
+ * @param tracker 메모리 할당 기록(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestHeapProfile(TestAllocationTrackerPtr tracker)
+{
+	TestHeapProfilePtr heapProfile = tracker->heapProfile;
+	if (heapProfile == NULL)
+	{
+		return;
+	}
+
+	tracker->heapProfile = NULL;
+	munmap(heapProfile->stacks, sizeof(TestHeapStack) * heapProfile->capacity);
+	free(heapProfile);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static long long GetNextSampleInterval(TestHeapProfilePtr heapProfile)
+ * @brief 다음 표본 지점까지의 할당 크기를 평균이 sampleBytes 인 지수 분포에서 뽑는 함수
+ * 할당 크기와 같은 주기로 반복되는 할당 패턴에서도 특정 할당만 선택되지 않도록 간격을 무작위로 정한다(xorshift64*).
+ * @param heapProfile 힙 프로파일(입력, 출력)
+ * @return 다음 표본 지점까지의 할당 크기(1 이상) 반환
+ */
+static long long GetNextSampleInterval(TestHeapProfilePtr heapProfile)
+{
+	unsigned long long state = heapProfile->randomState;
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	heapProfile->randomState = state;
+
+	// A uniform value in (0, 1] from the upper 53 bits
+	double uniform = ((double)((state * 0x2545F4914F6CDD1DULL) >> 11) + 1.0) / 9007199254740992.0;
+	long long interval = (long long)(-log(uniform) * (double)heapProfile->sampleBytes);
+
+	return (interval > 0) ? interval : 1;
+}
+
+/**
+ * @fn static TestHeapStackPtr MapHeapStacks(size_t capacity)
+ * @brief 0 으로 초기화된 호출 경로 테이블을 mmap 으로 생성하는 함수(할당 함수 안에서 호출되므로 malloc 을 사용하지 않는다)
+ * @param capacity 테이블 크기(입력)
+ * @return 성공 시 테이블 주소, 실패 시 NULL 반환
+ */
+static TestHeapStackPtr MapHeapStacks(size_t capacity)
+{
+	void *stacks = mmap(NULL, sizeof(TestHeapStack) * capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (stacks != MAP_FAILED) ? (TestHeapStackPtr)stacks : NULL;
+}
+
+/**
+ * @fn static int GrowHeapStacks(TestHeapProfilePtr heapProfile)
+ * @brief 호출 경로 테이블을 두 배로 늘리고 기록된 호출 경로들을 옮기는 함수
+ * @param heapProfile 힙 프로파일(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int GrowHeapStacks(TestHeapProfilePtr heapProfile)
+{
+	size_t capacity = heapProfile->capacity * 2;
+	TestHeapStackPtr stacks = MapHeapStacks(capacity);
+	if (stacks == NULL)
+	{
+		return -1;
+	}
+
+	size_t stackIndex = 0;
+	for (; stackIndex < heapProfile->capacity; stackIndex++)
+	{
+		TestHeapStackPtr stack = &heapProfile->stacks[stackIndex];
+		if (stack->depth == 0)
+		{
+			continue;
+		}
+
+		size_t position = (size_t)stack->hash & (capacity - 1);
+		while (stacks[position].depth != 0)
+		{
+			position = (position + 1) & (capacity - 1);
+		}
+		stacks[position] = *stack;
+	}
+
+	munmap(heapProfile->stacks, sizeof(TestHeapStack) * heapProfile->capacity);
+	heapProfile->stacks = stacks;
+	heapProfile->capacity = capacity;
+
+	return 0;
+}
+
+/**
+ * @fn static unsigned long long HashHeapStack(void *const *frames, int depth)
+ * @brief 호출 경로의 해시 값을 계산하는 함수(FNV-1a)
+ * @param frames 프레임 주소 리스트(입력)
+ * @param depth 프레임 개수(입력)
+ * @return 해시 값 반환
+ */
+static unsigned long long HashHeapStack(void *const *frames, int depth)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	int frameIndex = 0;
+	for (; frameIndex < depth; frameIndex++)
+	{
+		hash ^= (unsigned long long)(uintptr_t)frames[frameIndex];
+		hash *= 1099511628211ULL;
+	}
+
+	// Mix the high bits into the low bits used as the table position
+	return hash ^ (hash >> 29);
+}
+
+/**
+ * @fn static const TestSymbol *FindSymbol(uintptr_t address, const char **objectName, uintptr_t *offset)
+ * @brief 주소가 속한 함수 심볼을 찾는 함수
+ * 실행 파일과 공유 라이브러리의 ELF 심볼 테이블(.symtab, 없으면 .dynsym)을 처음 필요할 때 읽어 프로세스가 끝날 때까지 재사용한다.
+ * 정적 함수도 찾을 수 있도록 dladdr 대신 ELF 파일을 직접 읽는다.
+ * @param address 찾을 주소(입력)
+ * @param objectName 주소가 속한 파일 이름(심볼을 찾지 못했을 때 출력에 사용, 출력)
+ * @param offset 파일의 적재 주소로부터의 거리(출력)
+ * @return 찾았으면 함수 심볼, 못 찾았으면 NULL 반환
+ */
+static const TestSymbol *FindSymbol(uintptr_t address, const char **objectName, uintptr_t *offset)
+{
+	TestSymbolModule module;
+	module.address = address;
+	module.path = NULL;
+	module.base = 0;
+	module.found = FALSE;
+	dl_iterate_phdr(FindSymbolModule, &module);
+
+	*objectName = "??";
+	*offset = address;
+	if (module.found == FALSE)
+	{
+		return NULL;
+	}
+	*offset = address - module.base;
+
+	pthread_mutex_lock(&_symbolLock);
+
+	TestSymbolTablePtr table = NULL;
+	int tableIndex = 0;
+	for (; tableIndex < _numberOfSymbolTables; tableIndex++)
+	{
+		if (_symbolTables[tableIndex].base == module.base)
+		{
+			table = &_symbolTables[tableIndex];
+			break;
+		}
+	}
+	if (table == NULL)
+	{
+		table = LoadSymbolTable(module.path, module.base);
+	}
+
+	const TestSymbol *symbol = NULL;
+	if (table != NULL)
+	{
+		*objectName = table->objectName;
+
+		// Find the last symbol that starts at or before the address
+		size_t low = 0;
+		size_t high = table->numberOfSymbols;
+		while (low < high)
+		{
+			size_t middle = low + (high - low) / 2;
+			if (table->symbols[middle].address <= address)
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+		if (low > 0)
+		{
+			const TestSymbol *candidate = &table->symbols[low - 1];
+			if (candidate->size == 0 || address < candidate->address + candidate->size)
+			{
+				symbol = candidate;
+			}
+		}
+	}
+
+	pthread_mutex_unlock(&_symbolLock);
+
+	return symbol;
+}
+
+/**
+ * @fn static TestSymbolTablePtr LoadSymbolTable(const char *path, uintptr_t base)
+ * @brief ELF 파일의 함수 심볼들을 읽어 심볼 테이블 리스트에 추가하는 함수(_symbolLock 을 잡은 상태에서 호출한다)
+ * 파일을 읽지 못해도 빈 심볼 테이블을 추가하여 같은 파일을 다시 읽으려 하지 않는다.
+ * @param path ELF 파일 경로(빈 문자열이면 현재 실행 파일, 입력)
+ * @param base 적재 주소(입력)
+ * @return 성공 시 추가된 심볼 테이블, 리스트가 가득 찼으면 NULL 반환
+ */
+static TestSymbolTablePtr LoadSymbolTable(const char *path, uintptr_t base)
+{
+	if (_numberOfSymbolTables >= TEST_MAX_SYMBOL_TABLES)
+	{
+		return NULL;
+	}
+
+	TestSymbolTablePtr table = &_symbolTables[_numberOfSymbolTables++];
+	memset(table, 0, sizeof(TestSymbolTable));
+	table->base = base;
+
+	int isExecutable = (path == NULL || *path == '\0') ? TRUE : FALSE;
+	const char *fileName = isExecutable ? program_invocation_short_name : path;
+	const char *slash = strrchr(fileName, '/');
+	snprintf(table->objectName, sizeof(table->objectName), "%s", (slash != NULL) ? slash + 1 : fileName);
+
+	int fd = open(isExecutable ? "/proc/self/exe" : path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		return table;
+	}
+
+	struct stat status;
+	if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(ElfW(Ehdr)))
+	{
+		close(fd);
+		return table;
+	}
+
+	void *image = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (image == MAP_FAILED)
+	{
+		return table;
+	}
+
+	size_t imageSize = (size_t)status.st_size;
+	const unsigned char *bytes = (const unsigned char*)image;
+	const ElfW(Ehdr) *header = (const ElfW(Ehdr)*)image;
+	if (memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 || header->e_shentsize != sizeof(ElfW(Shdr)) || header->e_shoff == 0 || header->e_shoff + (size_t)header->e_shnum * sizeof(ElfW(Shdr)) > imageSize)
+	{
+		munmap(image, imageSize);
+		return table;
+	}
+
+	// Prefer the full symbol table and fall back to the dynamic one of a stripped object
+	const ElfW(Shdr) *sections = (const ElfW(Shdr)*)(bytes + header->e_shoff);
+	const ElfW(Shdr) *symbolSection = NULL;
+	int sectionIndex = 0;
+	for (; sectionIndex < header->e_shnum; sectionIndex++)
+	{
+		if (sections[sectionIndex].sh_type == SHT_SYMTAB || (sections[sectionIndex].sh_type == SHT_DYNSYM && symbolSection == NULL))
+		{
+			symbolSection = &sections[sectionIndex];
+		}
+	}
+	if (symbolSection == NULL || symbolSection->sh_link >= header->e_shnum || symbolSection->sh_offset + symbolSection->sh_size > imageSize)
+	{
+		munmap(image, imageSize);
+		return table;
+	}
+
+	const ElfW(Shdr) *stringSection = &sections[symbolSection->sh_link];
+	if (stringSection->sh_offset + stringSection->sh_size > imageSize)
+	{
+		munmap(image, imageSize);
+		return table;
+	}
+
+	const ElfW(Sym) *elfSymbols = (const ElfW(Sym)*)(bytes + symbolSection->sh_offset);
+	size_t numberOfElfSymbols = symbolSection->sh_size / sizeof(ElfW(Sym));
+	const char *strings = (const char*)(bytes + stringSection->sh_offset);
+
+	table->symbols = (TestSymbolPtr)malloc(sizeof(TestSymbol) * (numberOfElfSymbols + 1));
+	if (table->symbols == NULL)
+	{
+		munmap(image, imageSize);
+		return table;
+	}
+
+	size_t symbolIndex = 0;
+	for (; symbolIndex < numberOfElfSymbols; symbolIndex++)
+	{
+		const ElfW(Sym) *elfSymbol = &elfSymbols[symbolIndex];
+		int type = ELF64_ST_TYPE(elfSymbol->st_info);
+		if ((type != STT_FUNC && type != STT_GNU_IFUNC) || elfSymbol->st_shndx == SHN_UNDEF || elfSymbol->st_value == 0 || elfSymbol->st_name >= stringSection->sh_size)
+		{
+			continue;
+		}
+
+		TestSymbolPtr symbol = &table->symbols[table->numberOfSymbols++];
+		symbol->address = base + (uintptr_t)elfSymbol->st_value;
+		symbol->size = (size_t)elfSymbol->st_size;
+		symbol->name = strings + elfSymbol->st_name;
+	}
+	qsort(table->symbols, table->numberOfSymbols, sizeof(TestSymbol), CompareSymbols);
+
+	table->image = image;
+	table->imageSize = imageSize;
+
+	return table;
+}
+
+/**
+ * @fn static int FindSymbolModule(struct dl_phdr_info *info, size_t size, void *data)
+ * @brief (dl_iterate_phdr 콜백) 주소가 속한 실행 파일 또는 공유 라이브러리를 찾는 함수
+ * @param info 실행 파일 또는 공유 라이브러리 정보(입력)
+ * @param size info 구조체 크기(입력)
+ * @param data 찾을 주소와 결과를 저장할 TestSymbolModule 구조체(입력, 출력)
+ * @return 찾았으면 1(순회 중단), 못 찾았으면 0 반환
+ */
+static int FindSymbolModule(struct dl_phdr_info *info, size_t size, void *data)
+{
+	(void)size;
+	TestSymbolModulePtr module = (TestSymbolModulePtr)data;
+
+	int headerIndex = 0;
+	for (; headerIndex < info->dlpi_phnum; headerIndex++)
+	{
+		const ElfW(Phdr) *header = &info->dlpi_phdr[headerIndex];
+		uintptr_t begin = (uintptr_t)info->dlpi_addr + (uintptr_t)header->p_vaddr;
+		if (header->p_type == PT_LOAD && module->address >= begin && module->address < begin + (uintptr_t)header->p_memsz)
+		{
+			module->path = info->dlpi_name;
+			module->base = (uintptr_t)info->dlpi_addr;
+			module->found = TRUE;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @fn static int CompareSymbols(const void *left, const void *right)
+ * @brief 함수 심볼을 시작 주소의 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 심볼(입력)
+ * @param right 비교할 심볼(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareSymbols(const void *left, const void *right)
+{
+	uintptr_t leftAddress = ((const TestSymbol*)left)->address;
+	uintptr_t rightAddress = ((const TestSymbol*)right)->address;
+
+	return (leftAddress > rightAddress) - (leftAddress < rightAddress);
+}
+
+/**
+ * @fn static char *FoldHeapStack(TestPtr test, TestHeapStackPtr stack)
+ * @brief 호출 경로 하나를 "테스트케이스.테스트이름;호출자;...;할당한 함수" 문자열로 만드는 함수
+ * 프레임은 할당 함수를 호출한 코드부터 바깥쪽 순서이므로 테스트 함수에서 자르고 거꾸로 출력한다.
+ * @param test 호출 경로를 기록한 테스트(입력)
+ * @param stack 호출 경로(입력)
+ * @return 성공 시 malloc 으로 만든 문자열, 실패 시 NULL 반환
+ */
+static char *FoldHeapStack(TestPtr test, TestHeapStackPtr stack)
+{
+	int numberOfFrames = stack->depth;
+	const TestSymbol *symbols[TEST_HEAP_PROFILE_DEPTH];
+	const char *objectNames[TEST_HEAP_PROFILE_DEPTH];
+	uintptr_t offsets[TEST_HEAP_PROFILE_DEPTH];
+	int frameIndex = 0;
+	for (; frameIndex < stack->depth; frameIndex++)
+	{
+		// A return address may point just past the end of its function after a call that never returns
+		symbols[frameIndex] = FindSymbol((uintptr_t)stack->frames[frameIndex] - 1, &objectNames[frameIndex], &offsets[frameIndex]);
+		if (symbols[frameIndex] != NULL && symbols[frameIndex]->address == (uintptr_t)test->testFunc)
+		{
+			numberOfFrames = frameIndex;
+			break;
+		}
+	}
+
+	char *frames = NULL;
+	size_t length = 0;
+	FILE *output = open_memstream(&frames, &length);
+	if (output == NULL)
+	{
+		return NULL;
+	}
+
+	fprintf(output, "%s.%s", test->testCase, test->testName);
+	for (frameIndex = numberOfFrames - 1; frameIndex >= 0; frameIndex--)
+	{
+		if (symbols[frameIndex] != NULL)
+		{
+			fprintf(output, ";%s", symbols[frameIndex]->name);
+		}
+		else
+		{
+			fprintf(output, ";%s+0x%lx", objectNames[frameIndex], (unsigned long)offsets[frameIndex]);
+		}
+	}
+
+	if (fclose(output) != 0)
+	{
+		free(frames);
+		return NULL;
+	}
+
+	return frames;
+}
+
+/**
+ * @fn static int CompareFoldedStacks(const void *left, const void *right)
+ * @brief 접힌 호출 경로를 문자열의 사전 순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 호출 경로(입력)
+ * @param right 비교할 호출 경로(입력)
+ * @return left 가 앞이면 음수, 같으면 0, 뒤면 양수 반환
+ */
+static int CompareFoldedStacks(const void *left, const void *right)
+{
+	return strcmp(((const TestFoldedStack*)left)->frames, ((const TestFoldedStack*)right)->frames);
+}
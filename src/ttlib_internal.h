@@ -0,0 +1,301 @@
+#ifndef __TTLIB_INTERNAL_H__
+#define __TTLIB_INTERNAL_H__
+
+// 라이브러리 소스 파일 간에만 공유하는 선언들(사용자 코드에서는 사용하지 않는다)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include "../include/ttlib.h"
+
+#include <setjmp.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <time.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+/// Internal Macros
+//////////////////////////////////////////////////////////////////////////////////
+
+// 나노초를 밀리초로 변환하기 위한 값
+#define NANOSECONDS_PER_MILLISECOND 1000000.0
+
+// 테스트마다 측정하는 하드웨어 성능 카운터 개수(TestPerfCounterResult 의 카운터 필드 개수)
+#define TEST_NUMBER_OF_PERF_COUNTERS 5
+
+// 힙 프로파일 표본 하나에 기록하는 최대 호출 경로 깊이
+#define TEST_HEAP_PROFILE_DEPTH 32
+
+//////////////////////////////////////////////////////////////////////////////////
+/// Internal Definitions
+//////////////////////////////////////////////////////////////////////////////////
+
+// 순차 실행과 작업자 스레드에서 테스트 하나의 제한 시간을 감시하기 위한 구조체(TestContext 객체마다 하나)
+typedef struct _test_watchdog_t
+{
+	// 제한 시간이 지났을 때 돌아갈 RunTest 함수의 중단 지점
+	sigjmp_buf jumpBuffer;
+	// 테스트를 실행하는 스레드로 시그널을 보내는 타이머
+	timer_t timer;
+	// 타이머가 동작 중인지 여부(시그널 처리 함수에서 사용)
+	volatile sig_atomic_t armed;
+	// 중단을 미루고 있는 라이브러리 내부 작업 깊이
+	volatile sig_atomic_t held;
+	// 중단을 미루는 동안 제한 시간이 지났는지 여부
+	volatile sig_atomic_t expired;
+} TestWatchdog, *TestWatchdogPtr;
+
+// 테스트를 실행하는 스레드의 하드웨어 성능 카운터 그룹(TestContext 객체마다 하나)
+typedef struct _test_perf_counters_t
+{
+	// 그룹 대표 카운터(cycles)의 파일 디스크립터
+	int leaderFd;
+	// 카운터별 파일 디스크립터(TestPerfCounterResult 의 필드 순서, 열지 못한 카운터는 -1)
+	int fds[TEST_NUMBER_OF_PERF_COUNTERS];
+} TestPerfCounters, *TestPerfCountersPtr;
+
+// 테스트가 할당하고 아직 해제하지 않은 블록 하나의 기록
+typedef struct _test_allocation_entry_t
+{
+	// 할당된 메모리 주소(NULL 이면 빈 자리)
+	void *address;
+	// 요청한 크기
+	size_t size;
+	// 할당 함수를 호출한 코드의 주소(누수 위치 출력에 사용)
+	void *caller;
+	// 테스트 안에서의 할당 순서
+	long long sequence;
+} TestAllocationEntry, *TestAllocationEntryPtr;
+
+// 힙 프로파일에서 같은 호출 경로로 선택된 할당 표본들의 집계
+typedef struct _test_heap_stack_t
+{
+	// 호출 경로의 해시 값
+	unsigned long long hash;
+	// 프레임 개수(0 이면 빈 자리)
+	int depth;
+	// 할당 함수를 호출한 코드부터 바깥쪽으로의 반환 주소 리스트
+	void *frames[TEST_HEAP_PROFILE_DEPTH];
+	// 선택된 표본 개수
+	long long samples;
+	// 추정 할당 크기(표본이 선택될 확률의 역수로 보정)
+	double bytes;
+	// 추정 할당 횟수
+	double allocations;
+} TestHeapStack, *TestHeapStackPtr;
+
+// 테스트를 실행하는 스레드의 힙 프로파일(메모리 할당 기록마다 하나)
+typedef struct _test_heap_profile_t
+{
+	// 호출 경로를 찾는 선형 탐사 해시 테이블(mmap 으로 생성)
+	TestHeapStackPtr stacks;
+	// 테이블 크기(2 의 거듭제곱)
+	size_t capacity;
+	// 테이블에 기록된 호출 경로 개수
+	size_t count;
+	// 표본 사이의 평균 할당 크기
+	long long sampleBytes;
+	// 다음 표본 지점까지 남은 할당 크기
+	long long bytesUntilSample;
+	// 표본 간격을 정하는 난수 상태
+	unsigned long long randomState;
+	// 테이블을 늘리지 못해 기록하지 못한 표본이 있는지 여부
+	int overflowed;
+} TestHeapProfile, *TestHeapProfilePtr;
+
+// 테스트를 실행하는 스레드의 메모리 할당 기록(TestContext 객체마다 하나)
+typedef struct _test_allocation_tracker_t
+{
+	// 해제되지 않은 블록을 주소로 찾는 선형 탐사 해시 테이블(mmap 으로 생성)
+	TestAllocationEntryPtr entries;
+	// 테이블 크기(2 의 거듭제곱)
+	size_t capacity;
+	// 테이블에 기록된(해제되지 않은) 블록 개수
+	size_t count;
+	// 해제되지 않은 블록들의 크기 합
+	long long liveBytes;
+	// 다음 할당 순서
+	long long sequence;
+	// 현재 테스트의 할당 집계
+	TestAllocationResult result;
+	// 할당을 기록 중인지 여부(테스트 함수 실행 중에만 TRUE)
+	int active;
+	// 기록을 멈춘 라이브러리 내부 작업 깊이
+	int paused;
+	// 테이블을 늘리지 못해 기록하지 못한 블록이 있는지 여부
+	int overflowed;
+	// 힙 프로파일(힙 프로파일 옵션을 지정했을 때만 생성)
+	TestHeapProfilePtr heapProfile;
+} TestAllocationTracker, *TestAllocationTrackerPtr;
+
+// ASYNC_TEST 가 이벤트 루프에 등록한 파일 디스크립터나 타이머 하나
+typedef struct _test_async_watch_t
+{
+	// 감시하는 파일 디스크립터(타이머는 라이브러리가 만든 timerfd)
+	int fd;
+	// ASYNC_TIMER 로 만든 타이머인지 여부(한 번 호출하거나 해제할 때 닫는다)
+	int isTimer;
+	// 등록되어 있는지 여부(해제된 항목은 받은 이벤트를 모두 처리한 뒤 삭제한다)
+	int active;
+	// 준비되면 호출할 콜백 함수
+	TestAsyncFunc callback;
+	// 콜백 함수에 전달할 인자
+	void *data;
+	// 등록한 테스트의 TestContext 객체(콜백 함수를 이 객체에서 실행한다)
+	TestContextPtr context;
+	// 이벤트 루프에 등록된 다음 항목
+	struct _test_async_watch_t *next;
+} TestAsyncWatch, *TestAsyncWatchPtr;
+
+// ASYNC_TEST 들의 epoll 이벤트 루프(한 스레드에서만 사용한다)
+typedef struct _test_event_loop_t
+{
+	// epoll 파일 디스크립터
+	int epollFd;
+	// 등록된 항목 리스트
+	TestAsyncWatchPtr watches;
+	// 여러 테스트가 함께 사용하는지 여부(TRUE 면 RunAsyncTest 가 시작 코드만 실행하고 이벤트는 RunAsyncTests 가 처리한다)
+	int shared;
+} TestEventLoop, *TestEventLoopPtr;
+
+// TestContext 의 실패 정보 기록 버퍼에 저장되는 레코드 헤더
+// site 가 있으면 헤더 뒤에 인자 값 기록(messageLength 바이트)이 붙고, 없으면 매크로 함수 이름, 파일 이름, 메시지가 NULL 문자를 포함하여 차례로 붙는다.
+// 작업자 프로세스는 같은 실행 파일에서 fork 되므로 site 포인터를 그대로 부모 프로세스에 전달한다.
+typedef struct _test_failure_record_t
+{
+	// PRINT_FAIL 호출 위치의 정적 기술자(ReportTestFailure 로 포맷팅한 실패이면 NULL)
+	const TestFailureSite *site;
+	// 실패한 소스 줄 번호(site 가 없을 때)
+	int lineNumber;
+	// 매크로 함수 이름 길이(NULL 문자 제외, site 가 없을 때)
+	int macroLength;
+	// 파일 이름 길이(NULL 문자 제외, site 가 없을 때)
+	int fileLength;
+	// 메시지 길이(NULL 문자 제외) 또는 인자 값 기록 길이(site 가 있을 때)
+	int messageLength;
+} TestFailureRecord, *TestFailureRecordPtr;
+
+//////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+//////////////////////////////////////////////////////////////////////////////////
+
+// ttlib.c
+void InitializeTestContext(TestContextPtr context, TestSuitPtr testSuit, int streamFailures);
+void ResetTestContext(TestContextPtr context, int testIndex);
+void ReleaseTestContext(TestContextPtr context);
+void RunTest(TestSuitPtr testSuit, int testIndex, TestReportPtr report, TestContextPtr context);
+int MergeTestReports(TestSuitPtr testSuit, int start, int count);
+
+// ttlib_async.c
+int RunAsyncTests(TestSuitPtr testSuit, int start, int count, int asyncLimit);
+void DeleteTestEventLoop(TestContextPtr context);
+
+// ttlib_process.c
+int RunTestsInProcesses(TestSuitPtr testSuit, int start, int count, int numberOfJobs);
+void SendTestFailureRecord(TestContextPtr context, const char *record, size_t recordLength);
+
+// ttlib_thread.c
+int RunTestsInThreads(TestSuitPtr testSuit, int start, int count, int numberOfThreads);
+
+// ttlib_filter.c
+int SelectTests(TestSuitPtr testSuit);
+void DeleteTestNameIndex(TestSuitPtr testSuit);
+void PrintTestList(TestSuitPtr testSuit);
+
+// ttlib_shard.c
+int ShardTests(TestSuitPtr testSuit);
+int SaveTestTimings(TestSuitPtr testSuit);
+
+// ttlib_cache.c
+int PrepareTestCache(TestSuitPtr testSuit);
+int IsTestResultCached(TestSuitPtr testSuit, int testIndex);
+int GetNumberOfCachedTests(TestSuitPtr testSuit);
+int SaveTestCache(TestSuitPtr testSuit);
+void DeleteTestCache(TestSuitPtr testSuit);
+
+// ttlib_watchdog.c
+int GetTestTimeout(TestSuitPtr testSuit, int testIndex);
+TestWatchdogPtr GetTestWatchdog(TestContextPtr context);
+void ArmTestWatchdog(TestWatchdogPtr watchdog, int timeoutMilliseconds);
+void DisarmTestWatchdog(TestWatchdogPtr watchdog);
+void HoldTestWatchdog(void);
+void ReleaseTestWatchdog(void);
+void DeleteTestWatchdog(TestContextPtr context);
+
+// ttlib_perf.c
+int ProbeTestPerfCounters(void);
+int ReadPerfEventParanoid(void);
+TestPerfCountersPtr GetTestPerfCounters(TestContextPtr context);
+void StartTestPerfCounters(TestPerfCountersPtr perfCounters);
+void PauseTestPerfCounters(TestPerfCountersPtr perfCounters);
+void StopTestPerfCounters(TestPerfCountersPtr perfCounters, TestPerfCounterResultPtr result);
+void DeleteTestPerfCounters(TestContextPtr context);
+
+// ttlib_alloc.c
+TestAllocationTrackerPtr GetTestAllocationTracker(TestContextPtr context);
+void StartTestAllocations(TestAllocationTrackerPtr tracker);
+void StopTestAllocations(TestAllocationTrackerPtr tracker, TestAllocationResultPtr result);
+void PauseTestAllocations(void);
+void ResumeTestAllocations(void);
+void ReportTestLeaks(TestSuitPtr testSuit, int testIndex, TestAllocationTrackerPtr tracker);
+void DeleteTestAllocationTracker(TestContextPtr context);
+
+// ttlib_heap.c
+TestHeapProfilePtr GetTestHeapProfile(TestAllocationTrackerPtr tracker, long long sampleBytes);
+void StartTestHeapProfile(TestHeapProfilePtr heapProfile, int testIndex);
+void SampleTestHeapProfile(TestHeapProfilePtr heapProfile, size_t size, void *caller);
+int WriteTestHeapProfile(TestSuitPtr testSuit, int testIndex, TestHeapProfilePtr heapProfile);
+void DeleteTestHeapProfile(TestAllocationTrackerPtr tracker);
+
+// ttlib_fixture.c
+int PrepareTestFixtures(TestSuitPtr testSuit);
+int AcquireTestFixture(TestSuitPtr testSuit, int testIndex);
+TestResult RunTestFunction(TestSuitPtr testSuit, int testIndex);
+void RunTestCaseFixture(TestSuitPtr testSuit, int testIndex, int kind);
+void ReleaseTestFixture(TestSuitPtr testSuit, int testIndex);
+int BuildTestFixtureSnapshot(TestSuitPtr testSuit);
+void FinishTestFixtures(TestSuitPtr testSuit);
+void DeleteTestFixtures(TestSuitPtr testSuit);
+
+// ttlib_baseline.c
+int LoadBenchmarkBaseline(TestSuitPtr testSuit);
+void CompareBenchmarkBaseline(TestContextPtr context, const double *samples, int numberOfSamples);
+int SaveBenchmarkBaseline(TestSuitPtr testSuit);
+void DeleteBenchmarkBaseline(TestSuitPtr testSuit);
+
+// ttlib_timing.c
+long long GetMonotonicTime(void);
+long long GetThreadCpuTime(void);
+unsigned long long ReadCycleCounter(void);
+
+// ttlib_order.c
+int ParseTestOrder(const char *name);
+const char *GetTestOrderName(int order);
+int OrderTests(TestSuitPtr testSuit);
+int SaveTestState(TestSuitPtr testSuit);
+
+// ttlib_watch.c
+int WatchTests(TestSuitPtr testSuit);
+int IsWatchedTestSource(TestSuitPtr testSuit, int testIndex);
+
+// ttlib_plugin.c
+void UnloadTestPlugins(TestSuitPtr testSuit);
+
+// ttlib_failure.c
+long long EncodeTestFailureArguments(const char *format, va_list args, char *buffer, size_t size);
+int FormatTestFailureMessage(const char *format, const char *arguments, size_t argumentsLength, char *buffer, size_t size);
+int OpenTestFailureLog(TestSuitPtr testSuit);
+void WriteTestFailureLog(TestSuitPtr testSuit, int testIndex, const TestFailureRecord *record, const char *data);
+void FlushTestFailureLog(TestSuitPtr testSuit);
+int CloseTestFailureLog(TestSuitPtr testSuit);
+
+// ttlib_report.c
+int HasTestReporter(const char *name);
+void ReportTestStart(TestSuitPtr testSuit);
+void ReportTestBegin(TestSuitPtr testSuit, int testIndex);
+void ReportTestEnd(TestSuitPtr testSuit, int testIndex, const TestReport *report);
+void ReportTestFinish(TestSuitPtr testSuit, int numberOfCurTests);
+void ReplayTestResult(TestSuitPtr testSuit, int testIndex, const char *failureLog, size_t failureLogLength, const TestReport *report);
+
+#endif
+
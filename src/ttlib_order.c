@@ -0,0 +1,436 @@
+#include "ttlib_internal.h"
+
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 실행 시간 기록이 하나도 없을 때 테스트 하나에 가정하는 실행 시간(나노초)
+#define TEST_DEFAULT_DURATION 1000000LL
+
+// 상태 파일의 첫 줄
+#define TEST_STATE_HEADER "# ttlib state: result elapsed_ns testCase.testName\n"
+
+// 상태 파일에 기록된 테스트 하나의 마지막 실행 결과
+typedef struct _test_state_t
+{
+	// 마지막 실행 결과(TestSuccess, TestFail, TestCrash, TestTimeout, 기록이 없으면 TestNotRun)
+	TestResult result;
+	// 마지막 실행 시간(나노초, 기록이 없으면 -1)
+	long long duration;
+} TestState, *TestStatePtr;
+
+// 실행 순서 결정에 사용하는 테스트 하나의 정보
+typedef struct _test_order_item_t
+{
+	// 테스트 번호
+	int testIndex;
+	// 정렬 전 실행 순서
+	int position;
+	// 실행 순서 그룹(작을수록 먼저 실행)
+	int group;
+	// 예상 실행 시간(나노초)
+	long long duration;
+} TestOrderItem, *TestOrderItemPtr;
+
+// 실행 순서 이름 목록(TestOrder 순서)
+static const char *_testOrderNames[] =
+{
+	"defined",
+	"failed-first",
+	"longest-first"
+};
+
+// 상태 파일에 기록하는 실행 결과와 이름(TestNotRun 은 기록하지 않는다)
+typedef struct _test_state_result_t
+{
+	// 실행 결과
+	TestResult result;
+	// 상태 파일에 기록하는 이름
+	const char *name;
+} TestStateResult;
+
+// 상태 파일에 기록하는 실행 결과 이름 목록
+static const TestStateResult _testStateResults[] =
+{
+	{ TestSuccess, "pass" },
+	{ TestFail, "fail" },
+	{ TestCrash, "crash" },
+	{ TestTimeout, "timeout" }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static TestStatePtr LoadTestStates(TestSuitPtr testSuit, const char *path);
+static int ParseStateLine(TestSuitPtr testSuit, char *line, TestStatePtr state);
+static const char *GetStateResultName(TestResult result);
+static int CompareOrderItems(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int ParseTestOrder(const char *name)
+ * @brief 실행 순서 이름을 TestOrder 값으로 변환하는 함수
+ * @param name 실행 순서 이름(입력, defined, failed-first, longest-first)
+ * @return 성공 시 TestOrder 값, 알 수 없는 이름이면 -1 반환
+ */
+int ParseTestOrder(const char *name)
+{
+	int order = 0;
+	for (; order < (int)(sizeof(_testOrderNames) / sizeof(_testOrderNames[0])); order++)
+	{
+		if (strcmp(_testOrderNames[order], name) == 0)
+		{
+			return order;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @fn const char *GetTestOrderName(int order)
+ * @brief TestOrder 값에 해당하는 실행 순서 이름을 반환하는 함수
+ * @param order 실행 순서(입력)
+ * @return 실행 순서 이름, 알 수 없는 값이면 "defined" 반환
+ */
+const char *GetTestOrderName(int order)
+{
+	if (order < 0 || order >= (int)(sizeof(_testOrderNames) / sizeof(_testOrderNames[0])))
+	{
+		return _testOrderNames[TestOrderDefined];
+	}
+
+	return _testOrderNames[order];
+}
+
+/**
+ * @fn int OrderTests(TestSuitPtr testSuit)
+ * @brief 상태 파일에 기록된 지난 실행 결과를 사용하여 selectedTests 의 실행 순서를 바꾸는 함수
+ * failed-first : 지난 실행에서 실패(TestFail, TestCrash, TestTimeout)한 테스트, 기록이 없는 테스트, 성공한 테스트 순서로 실행한다.
+ * longest-first : 지난 실행 시간이 긴 테스트부터 실행하여 작업자 프로세스(스레드)들이 비슷한 시간에 끝나도록 한다.
+ *                 기록이 없는 테스트는 기록된 테스트들의 평균 실행 시간으로 가정한다.
+ * 같은 그룹, 같은 실행 시간이면 원래 실행 순서를 유지하므로 상태 파일이 없으면 실행 순서가 바뀌지 않는다.
+ * 샤드 분배 이후에 호출되므로 샤드 간 테스트 분배에는 영향을 주지 않는다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int OrderTests(TestSuitPtr testSuit)
+{
+	int numberOfTests = testSuit->numberOfSelectedTests;
+	if (testSuit->options.testOrder == TestOrderDefined || testSuit->options.statePath == NULL || numberOfTests <= 1)
+	{
+		return 0;
+	}
+
+	TestStatePtr states = LoadTestStates(testSuit, testSuit->options.statePath);
+	if (states == NULL)
+	{
+		// Nothing recorded yet, keep the defined order
+		return 0;
+	}
+
+	TestOrderItemPtr items = (TestOrderItemPtr)malloc(sizeof(TestOrderItem) * (size_t)numberOfTests);
+	if (items == NULL)
+	{
+		free(states);
+		return -1;
+	}
+
+	// Tests without a record are assumed to take the average recorded time
+	long long totalDuration = 0;
+	int numberOfRecorded = 0;
+	int position = 0;
+	for (; position < numberOfTests; position++)
+	{
+		long long duration = states[testSuit->selectedTests[position]].duration;
+		if (duration >= 0)
+		{
+			totalDuration += duration;
+			numberOfRecorded++;
+		}
+	}
+	long long defaultDuration = (numberOfRecorded > 0) ? totalDuration / numberOfRecorded : TEST_DEFAULT_DURATION;
+
+	for (position = 0; position < numberOfTests; position++)
+	{
+		int testIndex = testSuit->selectedTests[position];
+		TestStatePtr state = &states[testIndex];
+
+		items[position].testIndex = testIndex;
+		items[position].position = position;
+		items[position].group = 0;
+		items[position].duration = 0;
+
+		if (testSuit->options.testOrder == TestOrderFailedFirst)
+		{
+			items[position].group = (state->result == TestSuccess) ? 2 : (state->result == TestNotRun) ? 1 : 0;
+		}
+		else if (testSuit->options.testOrder == TestOrderLongestFirst)
+		{
+			items[position].duration = (state->duration >= 0) ? state->duration : defaultDuration;
+		}
+	}
+	qsort(items, (size_t)numberOfTests, sizeof(TestOrderItem), CompareOrderItems);
+
+	for (position = 0; position < numberOfTests; position++)
+	{
+		testSuit->selectedTests[position] = items[position].testIndex;
+	}
+
+	free(items);
+	free(states);
+
+	return 0;
+}
+
+/**
+ * @fn int SaveTestState(TestSuitPtr testSuit)
+ * @brief 실행된 테스트들의 실행 결과와 실행 시간을 상태 파일에 반영하는 함수
+ * 이번에 실행되지 않은 테스트(필터, 샤드, 다른 실행 파일의 테스트 포함)와 결과 캐시에서 결과를 재사용한 테스트의 기록은 그대로 유지하고,
+ * 실행된 테스트는 이번 실행 결과와 실행 시간으로 기록을 바꾼다(실패 여부는 마지막 실행을 따라야 하므로 평균하지 않는다).
+ * 임시 파일에 기록한 뒤 rename 하므로 기록 중에 다른 실행이 읽어도 깨진 파일을 보지 않는다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int SaveTestState(TestSuitPtr testSuit)
+{
+	const char *path = testSuit->options.statePath;
+	if (path == NULL || testSuit->testReports == NULL)
+	{
+		return 0;
+	}
+
+	size_t pathLength = strlen(path);
+	char *temporaryPath = (char*)malloc(pathLength + 32);
+	if (temporaryPath == NULL)
+	{
+		return -1;
+	}
+	snprintf(temporaryPath, pathLength + 32, "%s.%ld.tmp", path, (long)getpid());
+
+	FILE *output = fopen(temporaryPath, "w");
+	if (output == NULL)
+	{
+		free(temporaryPath);
+		return -1;
+	}
+	fputs(TEST_STATE_HEADER, output);
+
+	// Keep the records of tests which did not run this time
+	FILE *input = fopen(path, "r");
+	if (input != NULL)
+	{
+		char *line = NULL;
+		size_t lineCapacity = 0;
+		while (getline(&line, &lineCapacity, input) > 0)
+		{
+			if (line[0] == '#')
+			{
+				continue;
+			}
+
+			char *record = strdup(line);
+			if (record == NULL)
+			{
+				continue;
+			}
+
+			TestState state;
+			int testIndex = ParseStateLine(testSuit, line, &state);
+			if (testIndex < 0 || testSuit->testReports[testIndex].result == TestNotRun || testSuit->testReports[testIndex].cached == TRUE)
+			{
+				fputs(record, output);
+				if (record[strlen(record) - 1] != '\n')
+				{
+					fputc('\n', output);
+				}
+			}
+			free(record);
+		}
+		free(line);
+		fclose(input);
+	}
+
+	// Append the tests of this run
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		TestReportPtr report = &testSuit->testReports[testIndex];
+		if (report->result == TestNotRun || report->cached == TRUE)
+		{
+			continue;
+		}
+
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		fprintf(output, "%s %lld %s.%s\n", GetStateResultName(report->result), report->elapsedNanoseconds, test->testCase, test->testName);
+	}
+
+	int result = (fclose(output) == 0 && rename(temporaryPath, path) == 0) ? 0 : -1;
+	if (result != 0)
+	{
+		unlink(temporaryPath);
+	}
+	free(temporaryPath);
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static TestStatePtr LoadTestStates(TestSuitPtr testSuit, const char *path)
+ * @brief 상태 파일을 읽어 테스트 번호별 마지막 실행 결과 리스트를 만드는 함수
+ * 상태 파일 형식 : 한 줄에 "실행결과(pass, fail, crash, timeout) 실행시간(나노초) testCase.testName", '#' 으로 시작하는 줄은 무시한다.
+ * 같은 테스트가 여러 번 기록되어 있으면 마지막 기록을 사용한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param path 상태 파일 경로(입력)
+ * @return 성공 시 테스트 번호별 실행 결과 리스트, 파일이 없거나 실패 시 NULL 반환
+ */
+static TestStatePtr LoadTestStates(TestSuitPtr testSuit, const char *path)
+{
+	FILE *input = fopen(path, "r");
+	if (input == NULL)
+	{
+		return NULL;
+	}
+
+	TestStatePtr states = (TestStatePtr)malloc(sizeof(TestState) * (size_t)((testSuit->numberOfTests > 0) ? testSuit->numberOfTests : 1));
+	if (states == NULL)
+	{
+		fclose(input);
+		return NULL;
+	}
+
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		states[testIndex].result = TestNotRun;
+		states[testIndex].duration = -1;
+	}
+
+	char *line = NULL;
+	size_t lineCapacity = 0;
+	while (getline(&line, &lineCapacity, input) > 0)
+	{
+		TestState state;
+		testIndex = ParseStateLine(testSuit, line, &state);
+		if (testIndex >= 0)
+		{
+			states[testIndex] = state;
+		}
+	}
+	free(line);
+	fclose(input);
+
+	return states;
+}
+
+/**
+ * @fn static int ParseStateLine(TestSuitPtr testSuit, char *line, TestStatePtr state)
+ * @brief 상태 파일의 한 줄을 해석하여 테스트 번호와 실행 결과를 얻는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param line 해석할 줄(입력, 해석 중에 변경된다)
+ * @param state 실행 결과를 저장할 변수(출력)
+ * @return 성공 시 테스트 번호, 현재 실행 파일에 없는 테스트이거나 잘못된 줄이면 -1 반환
+ */
+static int ParseStateLine(TestSuitPtr testSuit, char *line, TestStatePtr state)
+{
+	if (line[0] == '#')
+	{
+		return -1;
+	}
+
+	char *separator = strchr(line, ' ');
+	if (separator == NULL)
+	{
+		return -1;
+	}
+	*separator = '\0';
+
+	size_t resultIndex = 0;
+	for (; resultIndex < sizeof(_testStateResults) / sizeof(_testStateResults[0]); resultIndex++)
+	{
+		if (strcmp(_testStateResults[resultIndex].name, line) == 0)
+		{
+			break;
+		}
+	}
+	if (resultIndex == sizeof(_testStateResults) / sizeof(_testStateResults[0]))
+	{
+		return -1;
+	}
+
+	char *duration = separator + 1;
+	char *end = NULL;
+	state->result = _testStateResults[resultIndex].result;
+	state->duration = strtoll(duration, &end, 10);
+	if (end == duration || *end != ' ' || state->duration < 0)
+	{
+		return -1;
+	}
+
+	char *testCase = end + 1;
+	char *testName = strchr(testCase, '.');
+	if (testName == NULL)
+	{
+		return -1;
+	}
+	*testName++ = '\0';
+	testName[strcspn(testName, "\r\n")] = '\0';
+
+	return FindTest(testSuit, testCase, testName);
+}
+
+/**
+ * @fn static const char *GetStateResultName(TestResult result)
+ * @brief 실행 결과를 상태 파일에 기록하는 이름으로 변환하는 함수
+ * @param result 실행 결과(입력)
+ * @return 실행 결과 이름, 성공이 아닌 알 수 없는 결과는 "fail" 반환
+ */
+static const char *GetStateResultName(TestResult result)
+{
+	size_t resultIndex = 0;
+	for (; resultIndex < sizeof(_testStateResults) / sizeof(_testStateResults[0]); resultIndex++)
+	{
+		if (_testStateResults[resultIndex].result == result)
+		{
+			return _testStateResults[resultIndex].name;
+		}
+	}
+
+	return "fail";
+}
+
+/**
+ * @fn static int CompareOrderItems(const void *left, const void *right)
+ * @brief 실행 순서 정보를 그룹 오름차순, 실행 시간 내림차순, 원래 실행 순서 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 실행 순서 정보(입력)
+ * @param right 비교할 실행 순서 정보(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareOrderItems(const void *left, const void *right)
+{
+	const TestOrderItem *leftItem = (const TestOrderItem*)left;
+	const TestOrderItem *rightItem = (const TestOrderItem*)right;
+
+	if (leftItem->group != rightItem->group)
+	{
+		return leftItem->group - rightItem->group;
+	}
+	if (leftItem->duration != rightItem->duration)
+	{
+		return (leftItem->duration > rightItem->duration) ? -1 : 1;
+	}
+
+	return leftItem->position - rightItem->position;
+}
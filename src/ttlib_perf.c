@@ -0,0 +1,266 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// perf_event_paranoid 설정 파일 경로
+#define TEST_PERF_EVENT_PARANOID_PATH "/proc/sys/kernel/perf_event_paranoid"
+
+// 측정할 카운터 하나의 perf_event_open 설정
+typedef struct _test_perf_event_t
+{
+	// 이벤트 종류(PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE)
+	unsigned int type;
+	// 이벤트 설정값
+	unsigned long long config;
+} TestPerfEvent;
+
+// 카운터 그룹을 한 번에 읽은 결과(PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING)
+typedef struct _test_perf_group_read_t
+{
+	// 읽은 카운터 개수
+	unsigned long long numberOfValues;
+	// 그룹이 활성화된 시간(나노초)
+	unsigned long long timeEnabled;
+	// 그룹이 실제로 PMU 에서 측정된 시간(나노초, 다중화되면 timeEnabled 보다 작다)
+	unsigned long long timeRunning;
+	// 카운터 값(그룹에 추가된 순서)
+	unsigned long long values[TEST_NUMBER_OF_PERF_COUNTERS];
+} TestPerfGroupRead;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// 측정할 카운터 리스트(TestPerfCounterResult 의 필드 순서, 첫 번째가 그룹 대표)
+static const TestPerfEvent _perfEvents[TEST_NUMBER_OF_PERF_COUNTERS] = {
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+	{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+	{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int OpenPerfEvent(const TestPerfEvent *event, int groupFd);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int ProbeTestPerfCounters(void)
+ * @brief 현재 환경에서 하드웨어 성능 카운터를 사용할 수 있는지 확인하는 함수
+ * 컨테이너나 가상 머신, perf_event_paranoid 설정에 따라 perf_event_open 이 막혀 있을 수 있으므로
+ * 테스트를 실행하기 전에 한 번 확인하고, 사용할 수 없으면 카운터 없이 테스트를 실행한다.
+ * @return 사용할 수 있으면 0, 없으면 원인(errno) 반환
+ */
+int ProbeTestPerfCounters(void)
+{
+	int fd = OpenPerfEvent(&_perfEvents[0], -1);
+	if (fd < 0)
+	{
+		return (errno != 0) ? errno : ENOENT;
+	}
+	close(fd);
+
+	return 0;
+}
+
+/**
+ * @fn int ReadPerfEventParanoid(void)
+ * @brief 커널의 perf_event_paranoid 설정값을 읽는 함수(카운터를 사용할 수 없는 원인을 출력할 때 사용)
+ * @return 설정값, 읽을 수 없으면 -100 반환
+ */
+int ReadPerfEventParanoid(void)
+{
+	FILE *input = fopen(TEST_PERF_EVENT_PARANOID_PATH, "r");
+	if (input == NULL)
+	{
+		return -100;
+	}
+
+	int paranoid = -100;
+	if (fscanf(input, "%d", &paranoid) != 1)
+	{
+		paranoid = -100;
+	}
+	fclose(input);
+
+	return paranoid;
+}
+
+/**
+ * @fn TestPerfCountersPtr GetTestPerfCounters(TestContextPtr context)
+ * @brief TestContext 객체의 하드웨어 성능 카운터를 반환하는 함수(처음 호출될 때 현재 스레드를 측정하는 카운터 그룹을 연다)
+ * 카운터들은 cycles 를 대표로 하는 하나의 그룹으로 열어 항상 같은 구간을 측정하게 한다.
+ * 대표 카운터 외의 카운터는 CPU 가 지원하지 않으면 빼고 측정한다(결과 값 -1).
+ * TestContext 객체는 생성한 작업자 스레드에서만 사용되므로 카운터는 항상 테스트를 실행하는 스레드를 측정한다.
+ * @param context 테스트를 실행할 TestContext 객체(입력, 출력)
+ * @return 성공 시 하드웨어 성능 카운터, 실패 시 NULL 반환(카운터 없이 실행된다)
+ */
+TestPerfCountersPtr GetTestPerfCounters(TestContextPtr context)
+{
+	if (context->perfCounters != NULL)
+	{
+		return context->perfCounters;
+	}
+
+	TestPerfCountersPtr perfCounters = (TestPerfCountersPtr)malloc(sizeof(TestPerfCounters));
+	if (perfCounters == NULL)
+	{
+		return NULL;
+	}
+
+	perfCounters->leaderFd = OpenPerfEvent(&_perfEvents[0], -1);
+	if (perfCounters->leaderFd < 0)
+	{
+		free(perfCounters);
+		return NULL;
+	}
+
+	perfCounters->fds[0] = perfCounters->leaderFd;
+	int counterIndex = 1;
+	for (; counterIndex < TEST_NUMBER_OF_PERF_COUNTERS; counterIndex++)
+	{
+		perfCounters->fds[counterIndex] = OpenPerfEvent(&_perfEvents[counterIndex], perfCounters->leaderFd);
+	}
+
+	context->perfCounters = perfCounters;
+
+	return perfCounters;
+}
+
+/**
+ * @fn void StartTestPerfCounters(TestPerfCountersPtr perfCounters)
+ * @brief 하드웨어 성능 카운터 그룹을 0 으로 초기화하고 측정을 시작하는 함수(측정 중에 호출하면 처음부터 다시 측정한다)
+ * @param perfCounters 하드웨어 성능 카운터(입력)
+ * @return 반환값 없음
+ */
+void StartTestPerfCounters(TestPerfCountersPtr perfCounters)
+{
+	ioctl(perfCounters->leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(perfCounters->leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+/**
+ * @fn void PauseTestPerfCounters(TestPerfCountersPtr perfCounters)
+ * @brief 하드웨어 성능 카운터 그룹의 측정을 잠시 멈추는 함수(값은 StopTestPerfCounters 로 읽을 때까지 유지된다)
+ * @param perfCounters 하드웨어 성능 카운터(입력)
+ * @return 반환값 없음
+ */
+void PauseTestPerfCounters(TestPerfCountersPtr perfCounters)
+{
+	ioctl(perfCounters->leaderFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+/**
+ * @fn void StopTestPerfCounters(TestPerfCountersPtr perfCounters, TestPerfCounterResultPtr result)
+ * @brief 하드웨어 성능 카운터 그룹의 측정을 멈추고 결과를 저장하는 함수
+ * 다른 프로세스와 PMU 를 나눠 쓰느라 그룹이 일부 시간만 측정되었으면(다중화) 측정된 비율로 값을 보정한다.
+ * @param perfCounters 하드웨어 성능 카운터(입력)
+ * @param result 측정 결과를 저장할 구조체(출력)
+ * @return 반환값 없음
+ */
+void StopTestPerfCounters(TestPerfCountersPtr perfCounters, TestPerfCounterResultPtr result)
+{
+	ioctl(perfCounters->leaderFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+	long long *values[TEST_NUMBER_OF_PERF_COUNTERS] = { &result->cycles, &result->instructions, &result->l1dMisses, &result->llcMisses, &result->branchMisses };
+	int counterIndex = 0;
+	for (; counterIndex < TEST_NUMBER_OF_PERF_COUNTERS; counterIndex++)
+	{
+		*values[counterIndex] = -1;
+	}
+	result->measured = FALSE;
+
+	TestPerfGroupRead groupRead;
+	memset(&groupRead, 0, sizeof(groupRead));
+	if (read(perfCounters->leaderFd, &groupRead, sizeof(groupRead)) <= 0 || groupRead.timeRunning == 0)
+	{
+		return;
+	}
+
+	double scale = (groupRead.timeRunning < groupRead.timeEnabled) ? (double)groupRead.timeEnabled / (double)groupRead.timeRunning : 1.0;
+
+	// The values come in the order the counters joined the group
+	unsigned long long valueIndex = 0;
+	for (counterIndex = 0; counterIndex < TEST_NUMBER_OF_PERF_COUNTERS && valueIndex < groupRead.numberOfValues; counterIndex++)
+	{
+		if (perfCounters->fds[counterIndex] >= 0)
+		{
+			*values[counterIndex] = (long long)((double)groupRead.values[valueIndex++] * scale);
+		}
+	}
+	result->measured = TRUE;
+}
+
+/**
+ * @fn void DeleteTestPerfCounters(TestContextPtr context)
+ * @brief TestContext 객체의 하드웨어 성능 카운터를 닫는 함수
+ * @param context TestContext 객체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestPerfCounters(TestContextPtr context)
+{
+	TestPerfCountersPtr perfCounters = context->perfCounters;
+	if (perfCounters == NULL)
+	{
+		return;
+	}
+
+	// Close the members before the group leader
+	int counterIndex = TEST_NUMBER_OF_PERF_COUNTERS - 1;
+	for (; counterIndex >= 0; counterIndex--)
+	{
+		if (perfCounters->fds[counterIndex] >= 0)
+		{
+			close(perfCounters->fds[counterIndex]);
+		}
+	}
+	free(perfCounters);
+	context->perfCounters = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int OpenPerfEvent(const TestPerfEvent *event, int groupFd)
+ * @brief 현재 스레드의 사용자 공간 실행만 측정하는 카운터를 여는 함수
+ * 커널 실행을 제외하므로 perf_event_paranoid 가 2 이하면 권한 없이 열 수 있다.
+ * @param event 카운터 설정(입력)
+ * @param groupFd 그룹 대표 카운터의 파일 디스크립터(-1 이면 새 그룹의 대표로 연다, 입력)
+ * @return 성공 시 파일 디스크립터, 실패 시 -1 반환(errno 에 원인이 저장된다)
+ */
+static int OpenPerfEvent(const TestPerfEvent *event, int groupFd)
+{
+	struct perf_event_attr attribute;
+	memset(&attribute, 0, sizeof(attribute));
+	attribute.size = sizeof(attribute);
+	attribute.type = event->type;
+	attribute.config = event->config;
+	attribute.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	if (groupFd < 0)
+	{
+		// Members follow the leader, which starts disabled until StartTestPerfCounters
+		attribute.disabled = 1;
+	}
+	attribute.exclude_kernel = 1;
+	attribute.exclude_hv = 1;
+
+	errno = 0;
+
+	return (int)syscall(SYS_perf_event_open, &attribute, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC);
+}
@@ -0,0 +1,192 @@
+#include "ttlib_internal.h"
+
+#include <dlfcn.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 테스트 스위트 공유 라이브러리의 레코드 범위를 얻는 함수(GetTestPluginRecords)의 형식
+typedef void (*TestPluginEntry)(TestPluginRecordsPtr records);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void *MergeRecords(const void *records, int numberOfRecords, const void *newRecords, int numberOfNewRecords);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestInitializationResult LoadTestPlugin(TestSuitPtr testSuit, const char *path)
+ * @brief 테스트 스위트 공유 라이브러리(-DTTLIB_PLUGIN 으로 빌드)를 읽어 그 테스트, 픽스처, 테스트 데이터 파일 레코드를 TestSuit 객체에 추가하는 함수
+ * 여러 번 호출하면 여러 스위트의 테스트가 한 TestSuit 객체에 합쳐지므로 한 번의 RunAllTests 로 함께 선택, 분배, 실행, 보고된다.
+ * 테스트 번호는 이미 등록된 테스트 뒤에 읽은 순서대로 이어진다. 공유 라이브러리는 RTLD_LOCAL 로 읽으므로
+ * 스위트마다 자기 링커 섹션의 레코드를 반환하고, 라이브러리 함수와 스레드별 테스트 상태는 실행 파일이 링크한 libtt.so 를 함께 사용한다.
+ * 읽은 공유 라이브러리는 DeleteTestSuit 함수에서 닫는다.
+ * 실패 원인은 dlerror 함수로 확인할 수 있다(레코드 범위가 잘못된 경우 제외).
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param path 테스트 스위트 공유 라이브러리 경로(입력, '/' 가 없으면 dlopen 의 검색 경로에서 찾는다)
+ * @return 성공 시 TestInitializationResultSuccess, 실패 시 TestInitializationResultFail 반환
+ */
+TestInitializationResult LoadTestPlugin(TestSuitPtr testSuit, const char *path)
+{
+	// Check parameter
+	if (testSuit == NULL || path == NULL)
+	{
+		return TestInitializationResultFail;
+	}
+
+	void **pluginHandles = (void**)realloc(testSuit->pluginHandles, sizeof(void*) * (size_t)(testSuit->numberOfPlugins + 1));
+	if (pluginHandles == NULL)
+	{
+		return TestInitializationResultFail;
+	}
+	testSuit->pluginHandles = pluginHandles;
+
+	void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	if (handle == NULL)
+	{
+		return TestInitializationResultFail;
+	}
+
+	TestPluginEntry getRecords = NULL;
+	*(void**)&getRecords = dlsym(handle, TEST_PLUGIN_ENTRY_NAME);
+	if (getRecords == NULL)
+	{
+		dlclose(handle);
+		return TestInitializationResultFail;
+	}
+
+	TestPluginRecords records;
+	memset(&records, 0, sizeof(records));
+	getRecords(&records);
+	if (records.testsBegin > records.testsEnd || records.fixturesBegin > records.fixturesEnd || records.dataBegin > records.dataEnd)
+	{
+		dlclose(handle);
+		return TestInitializationResultFail;
+	}
+
+	// Sections without records have NULL bounds
+	int numberOfNewTests = (records.testsBegin == NULL) ? 0 : (int)(records.testsEnd - records.testsBegin);
+	int numberOfNewFixtures = (records.fixturesBegin == NULL) ? 0 : (int)(records.fixturesEnd - records.fixturesBegin);
+	int numberOfNewData = (records.dataBegin == NULL) ? 0 : (int)(records.dataEnd - records.dataBegin);
+
+	TestPtr *tests = (TestPtr*)MergeRecords(testSuit->testPtrContainer, testSuit->numberOfTests, records.testsBegin, numberOfNewTests);
+	TestFixturePtr *fixtures = (TestFixturePtr*)MergeRecords(testSuit->fixturePtrContainer, testSuit->numberOfFixtures, records.fixturesBegin, numberOfNewFixtures);
+	TestDataPtr *data = (TestDataPtr*)MergeRecords(testSuit->dataPtrContainer, testSuit->numberOfData, records.dataBegin, numberOfNewData);
+	if (tests == NULL || fixtures == NULL || data == NULL)
+	{
+		free(tests);
+		free(fixtures);
+		free(data);
+		dlclose(handle);
+		return TestInitializationResultFail;
+	}
+
+	// The merged lists replace the previous ones, which may point into the linker sections
+	free(testSuit->pluginTests);
+	free(testSuit->pluginFixtures);
+	free(testSuit->pluginData);
+
+	testSuit->pluginTests = tests;
+	testSuit->testPtrContainer = tests;
+	testSuit->numberOfTests += numberOfNewTests;
+	testSuit->pluginFixtures = fixtures;
+	testSuit->fixturePtrContainer = fixtures;
+	testSuit->numberOfFixtures += numberOfNewFixtures;
+	testSuit->pluginData = data;
+	testSuit->dataPtrContainer = data;
+	testSuit->numberOfData += numberOfNewData;
+
+	testSuit->pluginHandles[testSuit->numberOfPlugins++] = handle;
+
+	// The name index and the fixture groups are rebuilt for the merged lists
+	DeleteTestNameIndex(testSuit);
+	DeleteTestFixtures(testSuit);
+
+	return TestInitializationResultSuccess;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void UnloadTestPlugins(TestSuitPtr testSuit)
+ * @brief LoadTestPlugin 함수로 합친 레코드 리스트를 해제하고 읽은 테스트 스위트 공유 라이브러리를 닫는 함수
+ * 레코드가 공유 라이브러리의 데이터를 가리키므로 TestSuit 객체의 다른 상태를 모두 삭제한 뒤 호출해야 한다.
+ * DeleteTestSuit 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 반환값 없음
+ */
+void UnloadTestPlugins(TestSuitPtr testSuit)
+{
+	if (testSuit->pluginTests != NULL)
+	{
+		testSuit->testPtrContainer = NULL;
+		testSuit->numberOfTests = 0;
+	}
+	if (testSuit->pluginFixtures != NULL)
+	{
+		testSuit->fixturePtrContainer = NULL;
+		testSuit->numberOfFixtures = 0;
+	}
+	if (testSuit->pluginData != NULL)
+	{
+		testSuit->dataPtrContainer = NULL;
+		testSuit->numberOfData = 0;
+	}
+
+	free(testSuit->pluginTests);
+	free(testSuit->pluginFixtures);
+	free(testSuit->pluginData);
+	testSuit->pluginTests = NULL;
+	testSuit->pluginFixtures = NULL;
+	testSuit->pluginData = NULL;
+
+	// Close in reverse order of loading
+	while (testSuit->numberOfPlugins > 0)
+	{
+		dlclose(testSuit->pluginHandles[--testSuit->numberOfPlugins]);
+	}
+	free(testSuit->pluginHandles);
+	testSuit->pluginHandles = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void *MergeRecords(const void *records, int numberOfRecords, const void *newRecords, int numberOfNewRecords)
+ * @brief 레코드 포인터 리스트 뒤에 새 레코드 포인터 리스트를 이어 붙인 리스트를 새로 할당하는 함수
+ * 테스트, 픽스처, 테스트 데이터 파일 레코드 포인터는 모두 const 포인터이므로 같은 크기로 복사한다.
+ * @param records 기존 레코드 포인터 리스트(입력, 없으면 NULL)
+ * @param numberOfRecords 기존 레코드 개수(입력)
+ * @param newRecords 이어 붙일 레코드 포인터 리스트(입력, 없으면 NULL)
+ * @param numberOfNewRecords 이어 붙일 레코드 개수(입력)
+ * @return 성공 시 합친 레코드 포인터 리스트, 실패 시 NULL 반환
+ */
+static void *MergeRecords(const void *records, int numberOfRecords, const void *newRecords, int numberOfNewRecords)
+{
+	size_t recordSize = sizeof(TestPtr);
+	char *mergedRecords = (char*)malloc(recordSize * (size_t)(numberOfRecords + numberOfNewRecords + 1));
+	if (mergedRecords == NULL)
+	{
+		return NULL;
+	}
+
+	if (numberOfRecords > 0)
+	{
+		memcpy(mergedRecords, records, recordSize * (size_t)numberOfRecords);
+	}
+	if (numberOfNewRecords > 0)
+	{
+		memcpy(mergedRecords + recordSize * (size_t)numberOfRecords, newRecords, recordSize * (size_t)numberOfNewRecords);
+	}
+
+	return mergedRecords;
+}
@@ -0,0 +1,652 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 작업자 프로세스 하나의 표준 출력 버퍼 크기(테스트 하나의 출력이 한 번에 기록되도록 사용)
+#define TEST_WORKER_OUTPUT_BUFFER_SIZE (64 * 1024)
+
+// 부모 프로세스가 작업자 프로세스들에게 테스트를 하나씩 나누어 주는 대기열
+typedef struct _test_queue_t
+{
+	// 다음에 실행할 테스트의 실행 순서(selectedTests 의 위치)
+	int nextIndex;
+	// 실행할 구간의 끝(포함하지 않는 실행 순서)
+	int endIndex;
+	// ASSERT 실패로 종료가 요청된 가장 앞선 실행 순서(요청이 없으면 구간의 끝)
+	int exitIndex;
+} TestQueue, *TestQueuePtr;
+
+// 작업자 프로세스가 부모 프로세스에게 전달하는 메시지 종류
+typedef enum _test_message_type_t
+{
+	// 실패 정보 기록 하나(검사 매크로 함수가 실패할 때마다 전달)
+	TestMessageFailure = 1,
+	// 테스트 실행 완료
+	TestMessageEnd
+} TestMessageType;
+
+// 작업자 프로세스가 소켓으로 전달하는 메시지 헤더(TestMessageFailure 이면 뒤에 실패 정보 기록이 이어진다)
+// 소켓은 작업자 프로세스마다 따로 있으므로 메시지가 다른 작업자의 메시지와 섞이지 않는다.
+// 반대 방향으로는 부모 프로세스가 다음에 실행할 테스트 번호(int, 종료할 때는 -1)를 전달한다.
+typedef struct _test_message_t
+{
+	// 메시지 종류
+	TestMessageType type;
+	// 테스트 번호
+	int testIndex;
+	// 테스트 실행 결과(TestMessageEnd 인 경우에만 사용)
+	TestReport report;
+	// 헤더 뒤에 이어지는 실패 정보 기록의 길이
+	size_t failureLogLength;
+} TestMessage, *TestMessagePtr;
+
+// 부모 프로세스가 작업자 프로세스에서 전달받은 현재 테스트의 실패 정보 기록을 모으는 버퍼(작업자마다 재사용)
+typedef struct _test_message_buffer_t
+{
+	// 실패 정보 기록 데이터
+	char *data;
+	// 기록된 길이
+	size_t length;
+	// 버퍼 크기
+	size_t capacity;
+} TestMessageBuffer, *TestMessageBufferPtr;
+
+// 부모 프로세스가 관리하는 작업자 프로세스 정보
+typedef struct _test_worker_t
+{
+	// 작업자 프로세스 ID(종료되었으면 -1)
+	pid_t pid;
+	// 작업자 프로세스와 메시지를 주고받기 위한 소켓 파일 디스크립터
+	int fd;
+	// 현재 실행 중인 테스트 번호(없으면 -1, 부모 프로세스가 테스트를 나누어 줄 때 기록한다)
+	int testIndex;
+	// 현재 실행 중인 테스트의 실행 순서(selectedTests 의 위치)
+	int position;
+	// 작업자 프로세스가 생성된 뒤 나누어 준 테스트 개수(포크 서버 모드에서 사용)
+	int numberOfRunTests;
+	// 현재 실행 중인 테스트의 시작 시각(나노초)
+	long long beginTime;
+	// 현재 실행 중인 테스트의 제한 시간(나노초, 0 이면 제한 없음)
+	long long timeoutNanoseconds;
+	// 제한 시간 초과로 부모 프로세스가 작업자 프로세스를 종료시킨 테스트 번호(없으면 -1)
+	int timedOutIndex;
+	// 현재 실행 중인 테스트의 실패 정보 기록
+	TestMessageBuffer failureLog;
+} TestWorker, *TestWorkerPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int SpawnTestWorker(TestSuitPtr testSuit, TestQueuePtr queue, TestWorkerPtr worker);
+static void RunTestWorker(TestSuitPtr testSuit, int fd);
+static int AssignTestToWorker(TestSuitPtr testSuit, TestQueuePtr queue, TestWorkerPtr worker);
+static void ReapTestWorker(TestSuitPtr testSuit, TestWorkerPtr worker);
+static int HasRemainingTests(TestQueuePtr queue);
+static int KillTimedOutWorkers(TestWorkerPtr workers, int numberOfJobs);
+static void RequestExitAt(TestQueuePtr queue, int position);
+static int WriteMessage(int fd, const TestMessage *message, const char *failureLog);
+static int ReadMessage(int fd, TestMessagePtr message, TestMessageBufferPtr failureLog);
+static int WriteAll(int fd, const void *data, size_t length);
+static ssize_t ReadAll(int fd, void *data, size_t length);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int RunTestsInProcesses(TestSuitPtr testSuit, int start, int count, int numberOfJobs)
+ * @brief 실행 순서의 한 구간에 있는 테스트들을 여러 작업자 프로세스에서 나누어 실행하는 함수
+ * 부모 프로세스가 대기열에서 테스트 번호를 하나씩 작업자 프로세스에게 나누어 주고, 작업자 프로세스는 실패 정보를 기록할 때마다, 그리고 테스트가 끝나면 결과를 소켓으로 전달한다.
+ * 작업자 프로세스는 결과를 전달한 뒤에야 다음 테스트를 받으므로 부모 프로세스는 각 작업자 프로세스가 실행 중인 테스트를 항상 정확히 안다.
+ * 리포터는 부모 프로세스에만 있으며, 테스트가 끝날 때마다 ReplayTestResult 함수로 전달받은 내용을 출력한다.
+ * 테스트 실행 중에 작업자 프로세스가 비정상 종료되면 그때까지 전달받은 실패 정보와 함께 해당 테스트를 TestCrash 로 기록하고 새 작업자 프로세스를 생성한다.
+ * 제한 시간이 있는 테스트를 실행 중인 작업자 프로세스는 제한 시간이 지나면 SIGKILL 로 종료시키고 해당 테스트를 TestTimeout 으로 기록한다.
+ * 포크 서버 모드(forkServerBatch 옵션)에서는 작업자 프로세스를 만들기 전에 선택된 테스트 케이스들의 SHARED_SETUP 을 실행해 두고,
+ * 작업자 프로세스가 테스트를 forkServerBatch 개 실행하면 종료시킨 뒤 초기화가 끝난 이 프로세스에서 새로 만든다.
+ * 따라서 테스트들은 서로의 전역 상태 변경을 보지 않으면서도 main 함수의 초기화와 공유 픽스처 생성 비용은 한 번만 치른다.
+ * 성공/실패 테스트 수는 MergeTestReports 함수로 집계하므로 순차 실행 결과와 같다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param start 구간의 첫 실행 순서(selectedTests 의 위치, 입력)
+ * @param count 구간의 테스트 개수(입력)
+ * @param numberOfJobs 동시에 실행할 작업자 프로세스 개수(입력)
+ * @return 실행된 것으로 집계된 테스트 개수 반환
+ */
+int RunTestsInProcesses(TestSuitPtr testSuit, int start, int count, int numberOfJobs)
+{
+	int numberOfTests = count;
+	if (numberOfJobs > numberOfTests)
+	{
+		numberOfJobs = numberOfTests;
+	}
+
+	TestQueue queue;
+	queue.nextIndex = start;
+	queue.endIndex = start + numberOfTests;
+	queue.exitIndex = queue.endIndex;
+
+	// Build the shared fixtures once so that every forked worker process inherits them
+	if (testSuit->options.forkServerBatch > 0)
+	{
+		BuildTestFixtureSnapshot(testSuit);
+	}
+
+	TestWorkerPtr workers = (TestWorkerPtr)calloc((size_t)numberOfJobs, sizeof(TestWorker));
+	struct pollfd *pollFds = (struct pollfd*)calloc((size_t)numberOfJobs, sizeof(struct pollfd));
+	int *pollWorkers = (int*)calloc((size_t)numberOfJobs, sizeof(int));
+	if (workers == NULL || pollFds == NULL || pollWorkers == NULL)
+	{
+		puts("작업자 프로세스 정보 생성 실패");
+		free(workers);
+		free(pollFds);
+		free(pollWorkers);
+		return 0;
+	}
+
+	// Start worker processes
+	int numberOfAliveWorkers = 0;
+	int workerIndex = 0;
+	for (; workerIndex < numberOfJobs; workerIndex++)
+	{
+		workers[workerIndex].pid = -1;
+		workers[workerIndex].fd = -1;
+		workers[workerIndex].testIndex = -1;
+		workers[workerIndex].timedOutIndex = -1;
+		if (SpawnTestWorker(testSuit, &queue, &workers[workerIndex]) == 0)
+		{
+			numberOfAliveWorkers++;
+		}
+	}
+
+	// Collect messages until every worker process has finished
+	while (numberOfAliveWorkers > 0)
+	{
+		int numberOfPollFds = 0;
+		for (workerIndex = 0; workerIndex < numberOfJobs; workerIndex++)
+		{
+			if (workers[workerIndex].pid > 0)
+			{
+				pollFds[numberOfPollFds].fd = workers[workerIndex].fd;
+				pollFds[numberOfPollFds].events = POLLIN;
+				pollFds[numberOfPollFds].revents = 0;
+				pollWorkers[numberOfPollFds] = workerIndex;
+				numberOfPollFds++;
+			}
+		}
+
+		// Wake up at the nearest test deadline, killing the workers whose test ran out of time
+		int pollTimeout = KillTimedOutWorkers(workers, numberOfJobs);
+		if (poll(pollFds, (nfds_t)numberOfPollFds, pollTimeout) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			puts("작업자 프로세스 메시지 대기 실패");
+			break;
+		}
+
+		int pollIndex = 0;
+		for (; pollIndex < numberOfPollFds; pollIndex++)
+		{
+			if (pollFds[pollIndex].revents == 0)
+			{
+				continue;
+			}
+
+			TestWorkerPtr worker = &workers[pollWorkers[pollIndex]];
+			TestMessage message;
+			if (ReadMessage(worker->fd, &message, &worker->failureLog) == 0)
+			{
+				if (message.type == TestMessageEnd && message.testIndex == worker->testIndex)
+				{
+					testSuit->testReports[message.testIndex] = message.report;
+					worker->testIndex = -1;
+					if (message.report.exitRequested == TRUE)
+					{
+						RequestExitAt(&queue, worker->position);
+					}
+					ReplayTestResult(testSuit, message.testIndex, worker->failureLog.data, worker->failureLog.length, &message.report);
+
+					// A worker process which is being killed for a timeout gets nothing more
+					if (worker->timedOutIndex < 0)
+					{
+						AssignTestToWorker(testSuit, &queue, worker);
+					}
+				}
+				continue;
+			}
+
+			// The socket was closed, so the worker process has terminated
+			ReapTestWorker(testSuit, worker);
+			numberOfAliveWorkers--;
+
+			// Replace a crashed worker process, or one which ran its fork server batch, while tests are still waiting
+			if (HasRemainingTests(&queue) == TRUE && SpawnTestWorker(testSuit, &queue, worker) == 0)
+			{
+				numberOfAliveWorkers++;
+			}
+		}
+	}
+
+	// Count results in test order up to the test which requested exit
+	int numberOfCurTests = MergeTestReports(testSuit, start, count);
+
+	for (workerIndex = 0; workerIndex < numberOfJobs; workerIndex++)
+	{
+		free(workers[workerIndex].failureLog.data);
+	}
+	free(workers);
+	free(pollFds);
+	free(pollWorkers);
+
+	return numberOfCurTests;
+}
+
+/**
+ * @fn void SendTestFailureRecord(TestContextPtr context, const char *record, size_t recordLength)
+ * @brief 작업자 프로세스에서 방금 기록한 실패 정보 기록 하나를 부모 프로세스에게 전달하는 함수
+ * 테스트가 끝나기 전에 작업자 프로세스가 비정상 종료되어도 그때까지의 실패 정보는 부모 프로세스에 남는다.
+ * 실패 정보 기록 버퍼에 레코드를 추가하는 함수에서 호출되기 때문에 전달받은 인자에 대한 검사를 수행하지 않는다.
+ * @param context 현재 테스트의 TestContext 객체(입력)
+ * @param record 실패 정보 기록 하나(입력, 헤더 포함)
+ * @param recordLength 레코드 길이(입력)
+ * @return 반환값 없음
+ */
+void SendTestFailureRecord(TestContextPtr context, const char *record, size_t recordLength)
+{
+	TestMessage message;
+	memset(&message, 0, sizeof(TestMessage));
+	message.type = TestMessageFailure;
+	message.testIndex = context->testIndex;
+	message.failureLogLength = recordLength;
+
+	// The parent process notices a broken socket by itself, so a failed write is not reported here
+	WriteMessage(context->failureFd, &message, record);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int SpawnTestWorker(TestSuitPtr testSuit, TestQueuePtr queue, TestWorkerPtr worker)
+ * @brief 작업자 프로세스를 새로 생성하고 첫 번째 테스트를 나누어 주는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param queue 작업자 프로세스들에게 나누어 줄 테스트 대기열(입력, 출력)
+ * @param worker 생성된 작업자 프로세스 정보를 저장할 구조체(출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int SpawnTestWorker(TestSuitPtr testSuit, TestQueuePtr queue, TestWorkerPtr worker)
+{
+	int fds[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+	{
+		puts("작업자 프로세스 소켓 생성 실패");
+		return -1;
+	}
+
+	// Flush buffered output so that the child does not print it again
+	fflush(stdout);
+	FlushTestSink(testSuit->reporter->sink);
+	FlushTestFailureLog(testSuit);
+
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		puts("작업자 프로세스 생성 실패");
+		close(fds[0]);
+		close(fds[1]);
+		return -1;
+	}
+
+	if (pid == 0)
+	{
+		close(fds[0]);
+		RunTestWorker(testSuit, fds[1]);
+		_exit(0);
+	}
+
+	close(fds[1]);
+	worker->pid = pid;
+	worker->fd = fds[0];
+	worker->testIndex = -1;
+	worker->numberOfRunTests = 0;
+
+	// When the worker process dies before it gets a test, the closed socket reaps it
+	AssignTestToWorker(testSuit, queue, worker);
+
+	return 0;
+}
+
+/**
+ * @fn static void RunTestWorker(TestSuitPtr testSuit, int fd)
+ * @brief 작업자 프로세스에서 부모 프로세스가 나누어 주는 테스트를 종료 요청(-1)을 받을 때까지 실행하는 함수
+ * 테스트 코드가 직접 출력한 내용이 다른 작업자 프로세스의 출력과 섞이지 않도록 테스트가 끝날 때마다 표준 출력을 비운다.
+ * 검사 매크로 함수의 실패 정보는 출력하지 않고 기록할 때마다 TestMessageFailure 메시지로 부모 프로세스에게 전달한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param fd 부모 프로세스와 메시지를 주고받을 소켓 파일 디스크립터(입력)
+ * @return 반환값 없음
+ */
+static void RunTestWorker(TestSuitPtr testSuit, int fd)
+{
+	setvbuf(stdout, NULL, _IOFBF, TEST_WORKER_OUTPUT_BUFFER_SIZE);
+
+	// The parent process enforces test timeouts by killing this worker process
+	TestContext context;
+	InitializeTestContext(&context, testSuit, FALSE);
+	context.useWatchdog = FALSE;
+	context.failureFd = fd;
+
+	int testIndex = -1;
+	while (ReadAll(fd, &testIndex, sizeof(int)) == (ssize_t)sizeof(int) && testIndex >= 0)
+	{
+		TestMessage message;
+		memset(&message, 0, sizeof(TestMessage));
+		RunTest(testSuit, testIndex, &message.report, &context);
+		fflush(stdout);
+
+		// Failure records were already sent as they were recorded
+		message.type = TestMessageEnd;
+		message.testIndex = testIndex;
+		if (WriteMessage(fd, &message, NULL) != 0)
+		{
+			break;
+		}
+	}
+
+	// Each worker process builds its own copy of a shared fixture, so tear down what is left here
+	FinishTestFixtures(testSuit);
+
+	ReleaseTestContext(&context);
+	fflush(stdout);
+	close(fd);
+}
+
+/**
+ * @fn static int AssignTestToWorker(TestSuitPtr testSuit, TestQueuePtr queue, TestWorkerPtr worker)
+ * @brief 대기열에서 다음 테스트를 꺼내 작업자 프로세스에게 전달하는 함수
+ * 남은 테스트가 없거나 포크 서버 모드에서 테스트를 forkServerBatch 개 나누어 준 작업자 프로세스에게는 종료 요청(-1)을 전달한다.
+ * 테스트 번호를 전달하기 전에 기록하므로 작업자 프로세스가 언제 종료되더라도 실행 중이던 테스트를 잘못 판단하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param queue 작업자 프로세스들에게 나누어 줄 테스트 대기열(입력, 출력)
+ * @param worker 테스트를 전달할 작업자 프로세스 정보(입력, 출력)
+ * @return 테스트를 전달했으면 0, 종료 요청을 전달했거나 전달에 실패하면 -1 반환
+ */
+static int AssignTestToWorker(TestSuitPtr testSuit, TestQueuePtr queue, TestWorkerPtr worker)
+{
+	int testIndex = -1;
+	if (HasRemainingTests(queue) == TRUE && (testSuit->options.forkServerBatch <= 0 || worker->numberOfRunTests < testSuit->options.forkServerBatch))
+	{
+		testIndex = testSuit->selectedTests[queue->nextIndex];
+		worker->testIndex = testIndex;
+		worker->position = queue->nextIndex;
+		worker->beginTime = GetMonotonicTime();
+		worker->timeoutNanoseconds = (long long)GetTestTimeout(testSuit, testIndex) * 1000000LL;
+		worker->failureLog.length = 0;
+	}
+
+	if (WriteAll(worker->fd, &testIndex, sizeof(int)) != 0)
+	{
+		// The test stays in the queue for another worker process
+		worker->testIndex = -1;
+		return -1;
+	}
+
+	if (testIndex < 0)
+	{
+		return -1;
+	}
+
+	queue->nextIndex++;
+	worker->numberOfRunTests++;
+
+	return 0;
+}
+
+/**
+ * @fn static void ReapTestWorker(TestSuitPtr testSuit, TestWorkerPtr worker)
+ * @brief 종료된 작업자 프로세스를 회수하고, 테스트 실행 중에 비정상 종료되었으면 해당 테스트를 TestCrash(제한 시간 초과로 종료시켰으면 TestTimeout) 로 기록하는 함수
+ * 비정상 종료 전까지 전달받은 실패 정보는 TestCrash 결과보다 먼저 출력된다.
+ * @param testSuit 전체 테스트 관리 구조체(출력)
+ * @param worker 종료된 작업자 프로세스 정보(입력, 출력)
+ * @return 반환값 없음
+ */
+static void ReapTestWorker(TestSuitPtr testSuit, TestWorkerPtr worker)
+{
+	int status = 0;
+	while (waitpid(worker->pid, &status, 0) < 0 && errno == EINTR)
+	{
+		continue;
+	}
+
+	close(worker->fd);
+
+	if (worker->testIndex >= 0)
+	{
+		TestReportPtr report = &testSuit->testReports[worker->testIndex];
+
+		int timedOut = (worker->timedOutIndex == worker->testIndex) ? TRUE : FALSE;
+		report->result = (timedOut == TRUE) ? TestTimeout : TestCrash;
+		report->exitRequested = FALSE;
+		report->signalNumber = (WIFSIGNALED(status) && timedOut == FALSE) ? WTERMSIG(status) : 0;
+		report->exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : 0;
+		report->elapsedNanoseconds = GetMonotonicTime() - worker->beginTime;
+		report->timeoutMilliseconds = GetTestTimeout(testSuit, worker->testIndex);
+
+		ReplayTestResult(testSuit, worker->testIndex, worker->failureLog.data, worker->failureLog.length, report);
+	}
+
+	worker->pid = -1;
+	worker->fd = -1;
+	worker->testIndex = -1;
+	worker->timedOutIndex = -1;
+	worker->failureLog.length = 0;
+}
+
+/**
+ * @fn static int KillTimedOutWorkers(TestWorkerPtr workers, int numberOfJobs)
+ * @brief 실행 중인 테스트가 제한 시간을 넘긴 작업자 프로세스를 종료시키고, 다음 제한 시간까지 남은 시간을 계산하는 함수
+ * 종료된 작업자 프로세스의 소켓이 닫히면 ReapTestWorker 함수가 해당 테스트를 TestTimeout 으로 기록한다.
+ * @param workers 작업자 프로세스 정보 리스트(입력, 출력)
+ * @param numberOfJobs 작업자 프로세스 개수(입력)
+ * @return 가장 가까운 제한 시간까지 남은 시간(밀리초, poll 함수의 timeout 값), 제한 시간이 있는 테스트가 없으면 -1 반환
+ */
+static int KillTimedOutWorkers(TestWorkerPtr workers, int numberOfJobs)
+{
+	long long now = GetMonotonicTime();
+	long long nearestRemaining = -1;
+
+	int workerIndex = 0;
+	for (; workerIndex < numberOfJobs; workerIndex++)
+	{
+		TestWorkerPtr worker = &workers[workerIndex];
+		if (worker->pid <= 0 || worker->testIndex < 0 || worker->timeoutNanoseconds <= 0 || worker->timedOutIndex >= 0)
+		{
+			continue;
+		}
+
+		long long remaining = worker->beginTime + worker->timeoutNanoseconds - now;
+		if (remaining <= 0)
+		{
+			kill(worker->pid, SIGKILL);
+			worker->timedOutIndex = worker->testIndex;
+			continue;
+		}
+		if (nearestRemaining < 0 || remaining < nearestRemaining)
+		{
+			nearestRemaining = remaining;
+		}
+	}
+
+	if (nearestRemaining < 0)
+	{
+		return -1;
+	}
+
+	// Round up so that poll does not wake up just before the deadline
+	long long milliseconds = (nearestRemaining + 999999LL) / 1000000LL;
+
+	return (milliseconds > 0x7fffffffLL) ? 0x7fffffff : (int)milliseconds;
+}
+
+/**
+ * @fn static int HasRemainingTests(TestQueuePtr queue)
+ * @brief 대기열에 아직 실행되지 않은 테스트가 남아 있는지 확인하는 함수
+ * @param queue 작업자 프로세스들에게 나누어 줄 테스트 대기열(입력)
+ * @return 남아 있으면 TRUE, 없으면 FALSE 반환
+ */
+static int HasRemainingTests(TestQueuePtr queue)
+{
+	// Tests after the one which requested exit are not run in serial mode either
+	return (queue->nextIndex < queue->endIndex && queue->nextIndex <= queue->exitIndex) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static void RequestExitAt(TestQueuePtr queue, int position)
+ * @brief ASSERT 실패로 종료를 요청한 테스트의 실행 순서를 대기열에 기록하는 함수(가장 앞선 순서만 유지)
+ * @param queue 작업자 프로세스들에게 나누어 줄 테스트 대기열(출력)
+ * @param position 종료를 요청한 테스트의 실행 순서(입력)
+ * @return 반환값 없음
+ */
+static void RequestExitAt(TestQueuePtr queue, int position)
+{
+	if (position < queue->exitIndex)
+	{
+		queue->exitIndex = position;
+	}
+}
+
+/**
+ * @fn static int WriteMessage(int fd, const TestMessage *message, const char *failureLog)
+ * @brief 부모 프로세스에게 메시지 하나(헤더와 실패 정보 기록)를 전달하는 함수
+ * @param fd 메시지를 기록할 소켓 파일 디스크립터(입력)
+ * @param message 전달할 메시지 헤더(입력)
+ * @param failureLog 헤더 뒤에 전달할 실패 정보 기록(입력, failureLogLength 가 0 이면 NULL 가능)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int WriteMessage(int fd, const TestMessage *message, const char *failureLog)
+{
+	if (WriteAll(fd, message, sizeof(TestMessage)) != 0)
+	{
+		return -1;
+	}
+
+	return WriteAll(fd, failureLog, message->failureLogLength);
+}
+
+/**
+ * @fn static int ReadMessage(int fd, TestMessagePtr message, TestMessageBufferPtr failureLog)
+ * @brief 작업자 프로세스가 전달한 메시지 하나를 읽고, 뒤에 이어지는 실패 정보 기록은 버퍼 끝에 덧붙이는 함수
+ * @param fd 메시지를 읽을 소켓 파일 디스크립터(입력)
+ * @param message 읽은 메시지 헤더를 저장할 구조체(출력)
+ * @param failureLog 현재 테스트의 실패 정보 기록 버퍼(입력, 출력, 필요하면 크기를 늘린다)
+ * @return 성공 시 0, 소켓이 닫혔거나 실패 시 -1 반환
+ */
+static int ReadMessage(int fd, TestMessagePtr message, TestMessageBufferPtr failureLog)
+{
+	if (ReadAll(fd, message, sizeof(TestMessage)) != (ssize_t)sizeof(TestMessage))
+	{
+		return -1;
+	}
+
+	size_t length = failureLog->length + message->failureLogLength;
+	if (length > failureLog->capacity)
+	{
+		size_t capacity = (failureLog->capacity == 0) ? 1024 : failureLog->capacity;
+		while (capacity < length)
+		{
+			capacity *= 2;
+		}
+
+		char *data = (char*)realloc(failureLog->data, capacity);
+		if (data == NULL)
+		{
+			return -1;
+		}
+		failureLog->data = data;
+		failureLog->capacity = capacity;
+	}
+
+	if (ReadAll(fd, failureLog->data + failureLog->length, message->failureLogLength) != (ssize_t)message->failureLogLength)
+	{
+		return -1;
+	}
+	failureLog->length = length;
+
+	return 0;
+}
+
+/**
+ * @fn static int WriteAll(int fd, const void *data, size_t length)
+ * @brief 데이터 전체를 소켓에 기록하는 함수(부분 기록과 EINTR 을 처리한다)
+ * 상대 프로세스가 이미 종료되었으면 SIGPIPE 를 받지 않고 실패로 반환한다.
+ * @param fd 파일 디스크립터(입력)
+ * @param data 기록할 데이터(입력)
+ * @param length 기록할 데이터 길이(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int WriteAll(int fd, const void *data, size_t length)
+{
+	const char *position = (const char*)data;
+	while (length > 0)
+	{
+		ssize_t written = send(fd, position, length, MSG_NOSIGNAL);
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		position += written;
+		length -= (size_t)written;
+	}
+
+	return 0;
+}
+
+/**
+ * @fn static ssize_t ReadAll(int fd, void *data, size_t length)
+ * @brief 지정한 길이만큼 소켓에서 읽는 함수(소켓이 닫히면 그때까지 읽은 만큼 반환한다)
+ * @param fd 파일 디스크립터(입력)
+ * @param data 읽은 데이터를 저장할 버퍼(출력)
+ * @param length 읽을 데이터 길이(입력)
+ * @return 읽은 바이트 수 반환(실패 시 -1)
+ */
+static ssize_t ReadAll(int fd, void *data, size_t length)
+{
+	size_t total = 0;
+	while (total < length)
+	{
+		ssize_t numberOfBytes = read(fd, (char*)data + total, length - total);
+		if (numberOfBytes < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		if (numberOfBytes == 0)
+		{
+			break;
+		}
+		total += (size_t)numberOfBytes;
+	}
+
+	return (ssize_t)total;
+}
+
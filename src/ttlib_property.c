@@ -0,0 +1,1405 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdarg.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 조건(PROPERTY_ASSUME)을 만족하지 않아 버릴 수 있는 입력 개수의 배수(입력 개수 기준)
+#define TEST_PROPERTY_DISCARD_RATIO 10
+
+// 실패하는 입력을 줄이기 위해 속성을 다시 실행하는 최대 횟수
+#define TEST_PROPERTY_MAX_SHRINK_RUNS 5000
+
+// 검사 스레드가 한 번에 가져가는 입력 번호의 최대 개수(공유 카운터 갱신을 줄인다)
+#define TEST_PROPERTY_MAX_BATCH 256
+
+// 입력 하나가 사용할 수 있는 최대 선택값 개수
+#define TEST_PROPERTY_MAX_CHOICES (1 << 20)
+
+// 반례 설명의 최대 길이
+#define TEST_PROPERTY_DESCRIPTION_SIZE 4096
+
+// 문자열 길이를 정할 때 최소 길이를 넘는 평균 길이의 최댓값
+#define TEST_PROPERTY_AVERAGE_LENGTH 32
+
+// GEN_STRING 의 기본 문자 집합(앞쪽 문자로 줄어든다)
+#define TEST_PROPERTY_ALPHABET "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~\t\n"
+
+// GEN_DELIMITER 의 기본 구분 문자 집합
+#define TEST_PROPERTY_DELIMITERS ",;|:/ \t\n"
+
+// 입력 하나의 검사 결과
+typedef enum _TestPropertyCaseResult_t
+{
+	// 속성이 성립함
+	TestPropertyCasePass = 0,
+	// 속성이 성립하지 않음(반례)
+	TestPropertyCaseFail,
+	// 조건을 만족하지 않아 버림
+	TestPropertyCaseDiscard
+} TestPropertyCaseResult;
+
+// 입력 하나를 만드는 상태
+// 모든 입력 값은 선택값(0 이상 상한 이하의 정수)을 차례대로 꺼내 만들어지며, 선택값이 작을수록 단순한 값이 되도록 매핑한다.
+// 실패한 입력의 선택값 리스트를 지우거나 작게 바꿔 다시 실행하는 것만으로 모든 GEN_ 함수의 입력을 함께 줄일 수 있다.
+typedef struct _test_property_source_t
+{
+	// 다시 사용할 선택값 리스트(NULL 이면 난수로 새 입력을 만든다, 리스트가 끝나면 0 을 사용한다)
+	const unsigned long long *replayChoices;
+	// 다시 사용할 선택값 개수
+	int numberOfReplayChoices;
+	// 이번 입력을 만드는 데 사용한 선택값 리스트
+	unsigned long long *choices;
+	// 사용한 선택값 개수
+	int numberOfChoices;
+	// 선택값 리스트의 크기
+	int choiceCapacity;
+	// 난수 상태(xorshift64*)
+	unsigned long long randomState;
+	// 이번 입력에서 만든 값 리스트(입력 하나를 실행한 뒤 해제한다)
+	void **values;
+	// 만든 값 개수
+	int numberOfValues;
+	// 값 리스트의 크기
+	int valueCapacity;
+	// 값을 만드는 동안 사용하는 임시 버퍼
+	char *scratch;
+	// 임시 버퍼의 크기
+	size_t scratchCapacity;
+	// 만든 값의 설명(반례를 출력할 때만 기록, NULL 이면 기록하지 않음)
+	char *description;
+	// 설명의 길이
+	size_t descriptionLength;
+	// 설명을 시작한 값 개수
+	int numberOfDescribedValues;
+	// PROPERTY_ASSUME 으로 입력을 버렸는지 여부
+	int discarded;
+} TestPropertySource, *TestPropertySourcePtr;
+
+// 속성 기반 테스트 하나의 실행 상태(병렬 검사 시 스레드들이 공유한다)
+typedef struct _test_property_run_t
+{
+	// 검사할 속성
+	TestPropertyFunc property;
+	// 속성 기반 테스트를 실행하는 TestSuit 객체
+	TestSuitPtr testSuit;
+	// 테스트 번호
+	int testIndex;
+	// 테스트의 입력 seed(실행 옵션의 seed 와 테스트 이름으로 정한다)
+	unsigned long long seed;
+	// 검사할 입력 개수
+	int numberOfCases;
+	// 만들어 볼 최대 입력 개수(버린 입력 포함)
+	int maxAttempts;
+	// 검사 스레드가 한 번에 가져가는 입력 번호 개수
+	int batchSize;
+	// 다음에 만들 입력 번호
+	int nextAttempt;
+	// 속성이 성립한 입력 개수
+	int passedCases;
+	// 버린 입력 개수
+	int discardedCases;
+	// 실패한 입력 중 가장 작은 번호(없으면 INT_MAX)
+	int failedAttempt;
+	// 테스트를 실행하는 스레드의 제한 시간 감시 타이머(제한 시간이 지나면 병렬 검사를 멈춘다)
+	TestWatchdogPtr watchdog;
+	// 검사를 멈출지 여부(제한 시간이 지나 테스트를 중단할 때 TRUE)
+	int stopped;
+	// 실행 상태를 사용하는 스레드 개수(병렬 검사 시 마지막 스레드가 해제한다)
+	int references;
+} TestPropertyRun, *TestPropertyRunPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void RunPropertyCases(TestContextPtr context, TestPropertyFunc property, const char *macroName, const char *fileName, int lineNumber, int numberOfCases, int numberOfThreads);
+static void EvaluatePropertyCases(TestPropertyRunPtr run);
+static void *RunPropertyWorker(void *argument);
+static void ReleasePropertyRun(TestPropertyRunPtr run);
+static void EvaluatePropertyInThreads(TestPropertyRunPtr run, int numberOfThreads);
+static TestPropertyCaseResult EvaluatePropertyCase(TestPropertyRunPtr run, TestPropertySourcePtr source, const unsigned long long *replayChoices, int numberOfReplayChoices, unsigned long long caseSeed, int report);
+static int ShrinkPropertyCase(TestPropertyRunPtr run, TestPropertySourcePtr source, unsigned long long **bestContainer, int *numberOfBestChoices);
+static int TryPropertyCandidate(TestPropertyRunPtr run, TestPropertySourcePtr source, const unsigned long long *candidate, int numberOfCandidateChoices, unsigned long long **bestContainer, int *numberOfBestChoices);
+static int IsSmallerChoices(const unsigned long long *left, int numberOfLeftChoices, const unsigned long long *right, int numberOfRightChoices);
+static void ResetPropertySource(TestPropertySourcePtr source, const unsigned long long *replayChoices, int numberOfReplayChoices, unsigned long long caseSeed);
+static void ReleasePropertyValues(TestPropertySourcePtr source);
+static void DeletePropertySource(TestPropertySourcePtr source);
+static TestPropertySourcePtr GetPropertySource(void);
+static unsigned long long DrawPropertyChoice(TestPropertySourcePtr source, unsigned long long bound);
+static int DrawPropertyBoolean(TestPropertySourcePtr source, double probability);
+static void RecordPropertyChoice(TestPropertySourcePtr source, unsigned long long choice);
+static unsigned long long NextPropertyRandom(TestPropertySourcePtr source);
+static unsigned long long MixPropertySeed(unsigned long long value);
+static double GetContinueProbability(int minLength, int maxLength);
+static void *AllocatePropertyValue(TestPropertySourcePtr source, size_t size);
+static char *GenerateText(TestPropertySourcePtr source, int minLength, int maxLength, const char *alphabet, int *length);
+static void BeginPropertyValue(TestPropertySourcePtr source);
+static void DescribePropertyValue(TestPropertySourcePtr source, const char *format, ...) __attribute__((format(printf, 2, 3)));
+static void DescribePropertyText(TestPropertySourcePtr source, const char *text, size_t length, char quote);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn void RunProperty(TestPropertyFunc property, const char *fileName, int lineNumber)
+ * @brief 속성 기반 테스트를 실행하는 함수(PROPERTY 매크로 함수에서 호출)
+ * 실행 옵션의 입력 개수만큼 입력을 만들어 속성을 검사하고, 실패한 입력이 있으면 같은 속성이 실패하는 가장 작은 입력으로 줄인다.
+ * 입력 번호마다 seed 가 정해져 있으므로 검사 스레드 개수와 관계없이 같은 seed 는 같은 반례를 찾는다.
+ * 입력을 찾고 줄이는 동안의 실패는 리포터에 전달하지 않고, 마지막으로 줄인 입력을 다시 실행하여 그 실패와 입력 값을 전달한다.
+ * @param property 입력 하나를 만들고 속성을 검사하는 함수(입력)
+ * @param fileName PROPERTY 를 정의한 소스 파일 이름(입력)
+ * @param lineNumber PROPERTY 를 정의한 소스 줄 번호(입력)
+ * @return 반환값 없음
+ */
+void RunProperty(TestPropertyFunc property, const char *fileName, int lineNumber)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || property == NULL)
+	{
+		return;
+	}
+
+	TestOptionsPtr options = &context->testSuit->options;
+	RunPropertyCases(context, property, "PROPERTY", fileName, lineNumber, options->propertyCases, options->propertyThreads);
+}
+
+/**
+ * @fn void RunDifferential(TestPropertyFunc property, const char *fileName, int lineNumber)
+ * @brief 차분 테스트를 실행하는 함수(DIFFERENTIAL 매크로 함수에서 호출)
+ * 속성 기반 테스트와 같은 방식으로 입력을 만들고 줄이지만, 차분 테스트의 입력 개수와 스레드 개수(기본값은 CPU 개수)를 사용한다.
+ * @param property 입력 하나를 만들고 구현과 기준 구현의 결과를 비교하는 함수(입력)
+ * @param fileName DIFFERENTIAL 을 정의한 소스 파일 이름(입력)
+ * @param lineNumber DIFFERENTIAL 을 정의한 소스 줄 번호(입력)
+ * @return 반환값 없음
+ */
+void RunDifferential(TestPropertyFunc property, const char *fileName, int lineNumber)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || property == NULL)
+	{
+		return;
+	}
+
+	TestOptionsPtr options = &context->testSuit->options;
+	RunPropertyCases(context, property, "DIFFERENTIAL", fileName, lineNumber, options->differentialCases, options->differentialThreads);
+}
+
+/**
+ * @fn void DiscardTestProperty(void)
+ * @brief 현재 입력을 버리는 함수(PROPERTY_ASSUME 매크로 함수에서 호출)
+ * @return 반환값 없음
+ */
+void DiscardTestProperty(void)
+{
+	TestPropertySourcePtr source = GetPropertySource();
+	if (source != NULL)
+	{
+		source->discarded = TRUE;
+	}
+}
+
+/**
+ * @fn long long GenerateTestInt(long long min, long long max)
+ * @brief min 이상 max 이하의 정수를 만드는 함수(GEN_INT 매크로 함수에서 호출)
+ * 범위 안에서 0 에 가장 가까운 값을 기준으로 양쪽으로 번갈아 멀어지는 순서로 선택값을 매핑하므로 0(또는 가까운 경계)으로 줄어든다.
+ * @param min 최솟값(입력)
+ * @param max 최댓값(입력, min 보다 작으면 min 으로 본다)
+ * @return 만든 정수 반환(속성 기반 테스트 밖에서 호출하면 min 반환)
+ */
+long long GenerateTestInt(long long min, long long max)
+{
+	TestPropertySourcePtr source = GetPropertySource();
+	if (max < min)
+	{
+		max = min;
+	}
+	if (source == NULL)
+	{
+		return min;
+	}
+
+	unsigned long long span = (unsigned long long)max - (unsigned long long)min;
+	unsigned long long choice = DrawPropertyChoice(source, span);
+
+	long long value = 0;
+	if (min >= 0)
+	{
+		value = (long long)((unsigned long long)min + choice);
+	}
+	else if (max <= 0)
+	{
+		value = (long long)((unsigned long long)max - choice);
+	}
+	else if (choice == 0)
+	{
+		value = 0;
+	}
+	else
+	{
+		// 1, -1, 2, -2, ... while both sides have room, then the rest of the range in order
+		unsigned long long distance = choice / 2 + (choice & 1);
+		if ((choice & 1) == 1 && distance <= (unsigned long long)max)
+		{
+			value = (long long)distance;
+		}
+		else if ((choice & 1) == 0 && distance <= (unsigned long long)0 - (unsigned long long)min)
+		{
+			value = (long long)((unsigned long long)0 - distance);
+		}
+		else
+		{
+			value = (long long)((unsigned long long)min + choice);
+		}
+	}
+
+	BeginPropertyValue(source);
+	DescribePropertyValue(source, "%lld", value);
+
+	return value;
+}
+
+/**
+ * @fn char *GenerateTestString(int minLength, int maxLength, const char *alphabet)
+ * @brief alphabet 의 문자로 길이가 minLength 이상 maxLength 이하인 문자열을 만드는 함수(GEN_STRING 매크로 함수에서 호출)
+ * 짧은 문자열과 alphabet 의 앞쪽 문자로 줄어든다.
+ * @param minLength 최소 길이(입력)
+ * @param maxLength 최대 길이(입력)
+ * @param alphabet 사용할 문자 집합(입력, NULL 이나 빈 문자열이면 출력 가능한 ASCII 문자와 \t, \n)
+ * @return 만든 문자열 반환(입력 하나를 실행한 뒤 해제된다, 속성 기반 테스트 밖에서 호출하면 NULL 반환)
+ */
+char *GenerateTestString(int minLength, int maxLength, const char *alphabet)
+{
+	TestPropertySourcePtr source = GetPropertySource();
+	if (source == NULL)
+	{
+		return NULL;
+	}
+
+	int length = 0;
+	char *text = GenerateText(source, minLength, maxLength, alphabet, &length);
+	if (text != NULL)
+	{
+		BeginPropertyValue(source);
+		DescribePropertyText(source, text, (size_t)length, '"');
+	}
+
+	return text;
+}
+
+/**
+ * @fn TestBytes GenerateTestBytes(int minLength, int maxLength)
+ * @brief 길이가 minLength 이상 maxLength 이하인 바이트 배열을 만드는 함수(GEN_BYTES 매크로 함수에서 호출)
+ * @param minLength 최소 길이(입력)
+ * @param maxLength 최대 길이(입력)
+ * @return 만든 바이트 배열 반환(입력 하나를 실행한 뒤 해제된다, 속성 기반 테스트 밖에서 호출하면 길이 0 의 NULL 배열 반환)
+ */
+TestBytes GenerateTestBytes(int minLength, int maxLength)
+{
+	TestBytes bytes = { NULL, 0 };
+	TestPropertySourcePtr source = GetPropertySource();
+	if (source == NULL)
+	{
+		return bytes;
+	}
+
+	// Every byte value is allowed, with 0x00 as the simplest one
+	char alphabet[257];
+	int byteValue = 1;
+	for (; byteValue < 256; byteValue++)
+	{
+		alphabet[byteValue - 1] = (char)byteValue;
+	}
+	alphabet[255] = '\0';
+
+	int length = 0;
+	char *data = GenerateText(source, minLength, maxLength, alphabet, &length);
+	if (data == NULL)
+	{
+		return bytes;
+	}
+
+	// Shift the choices by one so that the simplest byte is 0x00
+	int byteIndex = 0;
+	for (; byteIndex < length; byteIndex++)
+	{
+		data[byteIndex] = (char)((unsigned char)data[byteIndex] - 1);
+	}
+	bytes.data = (unsigned char*)data;
+	bytes.length = (size_t)length;
+
+	BeginPropertyValue(source);
+	DescribePropertyValue(source, "[");
+	for (byteIndex = 0; byteIndex < length; byteIndex++)
+	{
+		DescribePropertyValue(source, (byteIndex == 0) ? "%02x" : " %02x", bytes.data[byteIndex]);
+	}
+	DescribePropertyValue(source, "]");
+
+	return bytes;
+}
+
+/**
+ * @fn TestStrings GenerateTestStrings(int minCount, int maxCount, int maxLength, const char *alphabet)
+ * @brief 길이가 0 이상 maxLength 이하인 문자열을 minCount 개 이상 maxCount 개 이하로 가진 문자열 배열을 만드는 함수(GEN_STRINGS 매크로 함수에서 호출)
+ * @param minCount 최소 문자열 개수(입력)
+ * @param maxCount 최대 문자열 개수(입력)
+ * @param maxLength 문자열 하나의 최대 길이(입력)
+ * @param alphabet 사용할 문자 집합(입력, NULL 이면 GEN_STRING 과 같은 기본 문자 집합)
+ * @return 만든 문자열 배열 반환(입력 하나를 실행한 뒤 해제된다, 속성 기반 테스트 밖에서 호출하면 개수 0 의 NULL 배열 반환)
+ */
+TestStrings GenerateTestStrings(int minCount, int maxCount, int maxLength, const char *alphabet)
+{
+	TestStrings strings = { NULL, 0 };
+	TestPropertySourcePtr source = GetPropertySource();
+	if (source == NULL)
+	{
+		return strings;
+	}
+
+	if (minCount < 0)
+	{
+		minCount = 0;
+	}
+	if (maxCount < minCount)
+	{
+		maxCount = minCount;
+	}
+
+	// The strings are the values created after this point, one value each
+	int firstValue = source->numberOfValues;
+	double continueProbability = GetContinueProbability(minCount, maxCount);
+	int count = 0;
+	for (; count < maxCount; count++)
+	{
+		if (count >= minCount && DrawPropertyBoolean(source, continueProbability) == FALSE)
+		{
+			break;
+		}
+
+		int length = 0;
+		if (GenerateText(source, 0, maxLength, alphabet, &length) == NULL)
+		{
+			return strings;
+		}
+	}
+
+	char **list = (char**)AllocatePropertyValue(source, ((size_t)count + 1) * sizeof(char*));
+	if (list == NULL)
+	{
+		return strings;
+	}
+
+	int stringIndex = 0;
+	BeginPropertyValue(source);
+	DescribePropertyValue(source, "[");
+	for (; stringIndex < count; stringIndex++)
+	{
+		list[stringIndex] = (char*)source->values[firstValue + stringIndex];
+		if (stringIndex > 0)
+		{
+			DescribePropertyValue(source, ", ");
+		}
+		DescribePropertyText(source, list[stringIndex], strlen(list[stringIndex]), '"');
+	}
+	list[count] = NULL;
+	DescribePropertyValue(source, "]");
+
+	strings.strings = list;
+	strings.count = count;
+
+	return strings;
+}
+
+/**
+ * @fn char GenerateTestDelimiter(const char *delimiters)
+ * @brief delimiters 의 문자 중 하나를 고르는 함수(GEN_DELIMITER 매크로 함수에서 호출, 첫 번째 문자로 줄어든다)
+ * @param delimiters 구분 문자 집합(입력, NULL 이나 빈 문자열이면 ",;|:/ \t\n")
+ * @return 고른 문자 반환(속성 기반 테스트 밖에서 호출하면 첫 번째 문자 반환)
+ */
+char GenerateTestDelimiter(const char *delimiters)
+{
+	if (delimiters == NULL || *delimiters == '\0')
+	{
+		delimiters = TEST_PROPERTY_DELIMITERS;
+	}
+
+	TestPropertySourcePtr source = GetPropertySource();
+	if (source == NULL)
+	{
+		return delimiters[0];
+	}
+
+	char delimiter = delimiters[DrawPropertyChoice(source, strlen(delimiters) - 1)];
+	BeginPropertyValue(source);
+	DescribePropertyText(source, &delimiter, 1, '\'');
+
+	return delimiter;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void RunPropertyCases(TestContextPtr context, TestPropertyFunc property, const char *macroName, const char *fileName, int lineNumber, int numberOfCases, int numberOfThreads)
+ * @brief 입력을 만들어 속성을 검사하고, 가장 먼저 실패한 입력을 줄여 그 실패와 입력 값을 전달하는 함수
+ * 검사 스레드는 입력 번호를 묶음 단위로 가져가고 성공, 버림 개수를 묶음이 끝날 때 한 번에 더하므로 입력이 많아도 공유 카운터를 거의 갱신하지 않는다.
+ * RunProperty, RunDifferential 함수에서 호출되기 때문에 전달받은 매개변수에 대한 예외 검사를 수행하지 않는다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param property 입력 하나를 만들고 속성을 검사하는 함수(입력)
+ * @param macroName 실패 정보에 기록할 매크로 함수 이름(입력)
+ * @param fileName 실패 정보에 기록할 소스 파일 이름(입력)
+ * @param lineNumber 실패 정보에 기록할 소스 줄 번호(입력)
+ * @param numberOfCases 검사할 입력 개수(입력)
+ * @param numberOfThreads 검사 스레드 개수(입력, 1 이하면 현재 스레드에서 검사)
+ * @return 반환값 없음
+ */
+static void RunPropertyCases(TestContextPtr context, TestPropertyFunc property, const char *macroName, const char *fileName, int lineNumber, int numberOfCases, int numberOfThreads)
+{
+	TestSuitPtr testSuit = context->testSuit;
+	TestPtr test = testSuit->testPtrContainer[context->testIndex];
+
+	// Each test gets its own seed from the run seed and its name, so that a filtered run reproduces it
+	unsigned long long nameHash = 14695981039346656037ULL;
+	const char *names[2] = { test->testCase, test->testName };
+	int nameIndex = 0;
+	for (; nameIndex < 2; nameIndex++)
+	{
+		const unsigned char *name = (const unsigned char*)names[nameIndex];
+		for (; *name != '\0'; name++)
+		{
+			nameHash = (nameHash ^ *name) * 1099511628211ULL;
+		}
+		nameHash = (nameHash ^ '.') * 1099511628211ULL;
+	}
+
+	TestPropertyRun run;
+	memset(&run, 0, sizeof(run));
+	run.property = property;
+	run.testSuit = testSuit;
+	run.testIndex = context->testIndex;
+	run.seed = MixPropertySeed(testSuit->options.propertySeed ^ nameHash);
+	run.numberOfCases = numberOfCases;
+	run.maxAttempts = (run.numberOfCases > INT_MAX / TEST_PROPERTY_DISCARD_RATIO) ? INT_MAX : run.numberOfCases * TEST_PROPERTY_DISCARD_RATIO;
+	run.batchSize = numberOfCases / (((numberOfThreads > 1) ? numberOfThreads : 1) * 16);
+	run.batchSize = (run.batchSize < 1) ? 1 : (run.batchSize > TEST_PROPERTY_MAX_BATCH) ? TEST_PROPERTY_MAX_BATCH : run.batchSize;
+	run.failedAttempt = INT_MAX;
+	run.watchdog = context->watchdog;
+
+	if (numberOfThreads > 1)
+	{
+		EvaluatePropertyInThreads(&run, numberOfThreads);
+	}
+	else
+	{
+		EvaluatePropertyCases(&run);
+	}
+
+	if (run.failedAttempt == INT_MAX)
+	{
+		if (run.passedCases == 0)
+		{
+			ReportTestFailure("PROPERTY_ASSUME", fileName, lineNumber, "조건을 만족하는 입력 없음 (discarded:%d, seed:%llu)", run.discardedCases, testSuit->options.propertySeed);
+			context->failCount++;
+		}
+		return;
+	}
+
+	// Generate the failing input again in this thread to get its choices, then shrink them
+	TestPropertySource source;
+	memset(&source, 0, sizeof(source));
+	unsigned long long caseSeed = MixPropertySeed(run.seed + (unsigned long long)run.failedAttempt * 0x9E3779B97F4A7C15ULL);
+
+	unsigned long long *best = NULL;
+	int numberOfBestChoices = 0;
+	int numberOfShrinks = 0;
+	if (EvaluatePropertyCase(&run, &source, NULL, 0, caseSeed, FALSE) == TestPropertyCaseFail)
+	{
+		PauseTestAllocations();
+		best = (unsigned long long*)malloc(((size_t)source.numberOfChoices + 1) * sizeof(unsigned long long));
+		ResumeTestAllocations();
+		if (best != NULL)
+		{
+			memcpy(best, source.choices, (size_t)source.numberOfChoices * sizeof(unsigned long long));
+			numberOfBestChoices = source.numberOfChoices;
+			numberOfShrinks = ShrinkPropertyCase(&run, &source, &best, &numberOfBestChoices);
+		}
+	}
+
+	// Replay the smallest failing input with the failures reported and the values described
+	TestPropertyCaseResult result = TestPropertyCaseDiscard;
+	if (best != NULL)
+	{
+		result = EvaluatePropertyCase(&run, &source, best, numberOfBestChoices, caseSeed, TRUE);
+	}
+
+	if (result == TestPropertyCaseFail)
+	{
+		ReportTestFailure(macroName, fileName, lineNumber, "반례 (입력:%d 번째, 축소:%d 회, 재현: --property-seed=%llu): %s",
+			run.failedAttempt + 1, numberOfShrinks, testSuit->options.propertySeed, (source.description != NULL) ? source.description : "");
+	}
+	else
+	{
+		ReportTestFailure(macroName, fileName, lineNumber, "%d 번째 입력이 실패했지만 다시 실행하면 실패하지 않음 (재현: --property-seed=%llu)",
+			run.failedAttempt + 1, testSuit->options.propertySeed);
+	}
+	// The reported replay never restores failCount, so the property failure is counted on top of the failures it added
+	context->failCount++;
+
+	PauseTestAllocations();
+	free(best);
+	DeletePropertySource(&source);
+	ResumeTestAllocations();
+}
+
+/**
+ * @fn static void EvaluatePropertyCases(TestPropertyRunPtr run)
+ * @brief 공유된 입력 번호를 묶음 단위로 가져가며 속성을 검사하는 함수(순차 검사와 검사 스레드에서 사용)
+ * 입력 번호를 차례대로 가져가고 가져간 묶음은 끝까지 검사하므로, 실패한 입력보다 작은 번호의 입력은 모두 검사된 뒤에 끝난다.
+ * @param run 속성 기반 테스트의 실행 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void EvaluatePropertyCases(TestPropertyRunPtr run)
+{
+	TestPropertySource source;
+	memset(&source, 0, sizeof(source));
+
+	int attempt = 0;
+	int batchEnd = 0;
+	int passedCases = 0;
+	int discardedCases = 0;
+	while (TRUE)
+	{
+		// Claim the next batch of attempts once the counts of the last one are published
+		if (attempt == batchEnd)
+		{
+			__atomic_fetch_add(&run->passedCases, passedCases, __ATOMIC_RELAXED);
+			__atomic_fetch_add(&run->discardedCases, discardedCases, __ATOMIC_RELAXED);
+			passedCases = 0;
+			discardedCases = 0;
+			if (__atomic_load_n(&run->passedCases, __ATOMIC_RELAXED) >= run->numberOfCases)
+			{
+				break;
+			}
+			attempt = __atomic_fetch_add(&run->nextAttempt, run->batchSize, __ATOMIC_RELAXED);
+			batchEnd = attempt + run->batchSize;
+		}
+
+		// Stop when the test gave up on the cases at a timeout
+		if (__atomic_load_n(&run->stopped, __ATOMIC_RELAXED) == TRUE)
+		{
+			break;
+		}
+
+		if (attempt >= run->maxAttempts || attempt > __atomic_load_n(&run->failedAttempt, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+
+		unsigned long long caseSeed = MixPropertySeed(run->seed + (unsigned long long)attempt * 0x9E3779B97F4A7C15ULL);
+		TestPropertyCaseResult result = EvaluatePropertyCase(run, &source, NULL, 0, caseSeed, FALSE);
+		if (result == TestPropertyCaseFail)
+		{
+			int failedAttempt = __atomic_load_n(&run->failedAttempt, __ATOMIC_RELAXED);
+			while (attempt < failedAttempt && __atomic_compare_exchange_n(&run->failedAttempt, &failedAttempt, attempt, FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == FALSE)
+			{
+			}
+			break;
+		}
+		else if (result == TestPropertyCasePass)
+		{
+			passedCases++;
+		}
+		else
+		{
+			discardedCases++;
+		}
+		attempt++;
+	}
+	__atomic_fetch_add(&run->passedCases, passedCases, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&run->discardedCases, discardedCases, __ATOMIC_RELAXED);
+
+	PauseTestAllocations();
+	DeletePropertySource(&source);
+	ResumeTestAllocations();
+}
+
+/**
+ * @fn static void *RunPropertyWorker(void *argument)
+ * @brief 검사 스레드 함수(실패 정보를 전달하지 않는 별도의 TestContext 객체로 입력을 검사한다)
+ * @param argument 속성 기반 테스트의 실행 상태(입력, 출력)
+ * @return NULL 반환
+ */
+static void *RunPropertyWorker(void *argument)
+{
+	TestPropertyRunPtr run = (TestPropertyRunPtr)argument;
+
+	TestContext context;
+	InitializeTestContext(&context, run->testSuit, FALSE);
+	context.testIndex = run->testIndex;
+	context.useWatchdog = FALSE;
+	context.muteFailures = TRUE;
+	_testContext = &context;
+
+	EvaluatePropertyCases(run);
+
+	_testContext = NULL;
+	ReleaseTestContext(&context);
+	ReleasePropertyRun(run);
+
+	return NULL;
+}
+
+/**
+ * @fn static void ReleasePropertyRun(TestPropertyRunPtr run)
+ * @brief 병렬 검사의 실행 상태 사용을 끝내는 함수(마지막으로 사용을 끝낸 스레드가 해제한다)
+ * @param run 힙에 복사된 실행 상태(입력)
+ * @return 반환값 없음
+ */
+static void ReleasePropertyRun(TestPropertyRunPtr run)
+{
+	if (__atomic_sub_fetch(&run->references, 1, __ATOMIC_ACQ_REL) == 0)
+	{
+		free(run);
+	}
+}
+
+/**
+ * @fn static void EvaluatePropertyInThreads(TestPropertyRunPtr run, int numberOfThreads)
+ * @brief 검사 스레드들이 입력을 나눠 검사하고 현재 스레드는 끝나기를 기다리는 함수
+ * 검사 스레드가 속성을 실행하는 동안 테스트가 중단되지 않도록 제한 시간 중단을 미루고 주기적으로 제한 시간을 확인한다.
+ * 제한 시간이 지나면 검사를 멈추고, 속성에서 끝나지 않는 검사 스레드는 분리해 둔 채 테스트를 중단한다
+ * (실행 상태는 힙에 복사하여 마지막 스레드가 해제하므로 분리된 스레드가 해제된 메모리를 사용하지 않는다).
+ * @param run 속성 기반 테스트의 실행 상태(입력, 출력)
+ * @param numberOfThreads 검사 스레드 개수(입력)
+ * @return 반환값 없음
+ */
+static void EvaluatePropertyInThreads(TestPropertyRunPtr run, int numberOfThreads)
+{
+	HoldTestWatchdog();
+
+	PauseTestAllocations();
+	TestPropertyRunPtr sharedRun = (TestPropertyRunPtr)malloc(sizeof(TestPropertyRun) + (size_t)numberOfThreads * sizeof(pthread_t));
+	int numberOfStartedThreads = 0;
+	if (sharedRun != NULL)
+	{
+		*sharedRun = *run;
+		sharedRun->references = 1;
+
+		pthread_t *threads = (pthread_t*)(sharedRun + 1);
+		for (; numberOfStartedThreads < numberOfThreads; numberOfStartedThreads++)
+		{
+			__atomic_add_fetch(&sharedRun->references, 1, __ATOMIC_RELAXED);
+			if (pthread_create(&threads[numberOfStartedThreads], NULL, RunPropertyWorker, sharedRun) != 0)
+			{
+				__atomic_sub_fetch(&sharedRun->references, 1, __ATOMIC_RELAXED);
+				break;
+			}
+		}
+	}
+	ResumeTestAllocations();
+
+	// Check the cases here when no worker thread could be started
+	if (numberOfStartedThreads == 0)
+	{
+		ReleaseTestWatchdog();
+		if (sharedRun != NULL)
+		{
+			PauseTestAllocations();
+			free(sharedRun);
+			ResumeTestAllocations();
+		}
+		EvaluatePropertyCases(run);
+		return;
+	}
+
+	pthread_t *threads = (pthread_t*)(sharedRun + 1);
+	int threadIndex = 0;
+	while (threadIndex < numberOfStartedThreads)
+	{
+		struct timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_nsec += 10 * 1000000L;
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+
+		if (pthread_timedjoin_np(threads[threadIndex], NULL, &deadline) == 0)
+		{
+			threadIndex++;
+		}
+		else if (run->watchdog != NULL && run->watchdog->expired == TRUE)
+		{
+			// Leave the workers which may be stuck in the property running detached
+			__atomic_store_n(&sharedRun->stopped, TRUE, __ATOMIC_RELAXED);
+			for (; threadIndex < numberOfStartedThreads; threadIndex++)
+			{
+				pthread_detach(threads[threadIndex]);
+			}
+		}
+	}
+
+	run->nextAttempt = __atomic_load_n(&sharedRun->nextAttempt, __ATOMIC_ACQUIRE);
+	run->passedCases = __atomic_load_n(&sharedRun->passedCases, __ATOMIC_ACQUIRE);
+	run->discardedCases = __atomic_load_n(&sharedRun->discardedCases, __ATOMIC_ACQUIRE);
+	run->failedAttempt = __atomic_load_n(&sharedRun->failedAttempt, __ATOMIC_ACQUIRE);
+
+	PauseTestAllocations();
+	ReleasePropertyRun(sharedRun);
+	ResumeTestAllocations();
+
+	ReleaseTestWatchdog();
+}
+
+/**
+ * @fn static TestPropertyCaseResult EvaluatePropertyCase(TestPropertyRunPtr run, TestPropertySourcePtr source, const unsigned long long *replayChoices, int numberOfReplayChoices, unsigned long long caseSeed, int report)
+ * @brief 입력 하나를 만들어 현재 스레드의 TestContext 객체에서 속성을 검사하는 함수
+ * report 가 FALSE 이면 실패 정보를 전달하지 않고 TestContext 객체의 실패 횟수와 진행 상태를 되돌린다.
+ * @param run 속성 기반 테스트의 실행 상태(입력)
+ * @param source 입력 생성 상태(입력, 출력, 사용한 선택값이 남는다)
+ * @param replayChoices 다시 사용할 선택값 리스트(입력, NULL 이면 caseSeed 로 새 입력을 만든다)
+ * @param numberOfReplayChoices 다시 사용할 선택값 개수(입력)
+ * @param caseSeed 입력의 난수 seed(입력)
+ * @param report 실패 정보를 전달하고 입력 값을 설명할지 여부(입력)
+ * @return 검사 결과 반환
+ */
+static TestPropertyCaseResult EvaluatePropertyCase(TestPropertyRunPtr run, TestPropertySourcePtr source, const unsigned long long *replayChoices, int numberOfReplayChoices, unsigned long long caseSeed, int report)
+{
+	TestContextPtr context = _testContext;
+	int failCount = context->failCount;
+	int onGoing = context->onGoing;
+	int muteFailures = context->muteFailures;
+	TestPropertySourcePtr previousSource = context->propertySource;
+
+	ResetPropertySource(source, replayChoices, numberOfReplayChoices, caseSeed);
+	if (report == TRUE)
+	{
+		PauseTestAllocations();
+		source->description = (char*)malloc(TEST_PROPERTY_DESCRIPTION_SIZE);
+		ResumeTestAllocations();
+		if (source->description != NULL)
+		{
+			source->description[0] = '\0';
+		}
+	}
+	else
+	{
+		context->muteFailures = TRUE;
+	}
+
+	context->propertySource = source;
+	run->property();
+	context->propertySource = previousSource;
+
+	TestPropertyCaseResult result = TestPropertyCasePass;
+	if (context->failCount > failCount)
+	{
+		result = TestPropertyCaseFail;
+	}
+	else if (source->discarded == TRUE)
+	{
+		result = TestPropertyCaseDiscard;
+	}
+
+	if (report == FALSE)
+	{
+		context->failCount = failCount;
+		context->onGoing = onGoing;
+		context->muteFailures = muteFailures;
+	}
+
+	PauseTestAllocations();
+	ReleasePropertyValues(source);
+	ResumeTestAllocations();
+
+	return result;
+}
+
+/**
+ * @fn static int ShrinkPropertyCase(TestPropertyRunPtr run, TestPropertySourcePtr source, unsigned long long **bestContainer, int *numberOfBestChoices)
+ * @brief 실패한 입력의 선택값 리스트를 속성이 계속 실패하는 범위에서 가장 작게 줄이는 함수
+ * 선택값 구간을 지우는 단계(문자열과 배열이 짧아진다)와 선택값을 0 이나 더 작은 값으로 바꾸는 단계(값이 단순해진다)를
+ * 더 이상 줄어들지 않거나 최대 실행 횟수에 이를 때까지 반복한다.
+ * @param run 속성 기반 테스트의 실행 상태(입력)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param bestContainer 가장 작은 실패 입력의 선택값 리스트(입력, 출력)
+ * @param numberOfBestChoices 가장 작은 실패 입력의 선택값 개수(입력, 출력)
+ * @return 입력을 줄인 횟수 반환
+ */
+static int ShrinkPropertyCase(TestPropertyRunPtr run, TestPropertySourcePtr source, unsigned long long **bestContainer, int *numberOfBestChoices)
+{
+	int numberOfShrinks = 0;
+	int numberOfRuns = 0;
+
+	PauseTestAllocations();
+	unsigned long long *candidate = (unsigned long long*)malloc(((size_t)*numberOfBestChoices + 1) * sizeof(unsigned long long));
+	ResumeTestAllocations();
+	if (candidate == NULL)
+	{
+		return 0;
+	}
+
+	int improved = TRUE;
+	while (improved == TRUE && numberOfRuns < TEST_PROPERTY_MAX_SHRINK_RUNS)
+	{
+		improved = FALSE;
+
+		// Delete chunks of choices, from the end so that the earlier structure stays
+		int chunkSize = 8;
+		for (; chunkSize >= 1 && numberOfRuns < TEST_PROPERTY_MAX_SHRINK_RUNS; chunkSize /= 2)
+		{
+			int position = *numberOfBestChoices - chunkSize;
+			for (; position >= 0 && numberOfRuns < TEST_PROPERTY_MAX_SHRINK_RUNS; position--)
+			{
+				if (position + chunkSize > *numberOfBestChoices)
+				{
+					continue;
+				}
+
+				int numberOfCandidateChoices = *numberOfBestChoices - chunkSize;
+				memcpy(candidate, *bestContainer, (size_t)position * sizeof(unsigned long long));
+				memcpy(candidate + position, *bestContainer + position + chunkSize, (size_t)(numberOfCandidateChoices - position) * sizeof(unsigned long long));
+				numberOfRuns++;
+				if (TryPropertyCandidate(run, source, candidate, numberOfCandidateChoices, bestContainer, numberOfBestChoices) == TRUE)
+				{
+					numberOfShrinks++;
+					improved = TRUE;
+				}
+			}
+		}
+
+		// Lower each choice, to zero first and then by binary search
+		int position = 0;
+		for (; position < *numberOfBestChoices && numberOfRuns < TEST_PROPERTY_MAX_SHRINK_RUNS; position++)
+		{
+			unsigned long long high = (*bestContainer)[position];
+			if (high == 0)
+			{
+				continue;
+			}
+
+			unsigned long long low = 0;
+			int lowTried = FALSE;
+			while (low < high && numberOfRuns < TEST_PROPERTY_MAX_SHRINK_RUNS)
+			{
+				unsigned long long value = (lowTried == FALSE) ? low : low + (high - low) / 2;
+				if (lowTried == TRUE && value == low)
+				{
+					break;
+				}
+
+				memcpy(candidate, *bestContainer, (size_t)*numberOfBestChoices * sizeof(unsigned long long));
+				candidate[position] = value;
+				numberOfRuns++;
+				if (TryPropertyCandidate(run, source, candidate, *numberOfBestChoices, bestContainer, numberOfBestChoices) == TRUE)
+				{
+					numberOfShrinks++;
+					improved = TRUE;
+
+					// The choices after this one may mean something else now
+					if (position >= *numberOfBestChoices || (*bestContainer)[position] != value)
+					{
+						break;
+					}
+					high = value;
+				}
+				else
+				{
+					low = value;
+				}
+				lowTried = TRUE;
+			}
+		}
+	}
+
+	PauseTestAllocations();
+	free(candidate);
+	ResumeTestAllocations();
+
+	return numberOfShrinks;
+}
+
+/**
+ * @fn static int TryPropertyCandidate(TestPropertyRunPtr run, TestPropertySourcePtr source, const unsigned long long *candidate, int numberOfCandidateChoices, unsigned long long **bestContainer, int *numberOfBestChoices)
+ * @brief 후보 선택값 리스트로 입력을 만들어 속성이 여전히 실패하면 실제로 사용한 선택값 리스트를 가장 작은 실패 입력으로 바꾸는 함수
+ * @param run 속성 기반 테스트의 실행 상태(입력)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param candidate 후보 선택값 리스트(입력)
+ * @param numberOfCandidateChoices 후보 선택값 개수(입력)
+ * @param bestContainer 가장 작은 실패 입력의 선택값 리스트(입력, 출력)
+ * @param numberOfBestChoices 가장 작은 실패 입력의 선택값 개수(입력, 출력)
+ * @return 가장 작은 실패 입력이 바뀌었으면 TRUE, 아니면 FALSE 반환
+ */
+static int TryPropertyCandidate(TestPropertyRunPtr run, TestPropertySourcePtr source, const unsigned long long *candidate, int numberOfCandidateChoices, unsigned long long **bestContainer, int *numberOfBestChoices)
+{
+	if (EvaluatePropertyCase(run, source, candidate, numberOfCandidateChoices, 0, FALSE) != TestPropertyCaseFail)
+	{
+		return FALSE;
+	}
+
+	// Keep the choices actually used, which may be shorter than or differ from the candidate
+	if (IsSmallerChoices(source->choices, source->numberOfChoices, *bestContainer, *numberOfBestChoices) == FALSE)
+	{
+		return FALSE;
+	}
+
+	// A smaller list never needs more room than the current one
+	memcpy(*bestContainer, source->choices, (size_t)source->numberOfChoices * sizeof(unsigned long long));
+	*numberOfBestChoices = source->numberOfChoices;
+
+	return TRUE;
+}
+
+/**
+ * @fn static int IsSmallerChoices(const unsigned long long *left, int numberOfLeftChoices, const unsigned long long *right, int numberOfRightChoices)
+ * @brief 선택값 리스트가 다른 리스트보다 작은지(개수가 적거나, 같으면 사전순으로 앞서는지) 비교하는 함수
+ * @param left 비교할 선택값 리스트(입력)
+ * @param numberOfLeftChoices left 의 선택값 개수(입력)
+ * @param right 비교 대상 선택값 리스트(입력)
+ * @param numberOfRightChoices right 의 선택값 개수(입력)
+ * @return left 가 작으면 TRUE, 아니면 FALSE 반환
+ */
+static int IsSmallerChoices(const unsigned long long *left, int numberOfLeftChoices, const unsigned long long *right, int numberOfRightChoices)
+{
+	if (numberOfLeftChoices != numberOfRightChoices)
+	{
+		return (numberOfLeftChoices < numberOfRightChoices) ? TRUE : FALSE;
+	}
+
+	int choiceIndex = 0;
+	for (; choiceIndex < numberOfLeftChoices; choiceIndex++)
+	{
+		if (left[choiceIndex] != right[choiceIndex])
+		{
+			return (left[choiceIndex] < right[choiceIndex]) ? TRUE : FALSE;
+		}
+	}
+
+	return FALSE;
+}
+
+/**
+ * @fn static void ResetPropertySource(TestPropertySourcePtr source, const unsigned long long *replayChoices, int numberOfReplayChoices, unsigned long long caseSeed)
+ * @brief 새 입력을 만들 수 있도록 입력 생성 상태를 초기화하는 함수(버퍼는 재사용한다)
+ * @param source 입력 생성 상태(출력)
+ * @param replayChoices 다시 사용할 선택값 리스트(입력, NULL 이면 난수 사용)
+ * @param numberOfReplayChoices 다시 사용할 선택값 개수(입력)
+ * @param caseSeed 입력의 난수 seed(입력)
+ * @return 반환값 없음
+ */
+static void ResetPropertySource(TestPropertySourcePtr source, const unsigned long long *replayChoices, int numberOfReplayChoices, unsigned long long caseSeed)
+{
+	source->replayChoices = replayChoices;
+	source->numberOfReplayChoices = numberOfReplayChoices;
+	source->numberOfChoices = 0;
+	source->randomState = (caseSeed != 0) ? caseSeed : 0x9E3779B97F4A7C15ULL;
+	source->descriptionLength = 0;
+	source->numberOfDescribedValues = 0;
+	source->discarded = FALSE;
+}
+
+/**
+ * @fn static void ReleasePropertyValues(TestPropertySourcePtr source)
+ * @brief 입력 하나에서 만든 값들을 해제하는 함수
+ * @param source 입력 생성 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void ReleasePropertyValues(TestPropertySourcePtr source)
+{
+	int valueIndex = 0;
+	for (; valueIndex < source->numberOfValues; valueIndex++)
+	{
+		free(source->values[valueIndex]);
+	}
+	source->numberOfValues = 0;
+}
+
+/**
+ * @fn static void DeletePropertySource(TestPropertySourcePtr source)
+ * @brief 입력 생성 상태의 버퍼들을 해제하는 함수
+ * @param source 입력 생성 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void DeletePropertySource(TestPropertySourcePtr source)
+{
+	ReleasePropertyValues(source);
+	free(source->choices);
+	free(source->values);
+	free(source->scratch);
+	free(source->description);
+	memset(source, 0, sizeof(TestPropertySource));
+}
+
+/**
+ * @fn static TestPropertySourcePtr GetPropertySource(void)
+ * @brief 현재 스레드에서 실행 중인 속성 기반 테스트의 입력 생성 상태를 반환하는 함수
+ * @return 입력 생성 상태, 속성 기반 테스트를 실행 중이 아니면 NULL 반환
+ */
+static TestPropertySourcePtr GetPropertySource(void)
+{
+	TestContextPtr context = _testContext;
+
+	return (context != NULL) ? context->propertySource : NULL;
+}
+
+/**
+ * @fn static unsigned long long DrawPropertyChoice(TestPropertySourcePtr source, unsigned long long bound)
+ * @brief 0 이상 bound 이하의 선택값을 하나 꺼내는 함수
+ * 새 입력을 만들 때는 0, bound, 작은 값이 자주 나오도록 치우친 난수를 사용하고,
+ * 선택값 리스트를 다시 사용할 때는 리스트의 값을 bound 로 자르며 리스트가 끝나면 0 을 사용한다.
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param bound 선택값의 상한(입력)
+ * @return 선택값 반환
+ */
+static unsigned long long DrawPropertyChoice(TestPropertySourcePtr source, unsigned long long bound)
+{
+	unsigned long long choice = 0;
+	if (source->replayChoices != NULL)
+	{
+		if (source->numberOfChoices < source->numberOfReplayChoices)
+		{
+			choice = source->replayChoices[source->numberOfChoices];
+		}
+		if (choice > bound)
+		{
+			choice = bound;
+		}
+	}
+	else
+	{
+		unsigned long long random = NextPropertyRandom(source);
+		unsigned long long range = (bound == ULLONG_MAX) ? 0 : bound + 1;
+		switch (random & 15)
+		{
+			case 0:
+				choice = 0;
+				break;
+			case 1:
+				choice = bound;
+				break;
+			case 2:
+			case 3:
+				choice = NextPropertyRandom(source) % ((range == 0 || range > 16) ? 16 : range);
+				break;
+			default:
+				choice = (range == 0) ? NextPropertyRandom(source) : NextPropertyRandom(source) % range;
+				break;
+		}
+	}
+
+	RecordPropertyChoice(source, choice);
+
+	return choice;
+}
+
+/**
+ * @fn static int DrawPropertyBoolean(TestPropertySourcePtr source, double probability)
+ * @brief 지정한 확률로 TRUE 인 선택값을 하나 꺼내는 함수(FALSE 로 줄어든다)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param probability 새 입력을 만들 때 TRUE 일 확률(입력)
+ * @return 선택값이 0 이 아니면 TRUE, 0 이면 FALSE 반환
+ */
+static int DrawPropertyBoolean(TestPropertySourcePtr source, double probability)
+{
+	unsigned long long choice = 0;
+	if (source->replayChoices != NULL)
+	{
+		if (source->numberOfChoices < source->numberOfReplayChoices && source->replayChoices[source->numberOfChoices] != 0)
+		{
+			choice = 1;
+		}
+	}
+	else
+	{
+		choice = ((double)(NextPropertyRandom(source) >> 11) / 9007199254740992.0 < probability) ? 1 : 0;
+	}
+
+	RecordPropertyChoice(source, choice);
+
+	return (choice != 0) ? TRUE : FALSE;
+}
+
+/**
+ * @fn static void RecordPropertyChoice(TestPropertySourcePtr source, unsigned long long choice)
+ * @brief 사용한 선택값을 기록하는 함수(최대 개수를 넘거나 공간을 늘리지 못하면 기록하지 않는다)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param choice 사용한 선택값(입력)
+ * @return 반환값 없음
+ */
+static void RecordPropertyChoice(TestPropertySourcePtr source, unsigned long long choice)
+{
+	if (source->numberOfChoices >= source->choiceCapacity)
+	{
+		if (source->choiceCapacity >= TEST_PROPERTY_MAX_CHOICES)
+		{
+			return;
+		}
+
+		int capacity = (source->choiceCapacity == 0) ? 256 : source->choiceCapacity * 2;
+		PauseTestAllocations();
+		unsigned long long *choices = (unsigned long long*)realloc(source->choices, (size_t)capacity * sizeof(unsigned long long));
+		ResumeTestAllocations();
+		if (choices == NULL)
+		{
+			return;
+		}
+		source->choices = choices;
+		source->choiceCapacity = capacity;
+	}
+
+	source->choices[source->numberOfChoices++] = choice;
+}
+
+/**
+ * @fn static unsigned long long NextPropertyRandom(TestPropertySourcePtr source)
+ * @brief 입력 생성 상태의 다음 난수를 반환하는 함수(xorshift64*)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @return 64 비트 난수 반환
+ */
+static unsigned long long NextPropertyRandom(TestPropertySourcePtr source)
+{
+	unsigned long long state = source->randomState;
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	source->randomState = state;
+
+	return state * 2685821657736338717ULL;
+}
+
+/**
+ * @fn static unsigned long long MixPropertySeed(unsigned long long value)
+ * @brief seed 값을 고르게 섞는 함수(splitmix64, 인접한 입력 번호도 서로 무관한 seed 를 얻는다)
+ * @param value 섞을 값(입력)
+ * @return 섞인 값 반환(0 이 아니다)
+ */
+static unsigned long long MixPropertySeed(unsigned long long value)
+{
+	value += 0x9E3779B97F4A7C15ULL;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+	value ^= value >> 31;
+
+	return (value != 0) ? value : 1;
+}
+
+/**
+ * @fn static double GetContinueProbability(int minLength, int maxLength)
+ * @brief 최소 길이 이후 원소를 하나 더 만들 확률을 구하는 함수(최소 길이를 넘는 평균 길이가 범위의 절반, 최대 32 가 되도록 한다)
+ * @param minLength 최소 길이(입력)
+ * @param maxLength 최대 길이(입력)
+ * @return 원소를 하나 더 만들 확률 반환
+ */
+static double GetContinueProbability(int minLength, int maxLength)
+{
+	double average = (double)(maxLength - minLength) / 2.0;
+	if (average > TEST_PROPERTY_AVERAGE_LENGTH)
+	{
+		average = TEST_PROPERTY_AVERAGE_LENGTH;
+	}
+	if (average < 1.0)
+	{
+		average = 1.0;
+	}
+
+	return average / (average + 1.0);
+}
+
+/**
+ * @fn static void *AllocatePropertyValue(TestPropertySourcePtr source, size_t size)
+ * @brief 입력 값을 저장할 메모리를 할당하는 함수(입력 하나를 실행한 뒤 해제되며, 테스트의 메모리 할당으로 기록하지 않는다)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param size 할당할 크기(입력)
+ * @return 성공 시 할당한 메모리, 실패 시 NULL 반환
+ */
+static void *AllocatePropertyValue(TestPropertySourcePtr source, size_t size)
+{
+	PauseTestAllocations();
+	if (source->numberOfValues >= source->valueCapacity)
+	{
+		int capacity = (source->valueCapacity == 0) ? 16 : source->valueCapacity * 2;
+		void **values = (void**)realloc(source->values, (size_t)capacity * sizeof(void*));
+		if (values == NULL)
+		{
+			ResumeTestAllocations();
+			return NULL;
+		}
+		source->values = values;
+		source->valueCapacity = capacity;
+	}
+
+	void *value = malloc((size != 0) ? size : 1);
+	if (value != NULL)
+	{
+		source->values[source->numberOfValues++] = value;
+	}
+	ResumeTestAllocations();
+
+	return value;
+}
+
+/**
+ * @fn static char *GenerateText(TestPropertySourcePtr source, int minLength, int maxLength, const char *alphabet, int *length)
+ * @brief alphabet 의 문자로 길이가 minLength 이상 maxLength 이하인 문자열을 만드는 함수(설명은 기록하지 않는다)
+ * 최소 길이 이후의 문자마다 "계속" 선택값과 문자 선택값을 번갈아 꺼내므로, 선택값 두 개를 지우면 문자 하나가 지워진다.
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param minLength 최소 길이(입력)
+ * @param maxLength 최대 길이(입력)
+ * @param alphabet 사용할 문자 집합(입력, NULL 이나 빈 문자열이면 기본 문자 집합)
+ * @param length 만든 문자열의 길이(출력)
+ * @return 성공 시 만든 문자열, 실패 시 NULL 반환
+ */
+static char *GenerateText(TestPropertySourcePtr source, int minLength, int maxLength, const char *alphabet, int *length)
+{
+	if (alphabet == NULL || *alphabet == '\0')
+	{
+		alphabet = TEST_PROPERTY_ALPHABET;
+	}
+	if (minLength < 0)
+	{
+		minLength = 0;
+	}
+	if (maxLength < minLength)
+	{
+		maxLength = minLength;
+	}
+
+	unsigned long long alphabetLength = strlen(alphabet);
+	double continueProbability = GetContinueProbability(minLength, maxLength);
+
+	int textLength = 0;
+	for (; textLength < maxLength; textLength++)
+	{
+		if (textLength >= minLength && DrawPropertyBoolean(source, continueProbability) == FALSE)
+		{
+			break;
+		}
+
+		if ((size_t)textLength + 1 >= source->scratchCapacity)
+		{
+			size_t capacity = (source->scratchCapacity == 0) ? 256 : source->scratchCapacity * 2;
+			PauseTestAllocations();
+			char *scratch = (char*)realloc(source->scratch, capacity);
+			ResumeTestAllocations();
+			if (scratch == NULL)
+			{
+				return NULL;
+			}
+			source->scratch = scratch;
+			source->scratchCapacity = capacity;
+		}
+		source->scratch[textLength] = alphabet[DrawPropertyChoice(source, alphabetLength - 1)];
+	}
+
+	char *text = (char*)AllocatePropertyValue(source, (size_t)textLength + 1);
+	if (text == NULL)
+	{
+		return NULL;
+	}
+	if (textLength > 0)
+	{
+		memcpy(text, source->scratch, (size_t)textLength);
+	}
+	text[textLength] = '\0';
+	*length = textLength;
+
+	return text;
+}
+
+/**
+ * @fn static void BeginPropertyValue(TestPropertySourcePtr source)
+ * @brief 반례 설명에 새 입력 값의 시작("#번호=")을 덧붙이는 함수(GEN_ 함수마다 한 번 호출한다)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void BeginPropertyValue(TestPropertySourcePtr source)
+{
+	source->numberOfDescribedValues++;
+	DescribePropertyValue(source, "%s#%d=", (source->numberOfDescribedValues > 1) ? ", " : "", source->numberOfDescribedValues);
+}
+
+/**
+ * @fn static void DescribePropertyValue(TestPropertySourcePtr source, const char *format, ...)
+ * @brief 반례 설명에 내용을 덧붙이는 함수(설명을 기록하는 중이 아니면 아무 동작도 하지 않고, 최대 길이를 넘는 부분은 "..." 으로 자른다)
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param format 형식 문자열(입력)
+ * @return 반환값 없음
+ */
+static void DescribePropertyValue(TestPropertySourcePtr source, const char *format, ...)
+{
+	if (source->description == NULL || source->descriptionLength >= TEST_PROPERTY_DESCRIPTION_SIZE - 4)
+	{
+		return;
+	}
+
+	size_t room = TEST_PROPERTY_DESCRIPTION_SIZE - 4 - source->descriptionLength;
+
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(source->description + source->descriptionLength, room, format, args);
+	va_end(args);
+
+	if (length < 0 || (size_t)length >= room)
+	{
+		source->descriptionLength = TEST_PROPERTY_DESCRIPTION_SIZE - 4;
+		strcpy(source->description + source->descriptionLength, "...");
+		return;
+	}
+	source->descriptionLength += (size_t)length;
+}
+
+/**
+ * @fn static void DescribePropertyText(TestPropertySourcePtr source, const char *text, size_t length, char quote)
+ * @brief 반례 설명에 문자열을 따옴표로 감싸고 특수 문자를 이스케이프(\t, \n, \\, 따옴표, \xHH)하여 덧붙이는 함수
+ * @param source 입력 생성 상태(입력, 출력)
+ * @param text 덧붙일 문자열(입력)
+ * @param length 문자열의 길이(입력)
+ * @param quote 감쌀 따옴표 문자(입력)
+ * @return 반환값 없음
+ */
+static void DescribePropertyText(TestPropertySourcePtr source, const char *text, size_t length, char quote)
+{
+	if (source->description == NULL)
+	{
+		return;
+	}
+
+	DescribePropertyValue(source, "%c", quote);
+
+	size_t textIndex = 0;
+	for (; textIndex < length; textIndex++)
+	{
+		unsigned char character = (unsigned char)text[textIndex];
+		if (character == '\n')
+		{
+			DescribePropertyValue(source, "\\n");
+		}
+		else if (character == '\t')
+		{
+			DescribePropertyValue(source, "\\t");
+		}
+		else if (character == '\\' || character == (unsigned char)quote)
+		{
+			DescribePropertyValue(source, "\\%c", character);
+		}
+		else if (character < 0x20 || character >= 0x7f)
+		{
+			DescribePropertyValue(source, "\\x%02x", character);
+		}
+		else
+		{
+			DescribePropertyValue(source, "%c", character);
+		}
+	}
+
+	DescribePropertyValue(source, "%c", quote);
+}
@@ -0,0 +1,1453 @@
+#include "ttlib_internal.h"
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdarg.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 실패 메시지를 포맷팅할 때 먼저 사용하는 스택 버퍼 크기(더 길면 힙에 할당)
+#define TEST_FAILURE_MESSAGE_SIZE 512
+
+// 실패 인자 값을 기록하기 전에 실패 정보 기록 버퍼에 먼저 확보하는 크기(더 길면 길이를 계산하여 다시 기록)
+#define TEST_FAILURE_ARGUMENTS_SIZE 256
+
+// 리포터가 출력할 문자열을 만들기 위한 가변 크기 버퍼
+typedef struct _test_text_buffer_t
+{
+	// 문자열 데이터
+	char *data;
+	// 기록된 길이
+	size_t length;
+	// 버퍼 크기
+	size_t capacity;
+} TestTextBuffer, *TestTextBufferPtr;
+
+// 기본 제공 리포터들의 상태
+typedef struct _test_reporter_state_t
+{
+	// 이벤트 하나를 출력하기 위한 버퍼
+	TestTextBuffer line;
+	// 현재 테스트의 실패 정보를 모아 두는 버퍼(junit 리포터에서 사용)
+	TestTextBuffer pending;
+	// 아직 출력하지 않은 테스트 시작 정보가 있는지 여부(console 리포터의 quiet 모드에서 사용)
+	int hasPendingTest;
+} TestReporterState, *TestReporterStatePtr;
+
+// 문자열을 이스케이프하는 방식
+typedef enum _test_escape_type_t
+{
+	// JSON 문자열
+	TestEscapeJson = 1,
+	// XML 속성 및 텍스트
+	TestEscapeXml
+} TestEscapeType;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void ReportFailure(TestSuitPtr testSuit, int testIndex, const TestFailure *failure);
+static void FormatFailure(TestContextPtr context, const char *macroName, const char *fileName, int lineNumber, const char *format, va_list args);
+static void AppendFailureRecord(TestContextPtr context, const TestFailure *failure);
+static int AppendFailureArguments(TestContextPtr context, const TestFailureSite *site, va_list args);
+static char *ReserveFailureRecord(TestContextPtr context, size_t recordLength);
+static void CommitFailureRecord(TestContextPtr context, size_t recordLength);
+static void ReplayFailureRecord(TestSuitPtr testSuit, int testIndex, const TestFailureRecord *record, const char *data);
+static void FlushReporterSink(TestSuitPtr testSuit);
+static const char *GetResultName(TestResult result);
+static const char *GetBaselineStatusName(int baselineStatus);
+
+static int AppendText(TestTextBufferPtr buffer, const char *format, ...) __attribute__((format(printf, 2, 3)));
+static int AppendEscapedText(TestTextBufferPtr buffer, const char *text, TestEscapeType type);
+static int ReserveText(TestTextBufferPtr buffer, size_t length);
+static void WriteText(TestReporterPtr reporter, TestTextBufferPtr buffer);
+
+static void OnConsoleStart(TestReporterPtr reporter, TestSuitPtr testSuit);
+static void OnConsoleTestBegin(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex);
+static void OnConsoleFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure);
+static void OnConsoleTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report);
+static void OnConsoleFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests);
+static void PrintConsoleTest(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex);
+static void PrintPendingConsoleTest(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex);
+static void PrintTestTimes(TestSinkPtr sink, TestSuitPtr testSuit);
+static void PrintPerfCounter(TestSinkPtr sink, const char *name, long long value, double divisor);
+
+static void OnJsonStart(TestReporterPtr reporter, TestSuitPtr testSuit);
+static void OnJsonTestBegin(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex);
+static void OnJsonFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure);
+static void OnJsonTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report);
+static void OnJsonFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests);
+static void AppendJsonTest(TestTextBufferPtr buffer, const char *event, TestSuitPtr testSuit, int testIndex);
+static const char *FormatJsonPerfCounter(char *text, size_t size, long long value);
+
+static void OnJUnitStart(TestReporterPtr reporter, TestSuitPtr testSuit);
+static void OnJUnitFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure);
+static void OnJUnitTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report);
+static void OnJUnitFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// 여러 작업자 스레드에서 리포터 콜백 함수를 호출할 때 순서대로 호출되도록 보호하는 뮤텍스
+static pthread_mutex_t _reporterMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// 기본 제공 리포터 리스트(첫 번째가 기본값)
+static const TestReporter _reporterTemplates[] = {
+	{ "console", OnConsoleStart, OnConsoleTestBegin, OnConsoleFailure, OnConsoleTestEnd, OnConsoleFinish, NULL, NULL },
+	{ "json", OnJsonStart, OnJsonTestBegin, OnJsonFailure, OnJsonTestEnd, OnJsonFinish, NULL, NULL },
+	{ "junit", OnJUnitStart, NULL, OnJUnitFailure, OnJUnitTestEnd, OnJUnitFinish, NULL, NULL }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestReporterPtr NewTestReporter(const char *name, const char *outputPath)
+ * @brief 기본 제공 리포터(console, json, junit) 객체를 새로 생성하는 함수
+ * console 은 사람이 읽는 출력, json 은 이벤트마다 한 줄씩 출력하는 JSON Lines, junit 은 CI 도구가 읽는 JUnit XML 을 출력한다.
+ * @param name 리포터 이름(입력, NULL 이면 console)
+ * @param outputPath 출력 파일 경로(입력, NULL 이면 표준 출력)
+ * @return 성공 시 새로 생성된 TestReporter 객체, 실패 시 NULL 반환
+ */
+TestReporterPtr NewTestReporter(const char *name, const char *outputPath)
+{
+	const TestReporter *template = &_reporterTemplates[0];
+	if (name != NULL)
+	{
+		template = NULL;
+		size_t templateIndex = 0;
+		for (; templateIndex < sizeof(_reporterTemplates) / sizeof(_reporterTemplates[0]); templateIndex++)
+		{
+			if (strcmp(_reporterTemplates[templateIndex].name, name) == 0)
+			{
+				template = &_reporterTemplates[templateIndex];
+				break;
+			}
+		}
+		if (template == NULL)
+		{
+			return NULL;
+		}
+	}
+
+	TestReporterPtr reporter = (TestReporterPtr)malloc(sizeof(TestReporter));
+	if (reporter == NULL)
+	{
+		return NULL;
+	}
+	*reporter = *template;
+
+	reporter->state = calloc(1, sizeof(TestReporterState));
+	reporter->sink = NewTestSink(outputPath);
+	if (reporter->state == NULL || reporter->sink == NULL)
+	{
+		DeleteTestReporter(&reporter);
+		return NULL;
+	}
+
+	return reporter;
+}
+
+/**
+ * @fn void DeleteTestReporter(TestReporterPtrContainer reporterContainer)
+ * @brief NewTestReporter 함수로 생성한 리포터 객체를 삭제하는 함수(남은 출력은 기록된다)
+ * @param reporterContainer TestReporter 객체의 주소를 가지는 포인터(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void DeleteTestReporter(TestReporterPtrContainer reporterContainer)
+{
+	// Check parameter
+	if (reporterContainer == NULL || *reporterContainer == NULL)
+	{
+		return;
+	}
+
+	TestReporterPtr reporter = *reporterContainer;
+
+	TestReporterStatePtr state = (TestReporterStatePtr)reporter->state;
+	if (state != NULL)
+	{
+		free(state->line.data);
+		free(state->pending.data);
+		free(state);
+	}
+	DeleteTestSink(&reporter->sink);
+	free(reporter);
+
+	*reporterContainer = NULL;
+}
+
+/**
+ * @fn void SetTestReporter(TestSuitPtr testSuit, TestReporterPtr reporter)
+ * @brief 테스트 실행 과정을 출력할 리포터를 지정하는 함수
+ * 사용자가 직접 만든 리포터도 지정할 수 있으며, 지정한 리포터는 TestSuit 객체를 삭제해도 삭제되지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(출력)
+ * @param reporter 사용할 리포터(입력, NULL 이면 실행 옵션에 따라 생성)
+ * @return 반환값 없음
+ */
+void SetTestReporter(TestSuitPtr testSuit, TestReporterPtr reporter)
+{
+	// Check parameter
+	if (testSuit == NULL)
+	{
+		return;
+	}
+
+	if (testSuit->ownsReporter == TRUE)
+	{
+		DeleteTestReporter(&testSuit->reporter);
+	}
+	testSuit->reporter = reporter;
+	testSuit->ownsReporter = FALSE;
+}
+
+/**
+ * @fn void ReportTestFailure(const char *macroName, const char *fileName, int lineNumber, const char *format, ...)
+ * @brief 실패 정보를 포맷팅하여 현재 테스트의 리포터에 전달하는 함수(실행 중에 정해지는 파일 이름 등으로 실패를 알릴 때 사용)
+ * 순차 실행 시에는 바로 리포터에 전달하고, 병렬 실행 시에는 TestContext 에 기록했다가 테스트가 끝난 뒤 한 번에 전달한다.
+ * @param macroName 실패한 매크로 함수 이름(입력)
+ * @param fileName 실패한 소스 파일 이름(입력)
+ * @param lineNumber 실패한 소스 줄 번호(입력)
+ * @param format 실패 메시지 포맷 문자열(입력)
+ * @return 반환값 없음
+ */
+void ReportTestFailure(const char *macroName, const char *fileName, int lineNumber, const char *format, ...)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || format == NULL || context->muteFailures == TRUE)
+	{
+		return;
+	}
+
+	// Defer a timeout until the reporter lock and the heap are released
+	HoldTestWatchdog();
+	PauseTestAllocations();
+
+	va_list args;
+	va_start(args, format);
+	FormatFailure(context, macroName, fileName, lineNumber, format, args);
+	va_end(args);
+
+	ResumeTestAllocations();
+	ReleaseTestWatchdog();
+}
+
+/**
+ * @fn void RecordTestFailure(const TestFailureSite *site, const char *format, ...)
+ * @brief 검사 매크로 함수의 실패를 포맷팅하지 않고 호출 위치 기술자와 인자 값으로 기록하는 함수(PRINT_FAIL 매크로 함수에서 사용)
+ * 병렬 실행이나 --failure-log 사용 시에는 인자 값만 TestContext 에 기록하고, 메시지는 리포터에 전달할 때 또는 ttdecode 로 읽을 때 포맷팅한다.
+ * 순차 실행 시 바로 리포터에 전달하는 경우와 기록할 수 없는 포맷 문자열(*, $, %n 등)은 ReportTestFailure 와 같이 바로 포맷팅한다.
+ * @param site 호출 위치 기술자(입력, 정적 변수)
+ * @param format 실패 메시지 포맷 문자열(입력, site->format 과 같은 문자열, 컴파일 시 인자 형식 검사용)
+ * @return 반환값 없음
+ */
+void RecordTestFailure(const TestFailureSite *site, const char *format, ...)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || site == NULL || format == NULL || context->muteFailures == TRUE)
+	{
+		return;
+	}
+
+	// Defer a timeout until the reporter lock and the heap are released
+	HoldTestWatchdog();
+	PauseTestAllocations();
+
+	va_list args;
+	va_start(args, format);
+	if (context->streamFailures == TRUE || AppendFailureArguments(context, site, args) != 0)
+	{
+		FormatFailure(context, site->macroName, site->fileName, site->lineNumber, format, args);
+	}
+	va_end(args);
+
+	ResumeTestAllocations();
+	ReleaseTestWatchdog();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int HasTestReporter(const char *name)
+ * @brief 지정한 이름의 기본 제공 리포터가 있는지 확인하는 함수
+ * @param name 리포터 이름(입력)
+ * @return 있으면 TRUE, 없으면 FALSE 반환
+ */
+int HasTestReporter(const char *name)
+{
+	size_t templateIndex = 0;
+	for (; templateIndex < sizeof(_reporterTemplates) / sizeof(_reporterTemplates[0]); templateIndex++)
+	{
+		if (strcmp(_reporterTemplates[templateIndex].name, name) == 0)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/**
+ * @fn void ReportTestStart(TestSuitPtr testSuit)
+ * @brief 리포터에 전체 테스트 실행 시작을 전달하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 반환값 없음
+ */
+void ReportTestStart(TestSuitPtr testSuit)
+{
+	TestReporterPtr reporter = testSuit->reporter;
+	if (reporter != NULL && reporter->onStart != NULL)
+	{
+		reporter->onStart(reporter, testSuit);
+		FlushReporterSink(testSuit);
+	}
+}
+
+/**
+ * @fn void ReportTestBegin(TestSuitPtr testSuit, int testIndex)
+ * @brief 리포터에 테스트 하나의 실행 시작을 전달하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 반환값 없음
+ */
+void ReportTestBegin(TestSuitPtr testSuit, int testIndex)
+{
+	TestReporterPtr reporter = testSuit->reporter;
+	if (reporter != NULL && reporter->onTestBegin != NULL)
+	{
+		reporter->onTestBegin(reporter, testSuit, testIndex);
+		FlushReporterSink(testSuit);
+	}
+}
+
+/**
+ * @fn void ReportTestEnd(TestSuitPtr testSuit, int testIndex, const TestReport *report)
+ * @brief 리포터에 테스트 하나의 실행 결과를 전달하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @param report 테스트 실행 결과(입력)
+ * @return 반환값 없음
+ */
+void ReportTestEnd(TestSuitPtr testSuit, int testIndex, const TestReport *report)
+{
+	TestReporterPtr reporter = testSuit->reporter;
+	if (reporter != NULL && reporter->onTestEnd != NULL)
+	{
+		reporter->onTestEnd(reporter, testSuit, testIndex, report);
+		FlushReporterSink(testSuit);
+	}
+}
+
+/**
+ * @fn void ReportTestFinish(TestSuitPtr testSuit, int numberOfCurTests)
+ * @brief 리포터에 전체 테스트 실행 완료를 전달하고 출력 버퍼를 비우는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param numberOfCurTests 실행된 것으로 집계된 테스트 개수(입력)
+ * @return 반환값 없음
+ */
+void ReportTestFinish(TestSuitPtr testSuit, int numberOfCurTests)
+{
+	TestReporterPtr reporter = testSuit->reporter;
+	if (reporter == NULL)
+	{
+		return;
+	}
+
+	if (reporter->onFinish != NULL)
+	{
+		reporter->onFinish(reporter, testSuit, numberOfCurTests);
+	}
+	FlushTestSink(reporter->sink);
+}
+
+/**
+ * @fn void ReplayTestResult(TestSuitPtr testSuit, int testIndex, const char *failureLog, size_t failureLogLength, const TestReport *report)
+ * @brief 병렬 실행된 테스트 하나의 시작, 실패 정보, 결과를 리포터에 차례로 전달하는 함수
+ * 여러 작업자 스레드에서 호출될 수 있으므로 한 테스트의 이벤트가 다른 테스트와 섞이지 않도록 뮤텍스로 보호한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @param failureLog 테스트 실행 중 기록된 실패 정보(입력, 없으면 NULL)
+ * @param failureLogLength 실패 정보 길이(입력)
+ * @param report 테스트 실행 결과(입력)
+ * @return 반환값 없음
+ */
+void ReplayTestResult(TestSuitPtr testSuit, int testIndex, const char *failureLog, size_t failureLogLength, const TestReport *report)
+{
+	pthread_mutex_lock(&_reporterMutex);
+
+	ReportTestBegin(testSuit, testIndex);
+
+	int numberOfFailures = 0;
+	size_t offset = 0;
+	while (failureLog != NULL && offset + sizeof(TestFailureRecord) <= failureLogLength)
+	{
+		TestFailureRecord record;
+		memcpy(&record, failureLog + offset, sizeof(TestFailureRecord));
+		offset += sizeof(TestFailureRecord);
+
+		size_t recordLength = (record.site != NULL) ? (size_t)record.messageLength : (size_t)record.macroLength + (size_t)record.fileLength + (size_t)record.messageLength + 3;
+		if (offset + recordLength > failureLogLength)
+		{
+			break;
+		}
+
+		// With a failure log file every failure is saved there and only the first one is formatted for the reporter
+		WriteTestFailureLog(testSuit, testIndex, &record, failureLog + offset);
+		if (testSuit->failureLogFile == NULL || numberOfFailures == 0)
+		{
+			ReplayFailureRecord(testSuit, testIndex, &record, failureLog + offset);
+		}
+		numberOfFailures++;
+
+		offset += recordLength;
+	}
+
+	if (testSuit->failureLogFile != NULL && numberOfFailures > 1)
+	{
+		char message[TEST_FAILURE_MESSAGE_SIZE];
+		snprintf(message, sizeof(message), "나머지 실패 %d 개는 실패 기록 파일에 저장됨 (ttdecode %s)", numberOfFailures - 1, testSuit->options.failureLogPath);
+
+		TestFailure failure;
+		failure.macroName = "FAILURE_LOG";
+		failure.fileName = testSuit->options.failureLogPath;
+		failure.lineNumber = 0;
+		failure.message = message;
+		ReportFailure(testSuit, testIndex, &failure);
+	}
+
+	ReportTestEnd(testSuit, testIndex, report);
+
+	pthread_mutex_unlock(&_reporterMutex);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void ReportFailure(TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+ * @brief 리포터에 검사 매크로 함수의 실패 정보를 전달하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @param failure 실패 정보(입력)
+ * @return 반환값 없음
+ */
+static void ReportFailure(TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+{
+	TestReporterPtr reporter = testSuit->reporter;
+	if (reporter != NULL && reporter->onFailure != NULL)
+	{
+		reporter->onFailure(reporter, testSuit, testIndex, failure);
+		FlushReporterSink(testSuit);
+	}
+}
+
+/**
+ * @fn static void FormatFailure(TestContextPtr context, const char *macroName, const char *fileName, int lineNumber, const char *format, va_list args)
+ * @brief 실패 메시지를 포맷팅하여 바로 리포터에 전달하거나 TestContext 에 기록하는 함수
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param macroName 실패한 매크로 함수 이름(입력)
+ * @param fileName 실패한 소스 파일 이름(입력)
+ * @param lineNumber 실패한 소스 줄 번호(입력)
+ * @param format 실패 메시지 포맷 문자열(입력)
+ * @param args 포맷 문자열의 인자 리스트(입력, 복사하여 사용하므로 호출 뒤에도 유효하다)
+ * @return 반환값 없음
+ */
+static void FormatFailure(TestContextPtr context, const char *macroName, const char *fileName, int lineNumber, const char *format, va_list args)
+{
+	char stackMessage[TEST_FAILURE_MESSAGE_SIZE];
+	char *message = stackMessage;
+
+	va_list formatArgs;
+	va_copy(formatArgs, args);
+	int length = vsnprintf(stackMessage, sizeof(stackMessage), format, formatArgs);
+	va_end(formatArgs);
+	if (length < 0)
+	{
+		return;
+	}
+
+	// Format again on the heap when the message is too long for the stack buffer
+	if ((size_t)length >= sizeof(stackMessage))
+	{
+		char *heapMessage = (char*)malloc((size_t)length + 1);
+		if (heapMessage != NULL)
+		{
+			va_copy(formatArgs, args);
+			vsnprintf(heapMessage, (size_t)length + 1, format, formatArgs);
+			va_end(formatArgs);
+			message = heapMessage;
+		}
+	}
+
+	TestFailure failure;
+	failure.macroName = macroName;
+	failure.fileName = fileName;
+	failure.lineNumber = lineNumber;
+	failure.message = message;
+
+	if (context->streamFailures == TRUE)
+	{
+		ReportFailure(context->testSuit, context->testIndex, &failure);
+	}
+	else
+	{
+		AppendFailureRecord(context, &failure);
+	}
+
+	if (message != stackMessage)
+	{
+		free(message);
+	}
+}
+
+/**
+ * @fn static void AppendFailureRecord(TestContextPtr context, const TestFailure *failure)
+ * @brief 실패 정보를 TestContext 의 실패 정보 기록 버퍼에 추가하는 함수
+ * 버퍼는 작업자마다 재사용되므로 테스트마다 메모리를 할당하지 않는다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param failure 실패 정보(입력)
+ * @return 반환값 없음
+ */
+static void AppendFailureRecord(TestContextPtr context, const TestFailure *failure)
+{
+	TestFailureRecord record;
+	record.site = NULL;
+	record.lineNumber = failure->lineNumber;
+	record.macroLength = (int)strlen(failure->macroName);
+	record.fileLength = (int)strlen(failure->fileName);
+	record.messageLength = (int)strlen(failure->message);
+
+	size_t recordLength = sizeof(TestFailureRecord) + (size_t)record.macroLength + (size_t)record.fileLength + (size_t)record.messageLength + 3;
+	char *position = ReserveFailureRecord(context, recordLength);
+	if (position == NULL)
+	{
+		return;
+	}
+
+	memcpy(position, &record, sizeof(TestFailureRecord));
+	position += sizeof(TestFailureRecord);
+	memcpy(position, failure->macroName, (size_t)record.macroLength + 1);
+	position += record.macroLength + 1;
+	memcpy(position, failure->fileName, (size_t)record.fileLength + 1);
+	position += record.fileLength + 1;
+	memcpy(position, failure->message, (size_t)record.messageLength + 1);
+
+	CommitFailureRecord(context, recordLength);
+}
+
+/**
+ * @fn static int AppendFailureArguments(TestContextPtr context, const TestFailureSite *site, va_list args)
+ * @brief 호출 위치 기술자와 포맷팅하지 않은 인자 값을 TestContext 의 실패 정보 기록 버퍼에 추가하는 함수
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param site 호출 위치 기술자(입력)
+ * @param args 포맷 문자열의 인자 리스트(입력, 복사하여 사용하므로 호출 뒤에도 유효하다)
+ * @return 성공 시 0, 기록할 수 없는 포맷 문자열이거나 메모리가 부족하면 -1 반환
+ */
+static int AppendFailureArguments(TestContextPtr context, const TestFailureSite *site, va_list args)
+{
+	char *position = ReserveFailureRecord(context, sizeof(TestFailureRecord) + TEST_FAILURE_ARGUMENTS_SIZE);
+	if (position == NULL)
+	{
+		return -1;
+	}
+
+	// Encode in place into the space left in the buffer, and once more after growing it when the arguments do not fit
+	size_t available = context->failureLogCapacity - context->failureLogLength - sizeof(TestFailureRecord);
+	va_list encodeArgs;
+	va_copy(encodeArgs, args);
+	long long argumentsLength = EncodeTestFailureArguments(site->format, encodeArgs, position + sizeof(TestFailureRecord), available);
+	va_end(encodeArgs);
+	if (argumentsLength < 0 || argumentsLength > INT_MAX)
+	{
+		return -1;
+	}
+
+	size_t recordLength = sizeof(TestFailureRecord) + (size_t)argumentsLength;
+	if ((size_t)argumentsLength > available)
+	{
+		position = ReserveFailureRecord(context, recordLength);
+		if (position == NULL)
+		{
+			return -1;
+		}
+
+		va_copy(encodeArgs, args);
+		EncodeTestFailureArguments(site->format, encodeArgs, position + sizeof(TestFailureRecord), (size_t)argumentsLength);
+		va_end(encodeArgs);
+	}
+
+	TestFailureRecord record;
+	memset(&record, 0, sizeof(TestFailureRecord));
+	record.site = site;
+	record.messageLength = (int)argumentsLength;
+	memcpy(position, &record, sizeof(TestFailureRecord));
+
+	CommitFailureRecord(context, recordLength);
+
+	return 0;
+}
+
+/**
+ * @fn static char *ReserveFailureRecord(TestContextPtr context, size_t recordLength)
+ * @brief TestContext 의 실패 정보 기록 버퍼에 레코드 하나를 쓸 공간을 확보하는 함수
+ * 버퍼는 작업자마다 재사용되므로 테스트마다 메모리를 할당하지 않는다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param recordLength 레코드 길이(입력, 헤더 포함)
+ * @return 성공 시 레코드를 쓸 위치(기록 길이는 호출자가 CommitFailureRecord 함수로 늘린다), 실패 시 NULL 반환
+ */
+static char *ReserveFailureRecord(TestContextPtr context, size_t recordLength)
+{
+	if (context->failureLogLength + recordLength > context->failureLogCapacity)
+	{
+		size_t capacity = (context->failureLogCapacity == 0) ? 1024 : context->failureLogCapacity;
+		while (capacity < context->failureLogLength + recordLength)
+		{
+			capacity *= 2;
+		}
+
+		char *failureLog = (char*)realloc(context->failureLog, capacity);
+		if (failureLog == NULL)
+		{
+			return NULL;
+		}
+		context->failureLog = failureLog;
+		context->failureLogCapacity = capacity;
+	}
+
+	return context->failureLog + context->failureLogLength;
+}
+
+/**
+ * @fn static void CommitFailureRecord(TestContextPtr context, size_t recordLength)
+ * @brief ReserveFailureRecord 함수로 확보한 공간에 쓴 레코드를 실패 정보 기록에 포함시키는 함수
+ * 작업자 프로세스에서는 테스트가 비정상 종료되어도 실패 정보가 남도록 레코드를 바로 부모 프로세스에게 전달한다.
+ * @param context 현재 테스트의 TestContext 객체(입력, 출력)
+ * @param recordLength 레코드 길이(입력, 헤더 포함)
+ * @return 반환값 없음
+ */
+static void CommitFailureRecord(TestContextPtr context, size_t recordLength)
+{
+	if (context->failureFd >= 0)
+	{
+		SendTestFailureRecord(context, context->failureLog + context->failureLogLength, recordLength);
+	}
+
+	context->failureLogLength += recordLength;
+}
+
+/**
+ * @fn static void ReplayFailureRecord(TestSuitPtr testSuit, int testIndex, const TestFailureRecord *record, const char *data)
+ * @brief 실패 정보 기록 버퍼의 레코드 하나를 실패 정보로 만들어 리포터에 전달하는 함수
+ * 호출 위치 기술자가 있는 레코드는 이때 인자 값으로 메시지를 포맷팅한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @param record 레코드 헤더(입력)
+ * @param data 헤더 뒤에 붙은 데이터(입력)
+ * @return 반환값 없음
+ */
+static void ReplayFailureRecord(TestSuitPtr testSuit, int testIndex, const TestFailureRecord *record, const char *data)
+{
+	TestFailure failure;
+	if (record->site == NULL)
+	{
+		failure.macroName = data;
+		failure.fileName = failure.macroName + record->macroLength + 1;
+		failure.message = failure.fileName + record->fileLength + 1;
+		failure.lineNumber = record->lineNumber;
+		ReportFailure(testSuit, testIndex, &failure);
+		return;
+	}
+
+	const TestFailureSite *site = record->site;
+	char stackMessage[TEST_FAILURE_MESSAGE_SIZE];
+	char *message = stackMessage;
+	int length = FormatTestFailureMessage(site->format, data, (size_t)record->messageLength, stackMessage, sizeof(stackMessage));
+	if (length >= (int)sizeof(stackMessage))
+	{
+		char *heapMessage = (char*)malloc((size_t)length + 1);
+		if (heapMessage != NULL)
+		{
+			FormatTestFailureMessage(site->format, data, (size_t)record->messageLength, heapMessage, (size_t)length + 1);
+			message = heapMessage;
+		}
+	}
+	else if (length < 0)
+	{
+		snprintf(stackMessage, sizeof(stackMessage), "%s", site->format);
+	}
+
+	failure.macroName = site->macroName;
+	failure.fileName = site->fileName;
+	failure.lineNumber = site->lineNumber;
+	failure.message = message;
+	ReportFailure(testSuit, testIndex, &failure);
+
+	if (message != stackMessage)
+	{
+		free(message);
+	}
+}
+
+/**
+ * @fn static void FlushReporterSink(TestSuitPtr testSuit)
+ * @brief 터미널에 출력하는 경우 리포터 이벤트마다 출력 버퍼를 비우는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 반환값 없음
+ */
+static void FlushReporterSink(TestSuitPtr testSuit)
+{
+	TestSinkPtr sink = testSuit->reporter->sink;
+	if (sink != NULL && sink->autoFlush == TRUE)
+	{
+		FlushTestSink(sink);
+	}
+}
+
+/**
+ * @fn static const char *GetResultName(TestResult result)
+ * @brief 테스트 실행 결과를 리포터 출력에 사용할 이름으로 변환하는 함수
+ * @param result 테스트 실행 결과(입력)
+ * @return 결과 이름 반환
+ */
+static const char *GetResultName(TestResult result)
+{
+	switch (result)
+	{
+		case TestSuccess:
+			return "pass";
+		case TestFail:
+			return "fail";
+		case TestCrash:
+			return "crash";
+		case TestTimeout:
+			return "timeout";
+		case TestNotRun:
+			return "not_run";
+		default:
+			return "unknown";
+	}
+}
+
+/**
+ * @fn static const char *GetBaselineStatusName(int baselineStatus)
+ * @brief 벤치마크 기준 결과 비교 결과를 리포터 출력에 사용할 이름으로 변환하는 함수
+ * @param baselineStatus 기준 결과 비교 결과(TestBaselineStatus, 입력)
+ * @return 비교 결과 이름 반환(비교하지 않았으면 NULL)
+ */
+static const char *GetBaselineStatusName(int baselineStatus)
+{
+	switch (baselineStatus)
+	{
+		case TestBaselineNew:
+			return "new";
+		case TestBaselineUnchanged:
+			return "unchanged";
+		case TestBaselineImproved:
+			return "improved";
+		case TestBaselineRegressed:
+			return "regressed";
+		default:
+			return NULL;
+	}
+}
+
+/**
+ * @fn static int AppendText(TestTextBufferPtr buffer, const char *format, ...)
+ * @brief printf 와 같은 방식으로 포맷팅한 문자열을 버퍼에 추가하는 함수
+ * @param buffer 문자열 버퍼(입력, 출력)
+ * @param format 포맷 문자열(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int AppendText(TestTextBufferPtr buffer, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(NULL, 0, format, args);
+	va_end(args);
+	if (length < 0 || ReserveText(buffer, (size_t)length) != 0)
+	{
+		return -1;
+	}
+
+	va_start(args, format);
+	vsnprintf(buffer->data + buffer->length, (size_t)length + 1, format, args);
+	va_end(args);
+	buffer->length += (size_t)length;
+
+	return 0;
+}
+
+/**
+ * @fn static int AppendEscapedText(TestTextBufferPtr buffer, const char *text, TestEscapeType type)
+ * @brief 문자열을 JSON 문자열 또는 XML 텍스트로 사용할 수 있도록 이스케이프하여 버퍼에 추가하는 함수
+ * XML 1.0 에서 사용할 수 없는 제어 문자는 '?' 로 바꾼다.
+ * @param buffer 문자열 버퍼(입력, 출력)
+ * @param text 이스케이프할 문자열(입력)
+ * @param type 이스케이프 방식(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int AppendEscapedText(TestTextBufferPtr buffer, const char *text, TestEscapeType type)
+{
+	if (text == NULL)
+	{
+		text = "(null)";
+	}
+
+	// Every character takes at most six bytes after escaping
+	if (ReserveText(buffer, strlen(text) * 6) != 0)
+	{
+		return -1;
+	}
+
+	char *position = buffer->data + buffer->length;
+	const unsigned char *character = (const unsigned char*)text;
+	for (; *character != '\0'; character++)
+	{
+		const char *escaped = NULL;
+		if (type == TestEscapeJson)
+		{
+			switch (*character)
+			{
+				case '"': escaped = "\\\""; break;
+				case '\\': escaped = "\\\\"; break;
+				case '\n': escaped = "\\n"; break;
+				case '\r': escaped = "\\r"; break;
+				case '\t': escaped = "\\t"; break;
+				default:
+					if (*character < 0x20)
+					{
+						position += sprintf(position, "\\u%04x", *character);
+						continue;
+					}
+					break;
+			}
+		}
+		else
+		{
+			switch (*character)
+			{
+				case '&': escaped = "&amp;"; break;
+				case '<': escaped = "&lt;"; break;
+				case '>': escaped = "&gt;"; break;
+				case '"': escaped = "&quot;"; break;
+				case '\'': escaped = "&apos;"; break;
+				case '\n': escaped = "&#10;"; break;
+				case '\t': escaped = "&#9;"; break;
+				default:
+					if (*character < 0x20)
+					{
+						escaped = "?";
+					}
+					break;
+			}
+		}
+
+		if (escaped != NULL)
+		{
+			size_t length = strlen(escaped);
+			memcpy(position, escaped, length);
+			position += length;
+		}
+		else
+		{
+			*position++ = (char)*character;
+		}
+	}
+
+	*position = '\0';
+	buffer->length = (size_t)(position - buffer->data);
+
+	return 0;
+}
+
+/**
+ * @fn static int ReserveText(TestTextBufferPtr buffer, size_t length)
+ * @brief 버퍼에 지정한 길이의 문자열과 NULL 문자를 추가할 공간을 확보하는 함수
+ * @param buffer 문자열 버퍼(입력, 출력)
+ * @param length 추가할 문자열 길이(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int ReserveText(TestTextBufferPtr buffer, size_t length)
+{
+	if (buffer->length + length + 1 <= buffer->capacity)
+	{
+		return 0;
+	}
+
+	size_t capacity = (buffer->capacity == 0) ? 256 : buffer->capacity;
+	while (capacity < buffer->length + length + 1)
+	{
+		capacity *= 2;
+	}
+
+	char *data = (char*)realloc(buffer->data, capacity);
+	if (data == NULL)
+	{
+		return -1;
+	}
+	buffer->data = data;
+	buffer->capacity = capacity;
+
+	return 0;
+}
+
+/**
+ * @fn static void WriteText(TestReporterPtr reporter, TestTextBufferPtr buffer)
+ * @brief 버퍼에 만든 문자열을 리포터의 출력 대상에 기록하고 버퍼를 비우는 함수
+ * @param reporter 리포터(입력)
+ * @param buffer 문자열 버퍼(입력, 출력)
+ * @return 반환값 없음
+ */
+static void WriteText(TestReporterPtr reporter, TestTextBufferPtr buffer)
+{
+	WriteTestSink(reporter->sink, buffer->data, buffer->length);
+	buffer->length = 0;
+}
+
+/**
+ * @fn static void OnConsoleStart(TestReporterPtr reporter, TestSuitPtr testSuit)
+ * @brief (console) 전체 테스트 개수를 출력하는 함수
+ */
+static void OnConsoleStart(TestReporterPtr reporter, TestSuitPtr testSuit)
+{
+	PrintTestSink(reporter->sink, "--------------------------------\n");
+	if (testSuit->numberOfSelectedTests != testSuit->numberOfTests)
+	{
+		PrintTestSink(reporter->sink, "[ 총 테스트 수: %d 개 / 선택된 테스트 수: %d 개 ]\n", testSuit->numberOfTests, testSuit->numberOfSelectedTests);
+	}
+	else
+	{
+		PrintTestSink(reporter->sink, "[ 총 테스트 수: %d 개 ]\n", testSuit->numberOfTests);
+	}
+	if (testSuit->options.totalShards > 1)
+	{
+		PrintTestSink(reporter->sink, "[ 샤드: %d / %d ]\n", testSuit->options.shardIndex, testSuit->options.totalShards);
+	}
+	if (testSuit->options.perfCounters == TRUE && testSuit->perfCounterError != 0)
+	{
+		PrintTestSink(reporter->sink, "[ 하드웨어 성능 카운터 사용 불가: %s (perf_event_paranoid: %d), 카운터 없이 실행 ]\n", strerror(testSuit->perfCounterError), ReadPerfEventParanoid());
+	}
+	if (testSuit->options.heapProfilePath != NULL)
+	{
+		PrintTestSink(reporter->sink, "[ 힙 프로파일: %s (표본 간격: %lld bytes) ]\n", testSuit->options.heapProfilePath, testSuit->options.heapSampleBytes);
+	}
+	if (testSuit->options.testOrder != TestOrderDefined && testSuit->options.statePath != NULL)
+	{
+		PrintTestSink(reporter->sink, "[ 실행 순서: %s (상태 파일: %s) ]\n", GetTestOrderName(testSuit->options.testOrder), testSuit->options.statePath);
+	}
+	if (testSuit->options.forkServerBatch > 0 && testSuit->options.runBenchmarks == FALSE && testSuit->options.fuzzTarget == NULL)
+	{
+		PrintTestSink(reporter->sink, "[ 포크 서버: 작업자 프로세스 하나가 테스트 %d 개씩 실행 ]\n", testSuit->options.forkServerBatch);
+	}
+	if (testSuit->cache != NULL)
+	{
+		PrintTestSink(reporter->sink, "[ 결과 캐시: %s (이전 성공 결과 재사용: %d 개) ]\n", testSuit->options.cachePath, GetNumberOfCachedTests(testSuit));
+	}
+	PrintTestSink(reporter->sink, "--------------------------------\n");
+}
+
+/**
+ * @fn static void OnConsoleTestBegin(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+ * @brief (console) 실행할 테스트의 번호와 이름을 출력하는 함수
+ * quiet 모드이면 출력하지 않고 기억해 두었다가 첫 번째 실패 또는 비정상 종료 시 출력한다.
+ */
+static void OnConsoleTestBegin(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+{
+	if (testSuit->options.quiet == TRUE)
+	{
+		((TestReporterStatePtr)reporter->state)->hasPendingTest = TRUE;
+		return;
+	}
+
+	PrintConsoleTest(reporter, testSuit, testIndex);
+}
+
+/**
+ * @fn static void OnConsoleFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+ * @brief (console) 검사 매크로 함수의 실패 정보를 출력하는 함수
+ */
+static void OnConsoleFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+{
+	PrintPendingConsoleTest(reporter, testSuit, testIndex);
+	PrintTestSink(reporter->sink, "(FAIL) [%s] %s (file:%s, line:%d)\n", failure->macroName, failure->message, failure->fileName, failure->lineNumber);
+}
+
+/**
+ * @fn static void OnConsoleTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report)
+ * @brief (console) 벤치마크 측정 결과, 결과 캐시 재사용 여부와, 테스트가 비정상 종료되거나 제한 시간을 넘긴 경우 그 원인을 출력하는 함수
+ */
+static void OnConsoleTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report)
+{
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+	const TestBenchmarkResult *benchmark = &report->benchmark;
+	if (benchmark->repetitions > 0)
+	{
+		PrintPendingConsoleTest(reporter, testSuit, testIndex);
+		PrintTestSink(reporter->sink, "(BENCH) { (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s } %lld 회 x %d 번 측정, ns/op 최소: %.2f, 중앙값: %.2f, 평균: %.2f, 표준편차: %.2f, p99: %.2f", (testIndex + 1), test->testCase, test->testName, benchmark->iterations, benchmark->repetitions, benchmark->minimumNanoseconds, benchmark->medianNanoseconds, benchmark->meanNanoseconds, benchmark->stddevNanoseconds, benchmark->p99Nanoseconds);
+		if (benchmark->bytesPerIteration > 0)
+		{
+			PrintTestSink(reporter->sink, ", %.2f MB/s", benchmark->bytesPerSecond / (1024.0 * 1024.0));
+		}
+		if (benchmark->itemsPerIteration > 0)
+		{
+			PrintTestSink(reporter->sink, ", %.0f items/s", benchmark->itemsPerSecond);
+		}
+		if (benchmark->baselineStatus == TestBaselineNew)
+		{
+			PrintTestSink(reporter->sink, ", 기준 결과 기록 (tag: %s)", testSuit->options.baselineTag);
+		}
+		else if (benchmark->baselineStatus != TestBaselineNone)
+		{
+			PrintTestSink(reporter->sink, ", 기준 중앙값: %.2f 대비 %+.1f%% (p: %.4f, %s)", benchmark->baselineMedianNanoseconds, benchmark->changePercent, benchmark->pValue, GetBaselineStatusName(benchmark->baselineStatus));
+		}
+		PrintTestSink(reporter->sink, "\n");
+	}
+
+	if (report->cached == TRUE && testSuit->options.quiet == FALSE)
+	{
+		PrintTestSink(reporter->sink, "(CACHED) 코드와 데이터 파일의 지문이 같아 이전 성공 결과 재사용\n");
+	}
+
+	const TestPerfCounterResult *perfCounters = &report->perfCounters;
+	if (perfCounters->measured == TRUE)
+	{
+		// Benchmarks show the counters per iteration of the measured repetitions
+		double divisor = (benchmark->repetitions > 0) ? (double)benchmark->iterations * benchmark->repetitions : 1.0;
+
+		PrintPendingConsoleTest(reporter, testSuit, testIndex);
+		PrintTestSink(reporter->sink, "(PERF) { (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s }%s", (testIndex + 1), test->testCase, test->testName, (benchmark->repetitions > 0) ? " (iteration 당)" : "");
+		PrintPerfCounter(reporter->sink, " cycles", perfCounters->cycles, divisor);
+		PrintPerfCounter(reporter->sink, ", instructions", perfCounters->instructions, divisor);
+		if (perfCounters->cycles > 0 && perfCounters->instructions >= 0)
+		{
+			PrintTestSink(reporter->sink, ", IPC: %.2f", (double)perfCounters->instructions / (double)perfCounters->cycles);
+		}
+		PrintPerfCounter(reporter->sink, ", L1D miss", perfCounters->l1dMisses, divisor);
+		PrintPerfCounter(reporter->sink, ", LLC miss", perfCounters->llcMisses, divisor);
+		PrintPerfCounter(reporter->sink, ", branch miss", perfCounters->branchMisses, divisor);
+		PrintTestSink(reporter->sink, "\n");
+	}
+
+	if (report->result != TestCrash && report->result != TestTimeout)
+	{
+		((TestReporterStatePtr)reporter->state)->hasPendingTest = FALSE;
+		return;
+	}
+
+	PrintPendingConsoleTest(reporter, testSuit, testIndex);
+
+	if (report->result == TestTimeout)
+	{
+		PrintTestSink(reporter->sink, "(TIMEOUT) { (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s } 제한 시간 초과 (%.3f ms 실행, 제한: %d ms)\n", (testIndex + 1), test->testCase, test->testName, (double)report->elapsedNanoseconds / NANOSECONDS_PER_MILLISECOND, report->timeoutMilliseconds);
+	}
+	else if (report->signalNumber != 0)
+	{
+		PrintTestSink(reporter->sink, "(CRASH) { (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s } 비정상 종료 (signal:%d, %s)\n", (testIndex + 1), test->testCase, test->testName, report->signalNumber, strsignal(report->signalNumber));
+	}
+	else
+	{
+		PrintTestSink(reporter->sink, "(CRASH) { (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s } 비정상 종료 (exit:%d)\n", (testIndex + 1), test->testCase, test->testName, report->exitStatus);
+	}
+}
+
+/**
+ * @fn static void OnConsoleFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests)
+ * @brief (console) 성공/실패 테스트 수와 실행 시간 요약을 출력하는 함수
+ */
+static void OnConsoleFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests)
+{
+	if (testSuit->numberOfTests < 1)
+	{
+		PrintTestSink(reporter->sink, "\n[ 테스트가 존재하지 않음. ]\n\n");
+		return;
+	}
+	if (testSuit->numberOfSelectedTests < 1)
+	{
+		PrintTestSink(reporter->sink, "\n[ 필터와 일치하는 테스트가 존재하지 않음. ]\n\n");
+		return;
+	}
+
+	PrintTestSink(reporter->sink, "\n--------------------------------\n");
+	PrintTestSink(reporter->sink, "[ 총 성공 테스트 수: %d 개 / 실패 테스트 수: %d 개 ]\n", numberOfCurTests - testSuit->numberOfFailTests, testSuit->numberOfFailTests);
+	if (testSuit->numberOfRegressions > 0)
+	{
+		PrintTestSink(reporter->sink, "[ 성능 저하 벤치마크 수: %d 개 (기준 결과: %s, tag: %s) ]\n", testSuit->numberOfRegressions, testSuit->options.baselinePath, testSuit->options.baselineTag);
+	}
+	if (GetNumberOfCachedTests(testSuit) > 0)
+	{
+		PrintTestSink(reporter->sink, "[ 실행하지 않고 결과를 재사용한 테스트 수: %d 개 ]\n", GetNumberOfCachedTests(testSuit));
+	}
+	PrintTestSink(reporter->sink, "--------------------------------\n");
+
+	PrintTestTimes(reporter->sink, testSuit);
+}
+
+/**
+ * @fn static void PrintConsoleTest(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+ * @brief (console) 테스트의 번호와 이름을 출력하는 함수
+ */
+static void PrintConsoleTest(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+{
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+	PrintTestSink(reporter->sink, "\n{ (테스트 번호: %d) 테스트 케이스: %s, 테스트 이름: %s }\n", (testIndex + 1), test->testCase, test->testName);
+}
+
+/**
+ * @fn static void PrintPendingConsoleTest(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+ * @brief (console) quiet 모드에서 출력을 미뤄 둔 테스트의 번호와 이름을 출력하는 함수(한 테스트에 한 번만 출력)
+ */
+static void PrintPendingConsoleTest(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+{
+	TestReporterStatePtr state = (TestReporterStatePtr)reporter->state;
+	if (state->hasPendingTest == TRUE)
+	{
+		state->hasPendingTest = FALSE;
+		PrintConsoleTest(reporter, testSuit, testIndex);
+	}
+}
+
+/**
+ * @fn static void PrintPerfCounter(TestSinkPtr sink, const char *name, long long value, double divisor)
+ * @brief (console) 하드웨어 성능 카운터 값 하나를 출력하는 함수(사용할 수 없는 카운터는 "-" 로 출력)
+ * @param sink 출력 대상(입력)
+ * @param name 카운터 이름(앞에 붙일 구분자 포함, 입력)
+ * @param value 카운터 값(입력)
+ * @param divisor 값을 나눌 수(1 보다 크면 소수점 두 자리로 출력, 입력)
+ * @return 반환값 없음
+ */
+static void PrintPerfCounter(TestSinkPtr sink, const char *name, long long value, double divisor)
+{
+	if (value < 0)
+	{
+		PrintTestSink(sink, "%s: -", name);
+	}
+	else if (divisor > 1.0)
+	{
+		PrintTestSink(sink, "%s: %.2f", name, (double)value / divisor);
+	}
+	else
+	{
+		PrintTestSink(sink, "%s: %lld", name, value);
+	}
+}
+
+/**
+ * @fn static void PrintTestTimes(TestSinkPtr sink, TestSuitPtr testSuit)
+ * @brief 실행 결과 요약 뒤에 전체 실행 시간, 가장 느린 테스트들, 테스트 케이스별 실행 시간을 출력하는 함수
+ * 테스트와 테스트 케이스는 각각 실행 옵션의 numberOfSlowestTests 개까지만 출력한다.
+ * @param sink 출력 대상(입력, 출력)
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 반환값 없음
+ */
+static void PrintTestTimes(TestSinkPtr sink, TestSuitPtr testSuit)
+{
+	PrintTestSink(sink, "[ 전체 실행 시간: %.3f ms / 테스트 CPU 시간 합계: %.3f ms ]\n", (double)testSuit->elapsedNanoseconds / NANOSECONDS_PER_MILLISECOND, (double)GetTestSuitCpuTime(testSuit) / NANOSECONDS_PER_MILLISECOND);
+
+	int numberOfSlowestTests = testSuit->options.numberOfSlowestTests;
+	if (numberOfSlowestTests <= 0)
+	{
+		PrintTestSink(sink, "--------------------------------\n");
+		return;
+	}
+
+	int *testIndexes = (int*)malloc(sizeof(int) * (size_t)numberOfSlowestTests);
+	if (testIndexes != NULL)
+	{
+		numberOfSlowestTests = GetSlowestTests(testSuit, testIndexes, numberOfSlowestTests);
+
+		PrintTestSink(sink, "[ 가장 느린 테스트 %d 개 ]\n", numberOfSlowestTests);
+		int rank = 0;
+		for (; rank < numberOfSlowestTests; rank++)
+		{
+			TestPtr test = testSuit->testPtrContainer[testIndexes[rank]];
+			TestReportPtr report = &testSuit->testReports[testIndexes[rank]];
+			PrintTestSink(sink, "  %d. %.3f ms (cpu: %.3f ms, cycles: %llu) %s.%s\n", (rank + 1), (double)report->elapsedNanoseconds / NANOSECONDS_PER_MILLISECOND, (double)report->cpuNanoseconds / NANOSECONDS_PER_MILLISECOND, report->cycles, test->testCase, test->testName);
+		}
+		free(testIndexes);
+	}
+
+	int numberOfTestCases = GetTestCaseTimes(testSuit, NULL, 0);
+	if (numberOfTestCases > 0)
+	{
+		TestCaseTimePtr testCaseTimes = (TestCaseTimePtr)malloc(sizeof(TestCaseTime) * (size_t)numberOfTestCases);
+		if (testCaseTimes != NULL)
+		{
+			GetTestCaseTimes(testSuit, testCaseTimes, numberOfTestCases);
+
+			// Print as many test cases as the slowest tests to keep the summary short
+			int numberOfPrintedCases = (numberOfTestCases < testSuit->options.numberOfSlowestTests) ? numberOfTestCases : testSuit->options.numberOfSlowestTests;
+			PrintTestSink(sink, "[ 테스트 케이스별 실행 시간 (상위 %d 개 / 전체 %d 개) ]\n", numberOfPrintedCases, numberOfTestCases);
+			int caseIndex = 0;
+			for (; caseIndex < numberOfPrintedCases; caseIndex++)
+			{
+				PrintTestSink(sink, "  %s: %d 개, %.3f ms (cpu: %.3f ms)\n", testCaseTimes[caseIndex].testCase, testCaseTimes[caseIndex].numberOfTests, (double)testCaseTimes[caseIndex].elapsedNanoseconds / NANOSECONDS_PER_MILLISECOND, (double)testCaseTimes[caseIndex].cpuNanoseconds / NANOSECONDS_PER_MILLISECOND);
+			}
+			free(testCaseTimes);
+		}
+	}
+	PrintTestSink(sink, "--------------------------------\n");
+}
+
+/**
+ * @fn static void OnJsonStart(TestReporterPtr reporter, TestSuitPtr testSuit)
+ * @brief (json) {"event":"start"} 줄을 출력하는 함수
+ */
+static void OnJsonStart(TestReporterPtr reporter, TestSuitPtr testSuit)
+{
+	PrintTestSink(reporter->sink, "{\"event\":\"start\",\"tests\":%d,\"selected\":%d,\"shard_index\":%d,\"total_shards\":%d", testSuit->numberOfTests, testSuit->numberOfSelectedTests, testSuit->options.shardIndex, testSuit->options.totalShards);
+	if (testSuit->options.perfCounters == TRUE)
+	{
+		PrintTestSink(reporter->sink, ",\"perf_counters\":\"%s\"", (testSuit->perfCounterError == 0) ? "enabled" : "unavailable");
+	}
+	PrintTestSink(reporter->sink, "}\n");
+}
+
+/**
+ * @fn static void OnJsonTestBegin(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+ * @brief (json) {"event":"test_begin"} 줄을 출력하는 함수
+ */
+static void OnJsonTestBegin(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex)
+{
+	TestTextBufferPtr line = &((TestReporterStatePtr)reporter->state)->line;
+
+	AppendJsonTest(line, "test_begin", testSuit, testIndex);
+	AppendText(line, "}\n");
+	WriteText(reporter, line);
+}
+
+/**
+ * @fn static void OnJsonFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+ * @brief (json) {"event":"failure"} 줄을 출력하는 함수
+ */
+static void OnJsonFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+{
+	TestTextBufferPtr line = &((TestReporterStatePtr)reporter->state)->line;
+
+	AppendJsonTest(line, "failure", testSuit, testIndex);
+	AppendText(line, ",\"macro\":\"");
+	AppendEscapedText(line, failure->macroName, TestEscapeJson);
+	AppendText(line, "\",\"file\":\"");
+	AppendEscapedText(line, failure->fileName, TestEscapeJson);
+	AppendText(line, "\",\"line\":%d,\"message\":\"", failure->lineNumber);
+	AppendEscapedText(line, failure->message, TestEscapeJson);
+	AppendText(line, "\"}\n");
+	WriteText(reporter, line);
+}
+
+/**
+ * @fn static void OnJsonTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report)
+ * @brief (json) {"event":"test_end"} 줄을 출력하는 함수
+ */
+static void OnJsonTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report)
+{
+	TestTextBufferPtr line = &((TestReporterStatePtr)reporter->state)->line;
+
+	AppendJsonTest(line, "test_end", testSuit, testIndex);
+	AppendText(line, ",\"result\":\"%s\",\"elapsed_ns\":%lld,\"cpu_ns\":%lld,\"cycles\":%llu", GetResultName(report->result), report->elapsedNanoseconds, report->cpuNanoseconds, report->cycles);
+	if (report->result == TestCrash)
+	{
+		AppendText(line, ",\"signal\":%d,\"exit_status\":%d", report->signalNumber, report->exitStatus);
+	}
+	if (report->timeoutMilliseconds > 0)
+	{
+		AppendText(line, ",\"timeout_ms\":%d", report->timeoutMilliseconds);
+	}
+	if (report->cached == TRUE)
+	{
+		AppendText(line, ",\"cached\":true");
+	}
+	if (report->benchmark.repetitions > 0)
+	{
+		const TestBenchmarkResult *benchmark = &report->benchmark;
+		AppendText(line, ",\"benchmark\":{\"iterations\":%lld,\"repetitions\":%d,\"min_ns\":%.3f,\"median_ns\":%.3f,\"mean_ns\":%.3f,\"stddev_ns\":%.3f,\"p99_ns\":%.3f,\"bytes_per_second\":%.3f,\"items_per_second\":%.3f", benchmark->iterations, benchmark->repetitions, benchmark->minimumNanoseconds, benchmark->medianNanoseconds, benchmark->meanNanoseconds, benchmark->stddevNanoseconds, benchmark->p99Nanoseconds, benchmark->bytesPerSecond, benchmark->itemsPerSecond);
+		if (benchmark->baselineStatus != TestBaselineNone)
+		{
+			AppendText(line, ",\"baseline\":{\"status\":\"%s\",\"median_ns\":%.3f,\"change_percent\":%.3f,\"p_value\":%.6f}", GetBaselineStatusName(benchmark->baselineStatus), benchmark->baselineMedianNanoseconds, benchmark->changePercent, benchmark->pValue);
+		}
+		AppendText(line, "}");
+	}
+	if (report->allocations.tracked == TRUE)
+	{
+		const TestAllocationResult *allocations = &report->allocations;
+		AppendText(line, ",\"allocations\":{\"count\":%lld,\"frees\":%lld,\"bytes\":%lld,\"peak_bytes\":%lld,\"leaked_blocks\":%lld,\"leaked_bytes\":%lld}", allocations->allocations, allocations->frees, allocations->bytes, allocations->peakBytes, allocations->leakedBlocks, allocations->leakedBytes);
+	}
+	if (report->perfCounters.measured == TRUE)
+	{
+		const TestPerfCounterResult *perfCounters = &report->perfCounters;
+		char values[TEST_NUMBER_OF_PERF_COUNTERS][32];
+		AppendText(line, ",\"perf\":{\"cycles\":%s,\"instructions\":%s,\"l1d_misses\":%s,\"llc_misses\":%s,\"branch_misses\":%s}", FormatJsonPerfCounter(values[0], sizeof(values[0]), perfCounters->cycles), FormatJsonPerfCounter(values[1], sizeof(values[1]), perfCounters->instructions), FormatJsonPerfCounter(values[2], sizeof(values[2]), perfCounters->l1dMisses), FormatJsonPerfCounter(values[3], sizeof(values[3]), perfCounters->llcMisses), FormatJsonPerfCounter(values[4], sizeof(values[4]), perfCounters->branchMisses));
+	}
+	AppendText(line, "}\n");
+	WriteText(reporter, line);
+}
+
+/**
+ * @fn static void OnJsonFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests)
+ * @brief (json) {"event":"finish"} 줄을 출력하는 함수
+ */
+static void OnJsonFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests)
+{
+	PrintTestSink(reporter->sink, "{\"event\":\"finish\",\"run\":%d,\"passed\":%d,\"failed\":%d,\"regressions\":%d,\"elapsed_ns\":%lld,\"cpu_ns\":%lld}\n", numberOfCurTests, numberOfCurTests - testSuit->numberOfFailTests, testSuit->numberOfFailTests, testSuit->numberOfRegressions, testSuit->elapsedNanoseconds, GetTestSuitCpuTime(testSuit));
+}
+
+/**
+ * @fn static void AppendJsonTest(TestTextBufferPtr buffer, const char *event, TestSuitPtr testSuit, int testIndex)
+ * @brief (json) 테스트 이벤트 줄의 공통 필드(event, number, case, name)를 버퍼에 추가하는 함수(닫는 괄호는 붙이지 않는다)
+ */
+static void AppendJsonTest(TestTextBufferPtr buffer, const char *event, TestSuitPtr testSuit, int testIndex)
+{
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+
+	AppendText(buffer, "{\"event\":\"%s\",\"number\":%d,\"case\":\"", event, (testIndex + 1));
+	AppendEscapedText(buffer, test->testCase, TestEscapeJson);
+	AppendText(buffer, "\",\"name\":\"");
+	AppendEscapedText(buffer, test->testName, TestEscapeJson);
+	AppendText(buffer, "\"");
+}
+
+/**
+ * @fn static const char *FormatJsonPerfCounter(char *text, size_t size, long long value)
+ * @brief (json) 하드웨어 성능 카운터 값을 JSON 값 문자열로 변환하는 함수(사용할 수 없는 카운터는 null)
+ * @param text 변환한 문자열을 저장할 버퍼(출력)
+ * @param size 버퍼 크기(입력)
+ * @param value 카운터 값(입력)
+ * @return 변환한 문자열(text) 반환
+ */
+static const char *FormatJsonPerfCounter(char *text, size_t size, long long value)
+{
+	if (value < 0)
+	{
+		snprintf(text, size, "null");
+	}
+	else
+	{
+		snprintf(text, size, "%lld", value);
+	}
+
+	return text;
+}
+
+/**
+ * @fn static void OnJUnitStart(TestReporterPtr reporter, TestSuitPtr testSuit)
+ * @brief (junit) XML 선언과 testsuites, testsuite 시작 태그를 출력하는 함수
+ * 결과를 스트리밍하기 위해 개수 속성은 생략하며, JUnit XML 을 읽는 도구는 testcase 요소로 개수를 계산한다.
+ */
+static void OnJUnitStart(TestReporterPtr reporter, TestSuitPtr testSuit)
+{
+	(void)testSuit;
+	PrintTestSink(reporter->sink, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites name=\"ttlib\">\n  <testsuite name=\"ttlib\">\n");
+}
+
+/**
+ * @fn static void OnJUnitFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+ * @brief (junit) 실패 정보를 failure 요소로 만들어 testcase 요소가 출력될 때까지 모아 두는 함수
+ * testcase 요소의 time 속성은 테스트가 끝나야 알 수 있기 때문이다.
+ */
+static void OnJUnitFailure(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestFailure *failure)
+{
+	(void)testSuit;
+	(void)testIndex;
+	TestTextBufferPtr pending = &((TestReporterStatePtr)reporter->state)->pending;
+
+	AppendText(pending, "      <failure type=\"");
+	AppendEscapedText(pending, failure->macroName, TestEscapeXml);
+	AppendText(pending, "\" message=\"");
+	AppendEscapedText(pending, failure->message, TestEscapeXml);
+	AppendText(pending, "\">");
+	AppendEscapedText(pending, failure->fileName, TestEscapeXml);
+	AppendText(pending, ":%d</failure>\n", failure->lineNumber);
+}
+
+/**
+ * @fn static void OnJUnitTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report)
+ * @brief (junit) testcase 요소와 모아 둔 failure 요소(비정상 종료 시 error 요소)를 출력하는 함수
+ */
+static void OnJUnitTestEnd(TestReporterPtr reporter, TestSuitPtr testSuit, int testIndex, const TestReport *report)
+{
+	TestReporterStatePtr state = (TestReporterStatePtr)reporter->state;
+	TestPtr test = testSuit->testPtrContainer[testIndex];
+
+	AppendText(&state->line, "    <testcase classname=\"");
+	AppendEscapedText(&state->line, test->testCase, TestEscapeXml);
+	AppendText(&state->line, "\" name=\"");
+	AppendEscapedText(&state->line, test->testName, TestEscapeXml);
+	AppendText(&state->line, "\" time=\"%.6f\"", (double)report->elapsedNanoseconds / 1000000000.0);
+
+	if (state->pending.length == 0 && report->result != TestCrash && report->result != TestTimeout && report->benchmark.repetitions == 0 && report->perfCounters.measured == FALSE)
+	{
+		AppendText(&state->line, "/>\n");
+		WriteText(reporter, &state->line);
+		return;
+	}
+
+	AppendText(&state->line, ">\n");
+	if (report->perfCounters.measured == TRUE)
+	{
+		const TestPerfCounterResult *perfCounters = &report->perfCounters;
+		const char *names[TEST_NUMBER_OF_PERF_COUNTERS] = { "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses" };
+		long long values[TEST_NUMBER_OF_PERF_COUNTERS] = { perfCounters->cycles, perfCounters->instructions, perfCounters->l1dMisses, perfCounters->llcMisses, perfCounters->branchMisses };
+
+		AppendText(&state->line, "      <properties>\n");
+		int counterIndex = 0;
+		for (; counterIndex < TEST_NUMBER_OF_PERF_COUNTERS; counterIndex++)
+		{
+			if (values[counterIndex] >= 0)
+			{
+				AppendText(&state->line, "        <property name=\"%s\" value=\"%lld\"/>\n", names[counterIndex], values[counterIndex]);
+			}
+		}
+		AppendText(&state->line, "      </properties>\n");
+	}
+	WriteText(reporter, &state->line);
+	WriteText(reporter, &state->pending);
+
+	if (report->result == TestTimeout)
+	{
+		AppendText(&state->line, "      <error type=\"timeout\" message=\"exceeded %d ms\"/>\n", report->timeoutMilliseconds);
+	}
+	else if (report->result == TestCrash)
+	{
+		if (report->signalNumber != 0)
+		{
+			AppendText(&state->line, "      <error type=\"crash\" message=\"signal %d (", report->signalNumber);
+			AppendEscapedText(&state->line, strsignal(report->signalNumber), TestEscapeXml);
+			AppendText(&state->line, ")\"/>\n");
+		}
+		else
+		{
+			AppendText(&state->line, "      <error type=\"crash\" message=\"exit %d\"/>\n", report->exitStatus);
+		}
+	}
+	if (report->benchmark.repetitions > 0)
+	{
+		const TestBenchmarkResult *benchmark = &report->benchmark;
+		AppendText(&state->line, "      <system-out>iterations=%lld repetitions=%d min_ns=%.3f median_ns=%.3f mean_ns=%.3f stddev_ns=%.3f p99_ns=%.3f bytes_per_second=%.3f items_per_second=%.3f", benchmark->iterations, benchmark->repetitions, benchmark->minimumNanoseconds, benchmark->medianNanoseconds, benchmark->meanNanoseconds, benchmark->stddevNanoseconds, benchmark->p99Nanoseconds, benchmark->bytesPerSecond, benchmark->itemsPerSecond);
+		if (benchmark->baselineStatus != TestBaselineNone)
+		{
+			AppendText(&state->line, " baseline_status=%s baseline_median_ns=%.3f change_percent=%.3f p_value=%.6f", GetBaselineStatusName(benchmark->baselineStatus), benchmark->baselineMedianNanoseconds, benchmark->changePercent, benchmark->pValue);
+		}
+		AppendText(&state->line, "</system-out>\n");
+	}
+	AppendText(&state->line, "    </testcase>\n");
+	WriteText(reporter, &state->line);
+}
+
+/**
+ * @fn static void OnJUnitFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests)
+ * @brief (junit) testsuite, testsuites 종료 태그를 출력하는 함수
+ */
+static void OnJUnitFinish(TestReporterPtr reporter, TestSuitPtr testSuit, int numberOfCurTests)
+{
+	(void)testSuit;
+	(void)numberOfCurTests;
+	PrintTestSink(reporter->sink, "  </testsuite>\n</testsuites>\n");
+}
+
@@ -0,0 +1,402 @@
+#include "ttlib_internal.h"
+
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 실행 시간 기록이 하나도 없을 때 테스트 하나에 가정하는 실행 시간(나노초)
+#define TEST_DEFAULT_DURATION 1000000LL
+
+// 실행 시간 기록 파일의 첫 줄
+#define TEST_TIMINGS_HEADER "# ttlib timings: elapsed_ns testCase.testName\n"
+
+// 샤드 분배에 사용하는 테스트 하나의 정보
+typedef struct _test_shard_item_t
+{
+	// 테스트 번호
+	int testIndex;
+	// 예상 실행 시간(나노초)
+	long long duration;
+} TestShardItem, *TestShardItemPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static long long *LoadTestDurations(TestSuitPtr testSuit, const char *path);
+static int ParseTimingLine(TestSuitPtr testSuit, char *line, long long *duration);
+static int AssignShardsByDuration(TestSuitPtr testSuit, const long long *durations);
+static int AssignShardsByPosition(TestSuitPtr testSuit);
+static int CompareShardItems(const void *left, const void *right);
+static int CompareTestIndexes(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int ShardTests(TestSuitPtr testSuit)
+ * @brief 선택된 테스트들을 전체 샤드 개수만큼 나누고 현재 샤드에 배정된 테스트만 selectedTests 에 남기는 함수
+ * 실행 시간 기록 파일이 없으면 실행 순서대로 샤드를 번갈아 배정하고(position % totalShards),
+ * 있으면 기록된 실행 시간이 긴 테스트부터 누적 실행 시간이 가장 짧은 샤드에 배정한다(LPT).
+ * 같은 실행 파일, 필터, 기록 파일이면 모든 샤드가 같은 분배 결과를 계산하므로 샤드 간에 테스트가 겹치거나 빠지지 않는다.
+ * 배정된 테스트는 테스트 번호(정의 순서) 순서로 실행된다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 성공 시 현재 샤드에 배정된 테스트 개수, 실패 시 -1 반환
+ */
+int ShardTests(TestSuitPtr testSuit)
+{
+	int totalShards = testSuit->options.totalShards;
+	int shardIndex = testSuit->options.shardIndex;
+
+	if (totalShards <= 1)
+	{
+		return testSuit->numberOfSelectedTests;
+	}
+	if (shardIndex < 0 || shardIndex >= totalShards)
+	{
+		return -1;
+	}
+
+	long long *durations = NULL;
+	if (testSuit->options.timingsPath != NULL)
+	{
+		durations = LoadTestDurations(testSuit, testSuit->options.timingsPath);
+	}
+
+	int numberOfShardTests = (durations != NULL) ? AssignShardsByDuration(testSuit, durations) : AssignShardsByPosition(testSuit);
+	free(durations);
+
+	return numberOfShardTests;
+}
+
+/**
+ * @fn int SaveTestTimings(TestSuitPtr testSuit)
+ * @brief 실행된 테스트들의 실행 시간을 실행 시간 기록 파일에 반영하는 함수
+ * 이번에 실행되지 않은 테스트(다른 샤드, 다른 실행 파일의 테스트 포함)의 기록은 그대로 유지하고,
+ * 이미 기록이 있는 테스트는 이전 값과 이번 값의 평균을 기록하여 한 번의 튀는 측정값에 덜 민감하게 한다.
+ * 결과 캐시에서 결과를 재사용한 테스트는 실행하지 않았으므로 이전 기록을 유지한다.
+ * 임시 파일에 기록한 뒤 rename 하므로 기록 중에 다른 샤드가 읽어도 깨진 파일을 보지 않는다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int SaveTestTimings(TestSuitPtr testSuit)
+{
+	const char *path = testSuit->options.timingsPath;
+	if (path == NULL || testSuit->testReports == NULL)
+	{
+		return 0;
+	}
+
+	size_t pathLength = strlen(path);
+	char *temporaryPath = (char*)malloc(pathLength + 32);
+	if (temporaryPath == NULL)
+	{
+		return -1;
+	}
+	snprintf(temporaryPath, pathLength + 32, "%s.%ld.tmp", path, (long)getpid());
+
+	FILE *output = fopen(temporaryPath, "w");
+	if (output == NULL)
+	{
+		free(temporaryPath);
+		return -1;
+	}
+	fputs(TEST_TIMINGS_HEADER, output);
+
+	long long *durations = (long long*)malloc(sizeof(long long) * (size_t)((testSuit->numberOfTests > 0) ? testSuit->numberOfTests : 1));
+	if (durations != NULL)
+	{
+		int testIndex = 0;
+		for (; testIndex < testSuit->numberOfTests; testIndex++)
+		{
+			durations[testIndex] = -1;
+		}
+	}
+
+	// Keep the records of tests which did not run this time
+	FILE *input = fopen(path, "r");
+	if (input != NULL)
+	{
+		char *line = NULL;
+		size_t lineCapacity = 0;
+		while (getline(&line, &lineCapacity, input) > 0)
+		{
+			if (line[0] == '#')
+			{
+				continue;
+			}
+
+			char *record = strdup(line);
+			if (record == NULL)
+			{
+				continue;
+			}
+
+			long long duration = 0;
+			int testIndex = ParseTimingLine(testSuit, line, &duration);
+			if (testIndex < 0 || testSuit->testReports[testIndex].result == TestNotRun || testSuit->testReports[testIndex].cached == TRUE)
+			{
+				fputs(record, output);
+				if (record[strlen(record) - 1] != '\n')
+				{
+					fputc('\n', output);
+				}
+			}
+			else if (durations != NULL)
+			{
+				durations[testIndex] = duration;
+			}
+			free(record);
+		}
+		free(line);
+		fclose(input);
+	}
+
+	// Append the tests of this run
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		TestReportPtr report = &testSuit->testReports[testIndex];
+		if (report->result == TestNotRun || report->cached == TRUE)
+		{
+			continue;
+		}
+
+		long long duration = report->elapsedNanoseconds;
+		if (durations != NULL && durations[testIndex] >= 0)
+		{
+			duration = (duration + durations[testIndex]) / 2;
+		}
+
+		TestPtr test = testSuit->testPtrContainer[testIndex];
+		fprintf(output, "%lld %s.%s\n", duration, test->testCase, test->testName);
+	}
+	free(durations);
+
+	int result = (fclose(output) == 0 && rename(temporaryPath, path) == 0) ? 0 : -1;
+	if (result != 0)
+	{
+		unlink(temporaryPath);
+	}
+	free(temporaryPath);
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static long long *LoadTestDurations(TestSuitPtr testSuit, const char *path)
+ * @brief 실행 시간 기록 파일을 읽어 테스트 번호별 실행 시간 리스트를 만드는 함수
+ * 기록 파일 형식 : 한 줄에 "실행시간(나노초) testCase.testName", '#' 으로 시작하는 줄은 무시한다.
+ * 같은 테스트가 여러 번 기록되어 있으면 마지막 기록을 사용하므로 샤드별 기록 파일을 이어 붙여 사용할 수 있다.
+ * 테스트 이름은 FindTest 함수(해시 인덱스)로 찾는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param path 실행 시간 기록 파일 경로(입력)
+ * @return 성공 시 테스트 번호별 실행 시간 리스트(기록이 없는 테스트는 -1), 파일이 없거나 실패 시 NULL 반환
+ */
+static long long *LoadTestDurations(TestSuitPtr testSuit, const char *path)
+{
+	FILE *input = fopen(path, "r");
+	if (input == NULL)
+	{
+		return NULL;
+	}
+
+	long long *durations = (long long*)malloc(sizeof(long long) * (size_t)((testSuit->numberOfTests > 0) ? testSuit->numberOfTests : 1));
+	if (durations == NULL)
+	{
+		fclose(input);
+		return NULL;
+	}
+
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		durations[testIndex] = -1;
+	}
+
+	char *line = NULL;
+	size_t lineCapacity = 0;
+	while (getline(&line, &lineCapacity, input) > 0)
+	{
+		long long duration = 0;
+		testIndex = ParseTimingLine(testSuit, line, &duration);
+		if (testIndex >= 0)
+		{
+			durations[testIndex] = duration;
+		}
+	}
+	free(line);
+	fclose(input);
+
+	return durations;
+}
+
+/**
+ * @fn static int ParseTimingLine(TestSuitPtr testSuit, char *line, long long *duration)
+ * @brief 실행 시간 기록 파일의 한 줄을 해석하여 테스트 번호와 실행 시간을 얻는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param line 해석할 줄(입력, 해석 중에 변경된다)
+ * @param duration 실행 시간을 저장할 변수(출력)
+ * @return 성공 시 테스트 번호, 현재 실행 파일에 없는 테스트이거나 잘못된 줄이면 -1 반환
+ */
+static int ParseTimingLine(TestSuitPtr testSuit, char *line, long long *duration)
+{
+	if (line[0] == '#')
+	{
+		return -1;
+	}
+
+	char *end = NULL;
+	*duration = strtoll(line, &end, 10);
+	if (end == line || *end != ' ' || *duration < 0)
+	{
+		return -1;
+	}
+
+	char *testCase = end + 1;
+	char *testName = strchr(testCase, '.');
+	if (testName == NULL)
+	{
+		return -1;
+	}
+	*testName++ = '\0';
+	testName[strcspn(testName, "\r\n")] = '\0';
+
+	return FindTest(testSuit, testCase, testName);
+}
+
+/**
+ * @fn static int AssignShardsByDuration(TestSuitPtr testSuit, const long long *durations)
+ * @brief 기록된 실행 시간이 긴 테스트부터 누적 실행 시간이 가장 짧은 샤드에 배정하는 함수(LPT)
+ * 기록이 없는 테스트는 기록된 테스트들의 평균 실행 시간으로 가정한다.
+ * 실행 시간이 같으면 테스트 번호 순서로, 누적 실행 시간이 같으면 샤드 번호 순서로 정하므로 결과가 항상 같다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param durations 테스트 번호별 실행 시간 리스트(입력)
+ * @return 성공 시 현재 샤드에 배정된 테스트 개수, 실패 시 -1 반환
+ */
+static int AssignShardsByDuration(TestSuitPtr testSuit, const long long *durations)
+{
+	int totalShards = testSuit->options.totalShards;
+	int numberOfTests = testSuit->numberOfSelectedTests;
+
+	TestShardItemPtr items = (TestShardItemPtr)malloc(sizeof(TestShardItem) * (size_t)((numberOfTests > 0) ? numberOfTests : 1));
+	long long *loads = (long long*)calloc((size_t)totalShards, sizeof(long long));
+	if (items == NULL || loads == NULL)
+	{
+		free(items);
+		free(loads);
+		return -1;
+	}
+
+	// Tests without a record are assumed to take the average recorded time
+	long long totalDuration = 0;
+	int numberOfRecorded = 0;
+	int position = 0;
+	for (; position < numberOfTests; position++)
+	{
+		long long duration = durations[testSuit->selectedTests[position]];
+		if (duration >= 0)
+		{
+			totalDuration += duration;
+			numberOfRecorded++;
+		}
+	}
+	long long defaultDuration = (numberOfRecorded > 0) ? totalDuration / numberOfRecorded : TEST_DEFAULT_DURATION;
+
+	for (position = 0; position < numberOfTests; position++)
+	{
+		int testIndex = testSuit->selectedTests[position];
+		items[position].testIndex = testIndex;
+		items[position].duration = (durations[testIndex] >= 0) ? durations[testIndex] : defaultDuration;
+	}
+	qsort(items, (size_t)numberOfTests, sizeof(TestShardItem), CompareShardItems);
+
+	int numberOfShardTests = 0;
+	for (position = 0; position < numberOfTests; position++)
+	{
+		int lightestShard = 0;
+		int shard = 1;
+		for (; shard < totalShards; shard++)
+		{
+			if (loads[shard] < loads[lightestShard])
+			{
+				lightestShard = shard;
+			}
+		}
+
+		loads[lightestShard] += items[position].duration;
+		if (lightestShard == testSuit->options.shardIndex)
+		{
+			testSuit->selectedTests[numberOfShardTests++] = items[position].testIndex;
+		}
+	}
+
+	qsort(testSuit->selectedTests, (size_t)numberOfShardTests, sizeof(int), CompareTestIndexes);
+	testSuit->numberOfSelectedTests = numberOfShardTests;
+
+	free(items);
+	free(loads);
+
+	return numberOfShardTests;
+}
+
+/**
+ * @fn static int AssignShardsByPosition(TestSuitPtr testSuit)
+ * @brief 실행 순서대로 샤드를 번갈아 배정하는 함수(position % totalShards == shardIndex 인 테스트만 남긴다)
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @return 현재 샤드에 배정된 테스트 개수 반환
+ */
+static int AssignShardsByPosition(TestSuitPtr testSuit)
+{
+	int numberOfShardTests = 0;
+	int position = testSuit->options.shardIndex;
+	for (; position < testSuit->numberOfSelectedTests; position += testSuit->options.totalShards)
+	{
+		testSuit->selectedTests[numberOfShardTests++] = testSuit->selectedTests[position];
+	}
+	testSuit->numberOfSelectedTests = numberOfShardTests;
+
+	return numberOfShardTests;
+}
+
+/**
+ * @fn static int CompareShardItems(const void *left, const void *right)
+ * @brief 샤드 분배 정보를 실행 시간 내림차순(같으면 테스트 번호 오름차순)으로 정렬하기 위한 비교 함수
+ * @param left 비교할 샤드 분배 정보(입력)
+ * @param right 비교할 샤드 분배 정보(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareShardItems(const void *left, const void *right)
+{
+	const TestShardItem *leftItem = (const TestShardItem*)left;
+	const TestShardItem *rightItem = (const TestShardItem*)right;
+
+	if (leftItem->duration != rightItem->duration)
+	{
+		return (leftItem->duration > rightItem->duration) ? -1 : 1;
+	}
+
+	return leftItem->testIndex - rightItem->testIndex;
+}
+
+/**
+ * @fn static int CompareTestIndexes(const void *left, const void *right)
+ * @brief 테스트 번호를 오름차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 테스트 번호(입력)
+ * @param right 비교할 테스트 번호(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareTestIndexes(const void *left, const void *right)
+{
+	return *(const int*)left - *(const int*)right;
+}
+
@@ -0,0 +1,623 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// PrintTestSink 함수가 포맷팅에 먼저 사용하는 스택 버퍼 크기(기록 스레드가 있는 경우)
+#define TEST_SINK_FORMAT_SIZE 1024
+// 기록 스레드가 데이터를 모으는 최대 시간(밀리초, 터미널에서도 출력이 늦어 보이지 않을 정도)
+#define TEST_SINK_WRITE_INTERVAL_MS 20
+// 기록 스레드를 바로 깨우는 링 버퍼 사용량(버퍼 크기에 대한 비율의 역수)
+#define TEST_SINK_WRITE_THRESHOLD_DIVISOR 4
+
+// 출력 버퍼(링 버퍼)를 비우는 백그라운드 기록 스레드 정보
+// 리포터는 링 버퍼에 복사만 하고, 기록 스레드가 모인 만큼을 한 번의 write 로 기록하므로 테스트 실행이 출력 I/O 를 기다리지 않는다.
+typedef struct _test_sink_writer_t
+{
+	// 기록 스레드
+	pthread_t thread;
+	// 링 버퍼 위치를 보호하는 뮤텍스
+	pthread_mutex_t mutex;
+	// 기록할 데이터가 생겼거나 종료가 요청되었음을 알리는 조건 변수
+	pthread_cond_t dataReady;
+	// 링 버퍼의 데이터가 기록되어 공간이 생겼음을 알리는 조건 변수
+	pthread_cond_t spaceReady;
+	// 지금까지 기록된 누적 바이트 수(링 버퍼의 읽기 위치)
+	size_t readPosition;
+	// 지금까지 추가된 누적 바이트 수(링 버퍼의 쓰기 위치)
+	size_t writePosition;
+	// 링 버퍼가 빌 때까지 기다리는 FlushTestSink 호출 개수
+	int numberOfFlushWaiters;
+	// 종료 요청 여부
+	int closing;
+} TestSinkWriter, *TestSinkWriterPtr;
+
+// 테스트가 비정상 종료될 때 링 버퍼에 남은 출력을 기록하기 위해 처리하는 시그널 리스트
+static const int _fatalSignals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+#define NUMBER_OF_FATAL_SIGNALS ((int)(sizeof(_fatalSignals) / sizeof(_fatalSignals[0])))
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// 비정상 종료 시 남은 출력을 기록할 출력 대상과 그 출력 대상을 만든 프로세스 ID(fork 된 작업자 프로세스에서는 기록하지 않는다)
+static TestSinkPtr _fatalSink = NULL;
+static pid_t _fatalSinkPid = 0;
+// 시그널 처리 함수를 설치하기 전의 처리 방식
+static struct sigaction _previousActions[NUMBER_OF_FATAL_SIGNALS];
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static TestSinkWriterPtr StartSinkWriter(TestSinkPtr sink);
+static void StopSinkWriter(TestSinkPtr sink);
+static void *RunSinkWriter(void *arg);
+static void PushSinkWriter(TestSinkPtr sink, const char *data, size_t length);
+static void InstallFatalSignalHandlers(TestSinkPtr sink);
+static void UninstallFatalSignalHandlers(TestSinkPtr sink);
+static void HandleFatalSignal(int signalNumber);
+static int WriteAll(int fd, const char *data, size_t length);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestSinkPtr NewTestSink(const char *path)
+ * @brief 리포터 출력을 모아서 기록하는 버퍼 출력 대상(TestSink) 객체를 새로 생성하는 함수
+ * 출력 버퍼는 링 버퍼로 사용하며, 백그라운드 기록 스레드가 모인 데이터를 한 번의 write 로 기록한다.
+ * 기록 스레드를 생성할 수 없으면 버퍼가 가득 찰 때 직접 기록하고, 터미널에 출력하는 경우에는 리포터 이벤트마다 비우도록(autoFlush) 설정한다.
+ * @param path 출력 파일 경로(입력, NULL 또는 "-" 이면 표준 출력)
+ * @return 성공 시 새로 생성된 TestSink 객체, 실패 시 NULL 반환
+ */
+TestSinkPtr NewTestSink(const char *path)
+{
+	TestSinkPtr sink = (TestSinkPtr)malloc(sizeof(TestSink));
+	if (sink == NULL)
+	{
+		return NULL;
+	}
+
+	sink->buffer = (char*)malloc(TEST_SINK_BUFFER_SIZE);
+	if (sink->buffer == NULL)
+	{
+		free(sink);
+		return NULL;
+	}
+
+	if (path == NULL || strcmp(path, "-") == 0)
+	{
+		sink->fd = STDOUT_FILENO;
+		sink->ownsFd = FALSE;
+	}
+	else
+	{
+		sink->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (sink->fd < 0)
+		{
+			free(sink->buffer);
+			free(sink);
+			return NULL;
+		}
+		sink->ownsFd = TRUE;
+	}
+
+	sink->capacity = TEST_SINK_BUFFER_SIZE;
+	sink->length = 0;
+	sink->writer = NULL;
+	StartSinkWriter(sink);
+	sink->autoFlush = (sink->writer == NULL && isatty(sink->fd)) ? TRUE : FALSE;
+	if (sink->writer != NULL)
+	{
+		InstallFatalSignalHandlers(sink);
+	}
+
+	return sink;
+}
+
+/**
+ * @fn void DeleteTestSink(TestSinkPtrContainer sinkContainer)
+ * @brief 버퍼에 남은 내용을 기록하고 TestSink 객체를 삭제하는 함수
+ * @param sinkContainer TestSink 객체의 주소를 가지는 포인터(입력, 이중 포인터)
+ * @return 반환값 없음
+ */
+void DeleteTestSink(TestSinkPtrContainer sinkContainer)
+{
+	// Check parameter
+	if (sinkContainer == NULL || *sinkContainer == NULL)
+	{
+		return;
+	}
+
+	TestSinkPtr sink = *sinkContainer;
+
+	FlushTestSink(sink);
+	UninstallFatalSignalHandlers(sink);
+	StopSinkWriter(sink);
+	if (sink->ownsFd == TRUE)
+	{
+		close(sink->fd);
+	}
+	free(sink->buffer);
+	free(sink);
+
+	*sinkContainer = NULL;
+}
+
+/**
+ * @fn int WriteTestSink(TestSinkPtr sink, const char *data, size_t length)
+ * @brief 데이터를 TestSink 버퍼에 추가하는 함수
+ * 기록 스레드가 있으면 링 버퍼에 복사하고(공간이 없으면 기록될 때까지 기다린다), 없으면 버퍼가 가득 찰 때 한 번에 기록한다.
+ * @param sink 출력 대상(입력, 출력)
+ * @param data 기록할 데이터(입력)
+ * @param length 기록할 데이터 길이(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int WriteTestSink(TestSinkPtr sink, const char *data, size_t length)
+{
+	// Check parameter
+	if (sink == NULL || (data == NULL && length > 0))
+	{
+		return -1;
+	}
+
+	if (sink->writer != NULL)
+	{
+		PushSinkWriter(sink, data, length);
+		return 0;
+	}
+
+	if (sink->length + length > sink->capacity)
+	{
+		if (FlushTestSink(sink) != 0)
+		{
+			return -1;
+		}
+
+		// Data larger than the whole buffer is written directly
+		if (length > sink->capacity)
+		{
+			return WriteAll(sink->fd, data, length);
+		}
+	}
+
+	memcpy(sink->buffer + sink->length, data, length);
+	sink->length += length;
+
+	return 0;
+}
+
+/**
+ * @fn int PrintTestSink(TestSinkPtr sink, const char *format, ...)
+ * @brief printf 와 같은 방식으로 포맷팅한 문자열을 TestSink 버퍼에 추가하는 함수
+ * @param sink 출력 대상(입력, 출력)
+ * @param format 포맷 문자열(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int PrintTestSink(TestSinkPtr sink, const char *format, ...)
+{
+	// Check parameter
+	if (sink == NULL || format == NULL)
+	{
+		return -1;
+	}
+
+	va_list args;
+
+	// With a writer thread, format on the stack and copy into the ring buffer
+	if (sink->writer != NULL)
+	{
+		char stackMessage[TEST_SINK_FORMAT_SIZE];
+		va_start(args, format);
+		int stackLength = vsnprintf(stackMessage, sizeof(stackMessage), format, args);
+		va_end(args);
+		if (stackLength >= 0 && (size_t)stackLength < sizeof(stackMessage))
+		{
+			PushSinkWriter(sink, stackMessage, (size_t)stackLength);
+			return 0;
+		}
+	}
+	else
+	{
+		// Format directly into the buffer when it fits
+		va_start(args, format);
+		int bufferLength = vsnprintf(sink->buffer + sink->length, sink->capacity - sink->length, format, args);
+		va_end(args);
+		if (bufferLength < 0)
+		{
+			return -1;
+		}
+		if ((size_t)bufferLength < sink->capacity - sink->length)
+		{
+			sink->length += (size_t)bufferLength;
+			return 0;
+		}
+	}
+
+	va_start(args, format);
+	int length = vsnprintf(NULL, 0, format, args);
+	va_end(args);
+	if (length < 0)
+	{
+		return -1;
+	}
+
+	char *message = (char*)malloc((size_t)length + 1);
+	if (message == NULL)
+	{
+		return -1;
+	}
+
+	va_start(args, format);
+	vsnprintf(message, (size_t)length + 1, format, args);
+	va_end(args);
+
+	int result = WriteTestSink(sink, message, (size_t)length);
+	free(message);
+
+	return result;
+}
+
+/**
+ * @fn int FlushTestSink(TestSinkPtr sink)
+ * @brief TestSink 버퍼에 모인 내용을 한 번의 write 로 기록하는 함수(기록 스레드가 있으면 모두 기록될 때까지 기다린다)
+ * 표준 출력에 기록하는 경우, 사용자 코드가 printf 로 출력한 내용이 먼저 기록되도록 stdout 을 먼저 비운다.
+ * @param sink 출력 대상(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+int FlushTestSink(TestSinkPtr sink)
+{
+	// Check parameter
+	if (sink == NULL)
+	{
+		return -1;
+	}
+
+	if (sink->fd == STDOUT_FILENO)
+	{
+		fflush(stdout);
+	}
+
+	TestSinkWriterPtr writer = sink->writer;
+	if (writer != NULL)
+	{
+		pthread_mutex_lock(&writer->mutex);
+		writer->numberOfFlushWaiters++;
+		pthread_cond_signal(&writer->dataReady);
+		while (writer->writePosition != writer->readPosition)
+		{
+			pthread_cond_wait(&writer->spaceReady, &writer->mutex);
+		}
+		writer->numberOfFlushWaiters--;
+		pthread_mutex_unlock(&writer->mutex);
+		return 0;
+	}
+
+	if (sink->length == 0)
+	{
+		return 0;
+	}
+
+	int result = WriteAll(sink->fd, sink->buffer, sink->length);
+	sink->length = 0;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static TestSinkWriterPtr StartSinkWriter(TestSinkPtr sink)
+ * @brief 출력 버퍼를 비우는 백그라운드 기록 스레드를 생성하고 sink->writer 에 설정하는 함수
+ * @param sink 출력 대상(입력, 출력)
+ * @return 성공 시 기록 스레드 정보, 실패 시 NULL 반환
+ */
+static TestSinkWriterPtr StartSinkWriter(TestSinkPtr sink)
+{
+	TestSinkWriterPtr writer = (TestSinkWriterPtr)malloc(sizeof(TestSinkWriter));
+	if (writer == NULL)
+	{
+		return NULL;
+	}
+
+	// Wait for the write interval on the monotonic clock
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_mutex_init(&writer->mutex, NULL);
+	pthread_cond_init(&writer->dataReady, &attr);
+	pthread_cond_init(&writer->spaceReady, NULL);
+	pthread_condattr_destroy(&attr);
+	writer->readPosition = 0;
+	writer->writePosition = 0;
+	writer->numberOfFlushWaiters = 0;
+	writer->closing = FALSE;
+
+	sink->writer = writer;
+	if (pthread_create(&writer->thread, NULL, RunSinkWriter, sink) != 0)
+	{
+		pthread_mutex_destroy(&writer->mutex);
+		pthread_cond_destroy(&writer->dataReady);
+		pthread_cond_destroy(&writer->spaceReady);
+		free(writer);
+		sink->writer = NULL;
+		return NULL;
+	}
+
+	return writer;
+}
+
+/**
+ * @fn static void StopSinkWriter(TestSinkPtr sink)
+ * @brief 링 버퍼에 남은 데이터를 모두 기록한 뒤 기록 스레드를 종료하는 함수
+ * @param sink 출력 대상(입력, 출력)
+ * @return 반환값 없음
+ */
+static void StopSinkWriter(TestSinkPtr sink)
+{
+	TestSinkWriterPtr writer = sink->writer;
+	if (writer == NULL)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&writer->mutex);
+	writer->closing = TRUE;
+	pthread_cond_signal(&writer->dataReady);
+	pthread_mutex_unlock(&writer->mutex);
+
+	pthread_join(writer->thread, NULL);
+
+	pthread_mutex_destroy(&writer->mutex);
+	pthread_cond_destroy(&writer->dataReady);
+	pthread_cond_destroy(&writer->spaceReady);
+	free(writer);
+	sink->writer = NULL;
+}
+
+/**
+ * @fn static void *RunSinkWriter(void *arg)
+ * @brief 기록 스레드에서 링 버퍼에 모인 데이터를 기록하는 함수
+ * 데이터가 생기면 링 버퍼의 1/4 이 차거나, TEST_SINK_WRITE_INTERVAL_MS 가 지나거나, FlushTestSink 가 호출될 때까지 모은 뒤
+ * 링 버퍼 끝에서 나뉘지 않는 한 모인 데이터 전체를 한 번의 write 로 기록한다.
+ * @param arg 출력 대상(TestSinkPtr, 입력)
+ * @return 항상 NULL 반환
+ */
+static void *RunSinkWriter(void *arg)
+{
+	TestSinkPtr sink = (TestSinkPtr)arg;
+	TestSinkWriterPtr writer = sink->writer;
+	size_t threshold = sink->capacity / TEST_SINK_WRITE_THRESHOLD_DIVISOR;
+
+	pthread_mutex_lock(&writer->mutex);
+	while (TRUE)
+	{
+		while (writer->writePosition == writer->readPosition && writer->closing == FALSE)
+		{
+			pthread_cond_wait(&writer->dataReady, &writer->mutex);
+		}
+		if (writer->writePosition == writer->readPosition)
+		{
+			break;
+		}
+
+		// Let output accumulate so that it is written with few system calls
+		struct timespec deadline;
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_nsec += TEST_SINK_WRITE_INTERVAL_MS * 1000000L;
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+		while (writer->writePosition - writer->readPosition < threshold && writer->numberOfFlushWaiters == 0 && writer->closing == FALSE)
+		{
+			if (pthread_cond_timedwait(&writer->dataReady, &writer->mutex, &deadline) == ETIMEDOUT)
+			{
+				break;
+			}
+		}
+
+		// Write the contiguous part up to the end of the ring buffer without holding the lock
+		size_t offset = writer->readPosition % sink->capacity;
+		size_t length = writer->writePosition - writer->readPosition;
+		if (length > sink->capacity - offset)
+		{
+			length = sink->capacity - offset;
+		}
+		pthread_mutex_unlock(&writer->mutex);
+
+		WriteAll(sink->fd, sink->buffer + offset, length);
+
+		pthread_mutex_lock(&writer->mutex);
+		writer->readPosition += length;
+		pthread_cond_broadcast(&writer->spaceReady);
+	}
+	pthread_mutex_unlock(&writer->mutex);
+
+	return NULL;
+}
+
+/**
+ * @fn static void PushSinkWriter(TestSinkPtr sink, const char *data, size_t length)
+ * @brief 데이터를 링 버퍼에 복사하고, 링 버퍼가 비어 있었거나 기록할 만큼 모였으면 기록 스레드를 깨우는 함수
+ * 링 버퍼에 공간이 없으면 기록 스레드가 기록할 때까지 기다리며, 링 버퍼보다 큰 데이터는 나누어 복사한다.
+ * @param sink 출력 대상(입력, 출력)
+ * @param data 기록할 데이터(입력)
+ * @param length 기록할 데이터 길이(입력)
+ * @return 반환값 없음
+ */
+static void PushSinkWriter(TestSinkPtr sink, const char *data, size_t length)
+{
+	TestSinkWriterPtr writer = sink->writer;
+	size_t threshold = sink->capacity / TEST_SINK_WRITE_THRESHOLD_DIVISOR;
+
+	pthread_mutex_lock(&writer->mutex);
+	while (length > 0)
+	{
+		size_t usedLength = writer->writePosition - writer->readPosition;
+		size_t freeLength = sink->capacity - usedLength;
+		while (freeLength == 0)
+		{
+			pthread_cond_signal(&writer->dataReady);
+			pthread_cond_wait(&writer->spaceReady, &writer->mutex);
+			usedLength = writer->writePosition - writer->readPosition;
+			freeLength = sink->capacity - usedLength;
+		}
+
+		// Copy up to the free space and the end of the ring buffer
+		size_t offset = writer->writePosition % sink->capacity;
+		size_t copyLength = (length < freeLength) ? length : freeLength;
+		if (copyLength > sink->capacity - offset)
+		{
+			copyLength = sink->capacity - offset;
+		}
+		memcpy(sink->buffer + offset, data, copyLength);
+
+		writer->writePosition += copyLength;
+		data += copyLength;
+		length -= copyLength;
+
+		// Wake the writer only when it sleeps without data or enough data has accumulated
+		if (usedLength == 0 || (usedLength < threshold && usedLength + copyLength >= threshold))
+		{
+			pthread_cond_signal(&writer->dataReady);
+		}
+	}
+	pthread_mutex_unlock(&writer->mutex);
+}
+
+/**
+ * @fn static void InstallFatalSignalHandlers(TestSinkPtr sink)
+ * @brief 테스트가 비정상 종료되어도 링 버퍼에 남은 출력이 기록되도록 시그널 처리 함수를 설치하는 함수
+ * 사용자가 이미 처리 함수를 설치한 시그널은 그대로 두며, 한 번에 하나의 출력 대상만 처리한다.
+ * @param sink 출력 대상(입력)
+ * @return 반환값 없음
+ */
+static void InstallFatalSignalHandlers(TestSinkPtr sink)
+{
+	if (_fatalSink != NULL)
+	{
+		return;
+	}
+	_fatalSink = sink;
+	_fatalSinkPid = getpid();
+
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = HandleFatalSignal;
+	action.sa_flags = (int)(SA_RESETHAND | SA_NODEFER);
+	sigemptyset(&action.sa_mask);
+
+	int signalIndex = 0;
+	for (; signalIndex < NUMBER_OF_FATAL_SIGNALS; signalIndex++)
+	{
+		sigaction(_fatalSignals[signalIndex], NULL, &_previousActions[signalIndex]);
+		if (_previousActions[signalIndex].sa_handler == SIG_DFL)
+		{
+			sigaction(_fatalSignals[signalIndex], &action, NULL);
+		}
+	}
+}
+
+/**
+ * @fn static void UninstallFatalSignalHandlers(TestSinkPtr sink)
+ * @brief InstallFatalSignalHandlers 함수로 설치한 시그널 처리 함수를 이전 상태로 되돌리는 함수
+ * @param sink 출력 대상(입력)
+ * @return 반환값 없음
+ */
+static void UninstallFatalSignalHandlers(TestSinkPtr sink)
+{
+	if (_fatalSink != sink)
+	{
+		return;
+	}
+
+	int signalIndex = 0;
+	for (; signalIndex < NUMBER_OF_FATAL_SIGNALS; signalIndex++)
+	{
+		struct sigaction current;
+		sigaction(_fatalSignals[signalIndex], NULL, &current);
+		if (current.sa_handler == HandleFatalSignal)
+		{
+			sigaction(_fatalSignals[signalIndex], &_previousActions[signalIndex], NULL);
+		}
+	}
+	_fatalSink = NULL;
+}
+
+/**
+ * @fn static void HandleFatalSignal(int signalNumber)
+ * @brief 비정상 종료 시그널을 받으면 링 버퍼에 남은 출력을 직접 기록하고 같은 시그널로 종료하는 함수
+ * 시그널 처리 중에는 잠금을 사용할 수 없으므로 기록 스레드가 기록 중인 부분이 다시 기록될 수 있다(최선 노력).
+ * @param signalNumber 받은 시그널 번호(입력)
+ * @return 반환값 없음
+ */
+static void HandleFatalSignal(int signalNumber)
+{
+	TestSinkPtr sink = _fatalSink;
+	if (sink != NULL && getpid() == _fatalSinkPid)
+	{
+		TestSinkWriterPtr writer = sink->writer;
+		size_t readPosition = __atomic_load_n(&writer->readPosition, __ATOMIC_SEQ_CST);
+		size_t writePosition = __atomic_load_n(&writer->writePosition, __ATOMIC_SEQ_CST);
+		while (readPosition < writePosition)
+		{
+			size_t offset = readPosition % sink->capacity;
+			size_t length = writePosition - readPosition;
+			if (length > sink->capacity - offset)
+			{
+				length = sink->capacity - offset;
+			}
+			if (WriteAll(sink->fd, sink->buffer + offset, length) != 0)
+			{
+				break;
+			}
+			readPosition += length;
+		}
+	}
+
+	// The handler was reset to the default action, so this terminates the process
+	raise(signalNumber);
+}
+
+/**
+ * @fn static int WriteAll(int fd, const char *data, size_t length)
+ * @brief 데이터 전체를 파일 디스크립터에 기록하는 함수(부분 기록과 EINTR 을 처리한다)
+ * @param fd 파일 디스크립터(입력)
+ * @param data 기록할 데이터(입력)
+ * @param length 기록할 데이터 길이(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int WriteAll(int fd, const char *data, size_t length)
+{
+	while (length > 0)
+	{
+		ssize_t written = write(fd, data, length);
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		data += written;
+		length -= (size_t)written;
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,328 @@
+#include "ttlib_internal.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 덱에서 꺼낼 테스트가 없음을 나타내는 값
+#define TEST_DEQUE_EMPTY (-1)
+// 다른 스레드와의 경쟁으로 훔치기에 실패하여 다시 시도해야 함을 나타내는 값
+#define TEST_DEQUE_RETRY (-2)
+
+// 작업자 스레드 하나가 소유하는 작업 훔치기(work-stealing) 덱
+// 실행 전에 실행 순서(selectedTests 의 위치)가 모두 채워지고 이후에는 꺼내기만 하므로, 소유 스레드는 bottom 쪽에서, 다른 스레드는 top 쪽에서 꺼낸다.
+typedef struct _test_deque_t
+{
+	// 다른 스레드가 훔쳐 갈 위치(items[top])
+	long top;
+	// 소유 스레드가 꺼낼 위치의 다음(items[bottom - 1])
+	long bottom;
+	// 실행 순서 리스트(소유 스레드가 앞선 순서부터 실행하도록 내림차순으로 저장)
+	int *items;
+} TestDeque, *TestDequePtr;
+
+// 작업자 스레드들이 공유하는 실행 상태
+typedef struct _test_thread_pool_t
+{
+	// 전체 테스트 관리 구조체
+	TestSuitPtr testSuit;
+	// 작업자 스레드 개수
+	int numberOfThreads;
+	// 작업자 스레드별 덱 리스트
+	TestDequePtr deques;
+	// ASSERT 실패로 종료가 요청된 가장 앞선 실행 순서(요청이 없으면 구간의 끝)
+	int exitIndex;
+} TestThreadPool, *TestThreadPoolPtr;
+
+// 작업자 스레드 하나에 전달하는 인자
+typedef struct _test_thread_arg_t
+{
+	// 작업자 스레드들이 공유하는 실행 상태
+	TestThreadPoolPtr pool;
+	// 작업자 스레드 번호(소유한 덱 번호)
+	int threadIndex;
+} TestThreadArg, *TestThreadArgPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void *RunTestThread(void *arg);
+static int PopTestDeque(TestDequePtr deque);
+static int StealTestDeque(TestDequePtr deque);
+static int StealTest(TestThreadPoolPtr pool, int threadIndex);
+static void RequestExitAt(TestThreadPoolPtr pool, int position);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int RunTestsInThreads(TestSuitPtr testSuit, int start, int count, int numberOfThreads)
+ * @brief 실행 순서의 한 구간에 있는 테스트들을 현재 프로세스의 여러 작업자 스레드에서 나누어 실행하는 함수
+ * 구간의 실행 순서(selectedTests 의 위치)를 스레드 개수만큼 연속된 구간으로 나누어 각 스레드의 덱에 넣고, 자기 덱이 빈 스레드는 다른 스레드의 덱에서 테스트를 훔쳐 실행한다.
+ * 스레드마다 별도의 TestContext 객체를 사용하므로 검사 매크로 함수는 스레드 간에 상태를 공유하지 않으며,
+ * 테스트가 끝나면 그 시작, 실패 정보, 결과를 한 번에 리포터에 전달하므로 테스트들의 출력이 섞이지 않는다.
+ * 결과는 테스트별 TestReport 에 저장했다가 모든 스레드가 끝난 뒤 MergeTestReports 함수로 집계한다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력, 출력)
+ * @param start 구간의 첫 실행 순서(입력)
+ * @param count 구간의 테스트 개수(입력)
+ * @param numberOfThreads 동시에 실행할 작업자 스레드 개수(입력)
+ * @return 실행된 것으로 집계된 테스트 개수 반환
+ */
+int RunTestsInThreads(TestSuitPtr testSuit, int start, int count, int numberOfThreads)
+{
+	int numberOfTests = count;
+	if (numberOfThreads > numberOfTests)
+	{
+		numberOfThreads = numberOfTests;
+	}
+
+	TestThreadPool pool;
+	pool.testSuit = testSuit;
+	pool.numberOfThreads = numberOfThreads;
+	pool.exitIndex = start + numberOfTests;
+	pool.deques = (TestDequePtr)calloc((size_t)numberOfThreads, sizeof(TestDeque));
+
+	int *items = (int*)malloc(sizeof(int) * (size_t)numberOfTests);
+	pthread_t *threads = (pthread_t*)calloc((size_t)numberOfThreads, sizeof(pthread_t));
+	TestThreadArgPtr args = (TestThreadArgPtr)calloc((size_t)numberOfThreads, sizeof(TestThreadArg));
+	if (pool.deques == NULL || items == NULL || threads == NULL || args == NULL)
+	{
+		puts("작업자 스레드 정보 생성 실패");
+		free(pool.deques);
+		free(items);
+		free(threads);
+		free(args);
+		return 0;
+	}
+
+	// Split tests into contiguous ranges, stored in descending order for the owner thread
+	int threadIndex = 0;
+	for (; threadIndex < numberOfThreads; threadIndex++)
+	{
+		int first = (int)((long)numberOfTests * threadIndex / numberOfThreads);
+		int last = (int)((long)numberOfTests * (threadIndex + 1) / numberOfThreads);
+
+		TestDequePtr deque = &pool.deques[threadIndex];
+		deque->items = items + first;
+		deque->top = 0;
+		deque->bottom = last - first;
+
+		int itemIndex = 0;
+		for (; itemIndex < last - first; itemIndex++)
+		{
+			deque->items[itemIndex] = start + last - 1 - itemIndex;
+		}
+	}
+
+	// Flush buffered output before tests write from several threads
+	fflush(stdout);
+
+	int numberOfStartedThreads = 0;
+	for (threadIndex = 0; threadIndex < numberOfThreads; threadIndex++)
+	{
+		args[threadIndex].pool = &pool;
+		args[threadIndex].threadIndex = threadIndex;
+		if (pthread_create(&threads[threadIndex], NULL, RunTestThread, &args[threadIndex]) != 0)
+		{
+			puts("작업자 스레드 생성 실패");
+			break;
+		}
+		numberOfStartedThreads++;
+	}
+
+	// Tests left in the deques of unstarted threads are stolen by the others
+	if (numberOfStartedThreads == 0)
+	{
+		RunTestThread(&args[0]);
+	}
+
+	for (threadIndex = 0; threadIndex < numberOfStartedThreads; threadIndex++)
+	{
+		pthread_join(threads[threadIndex], NULL);
+	}
+	fflush(stdout);
+
+	// Count results in test order up to the test which requested exit
+	int numberOfCurTests = MergeTestReports(testSuit, start, count);
+
+	free(pool.deques);
+	free(items);
+	free(threads);
+	free(args);
+
+	return numberOfCurTests;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void *RunTestThread(void *arg)
+ * @brief 작업자 스레드에서 자기 덱의 테스트를 실행하고, 덱이 비면 다른 스레드의 테스트를 훔쳐 실행하는 함수
+ * @param arg 작업자 스레드 인자(TestThreadArgPtr, 입력)
+ * @return 항상 NULL 반환
+ */
+static void *RunTestThread(void *arg)
+{
+	TestThreadArgPtr threadArg = (TestThreadArgPtr)arg;
+	TestThreadPoolPtr pool = threadArg->pool;
+	TestDequePtr deque = &pool->deques[threadArg->threadIndex];
+
+	// Failures are collected per test and replayed to the reporter when the test ends
+	TestContext context;
+	InitializeTestContext(&context, pool->testSuit, FALSE);
+
+	int position = 0;
+	while (TRUE)
+	{
+		position = PopTestDeque(deque);
+		if (position == TEST_DEQUE_EMPTY)
+		{
+			position = StealTest(pool, threadArg->threadIndex);
+			if (position == TEST_DEQUE_EMPTY)
+			{
+				break;
+			}
+		}
+
+		// Tests after the one which requested exit are not run in serial mode either
+		if (position > __atomic_load_n(&pool->exitIndex, __ATOMIC_SEQ_CST))
+		{
+			continue;
+		}
+
+		int testIndex = pool->testSuit->selectedTests[position];
+		TestReportPtr report = &pool->testSuit->testReports[testIndex];
+		RunTest(pool->testSuit, testIndex, report, &context);
+		if (report->exitRequested == TRUE)
+		{
+			RequestExitAt(pool, position);
+		}
+		ReplayTestResult(pool->testSuit, testIndex, context.failureLog, context.failureLogLength, report);
+	}
+
+	ReleaseTestContext(&context);
+
+	return NULL;
+}
+
+/**
+ * @fn static int PopTestDeque(TestDequePtr deque)
+ * @brief 소유 스레드가 자기 덱의 bottom 쪽에서 테스트 번호를 꺼내는 함수
+ * 마지막 하나가 남은 경우에는 훔치는 스레드와 top 에 대한 CAS 로 경쟁한다(Chase-Lev 덱).
+ * @param deque 작업자 스레드의 덱(입력, 출력)
+ * @return 성공 시 테스트 번호, 비어 있으면 TEST_DEQUE_EMPTY 반환
+ */
+static int PopTestDeque(TestDequePtr deque)
+{
+	long bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+	__atomic_store_n(&deque->bottom, bottom, __ATOMIC_SEQ_CST);
+	long top = __atomic_load_n(&deque->top, __ATOMIC_SEQ_CST);
+
+	if (top > bottom)
+	{
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_SEQ_CST);
+		return TEST_DEQUE_EMPTY;
+	}
+
+	int testIndex = deque->items[bottom];
+	if (top == bottom)
+	{
+		if (__atomic_compare_exchange_n(&deque->top, &top, top + 1, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) == FALSE)
+		{
+			testIndex = TEST_DEQUE_EMPTY;
+		}
+		__atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_SEQ_CST);
+	}
+
+	return testIndex;
+}
+
+/**
+ * @fn static int StealTestDeque(TestDequePtr deque)
+ * @brief 다른 스레드의 덱의 top 쪽에서 테스트 번호를 훔치는 함수
+ * @param deque 훔칠 대상 덱(입력, 출력)
+ * @return 성공 시 테스트 번호, 비어 있으면 TEST_DEQUE_EMPTY, 경쟁에서 지면 TEST_DEQUE_RETRY 반환
+ */
+static int StealTestDeque(TestDequePtr deque)
+{
+	long top = __atomic_load_n(&deque->top, __ATOMIC_SEQ_CST);
+	long bottom = __atomic_load_n(&deque->bottom, __ATOMIC_SEQ_CST);
+
+	if (top >= bottom)
+	{
+		return TEST_DEQUE_EMPTY;
+	}
+
+	int testIndex = deque->items[top];
+	if (__atomic_compare_exchange_n(&deque->top, &top, top + 1, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) == FALSE)
+	{
+		return TEST_DEQUE_RETRY;
+	}
+
+	return testIndex;
+}
+
+/**
+ * @fn static int StealTest(TestThreadPoolPtr pool, int threadIndex)
+ * @brief 자기 덱이 빈 스레드가 다른 스레드들의 덱을 차례로 돌며 테스트 번호를 훔치는 함수
+ * 실행 중에는 덱에 새 테스트가 추가되지 않으므로, 모든 덱이 비어 있음을 확인하면 더 이상 실행할 테스트가 없다.
+ * @param pool 작업자 스레드들이 공유하는 실행 상태(입력, 출력)
+ * @param threadIndex 훔치는 스레드의 번호(입력)
+ * @return 성공 시 테스트 번호, 모든 덱이 비어 있으면 TEST_DEQUE_EMPTY 반환
+ */
+static int StealTest(TestThreadPoolPtr pool, int threadIndex)
+{
+	while (TRUE)
+	{
+		int contended = FALSE;
+
+		int offset = 1;
+		for (; offset < pool->numberOfThreads; offset++)
+		{
+			TestDequePtr victim = &pool->deques[(threadIndex + offset) % pool->numberOfThreads];
+			int testIndex = StealTestDeque(victim);
+			if (testIndex >= 0)
+			{
+				return testIndex;
+			}
+			if (testIndex == TEST_DEQUE_RETRY)
+			{
+				contended = TRUE;
+			}
+		}
+
+		if (contended == FALSE)
+		{
+			return TEST_DEQUE_EMPTY;
+		}
+		sched_yield();
+	}
+}
+
+/**
+ * @fn static void RequestExitAt(TestThreadPoolPtr pool, int position)
+ * @brief ASSERT 실패로 종료를 요청한 테스트의 실행 순서를 기록하는 함수(가장 앞선 순서만 유지)
+ * @param pool 작업자 스레드들이 공유하는 실행 상태(출력)
+ * @param position 종료를 요청한 테스트의 실행 순서(입력)
+ * @return 반환값 없음
+ */
+static void RequestExitAt(TestThreadPoolPtr pool, int position)
+{
+	int exitIndex = __atomic_load_n(&pool->exitIndex, __ATOMIC_SEQ_CST);
+	while (position < exitIndex)
+	{
+		if (__atomic_compare_exchange_n(&pool->exitIndex, &exitIndex, position, FALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+		{
+			break;
+		}
+	}
+}
+
@@ -0,0 +1,330 @@
+#include "ttlib_internal.h"
+
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int CollectRunTests(TestSuitPtr testSuit, int *testIndexes);
+static int CompareByElapsedTime(const void *left, const void *right, void *arg);
+static int CompareByTestCase(const void *left, const void *right, void *arg);
+static int CompareTestCaseTimes(const void *left, const void *right);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn TestReportPtr GetTestReport(TestSuitPtr testSuit, int testIndex)
+ * @brief 마지막 RunAllTests 호출에서 저장된 테스트 하나의 실행 결과(실행 시간 포함)를 반환하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(0 부터 시작, 입력)
+ * @return 성공 시 테스트 실행 결과 구조체 주소, 실패 시 NULL 반환
+ */
+TestReportPtr GetTestReport(TestSuitPtr testSuit, int testIndex)
+{
+	// Check parameter
+	if (testSuit == NULL || testSuit->testReports == NULL || testIndex < 0 || testIndex >= testSuit->numberOfTests)
+	{
+		return NULL;
+	}
+
+	return &testSuit->testReports[testIndex];
+}
+
+/**
+ * @fn int GetSlowestTests(TestSuitPtr testSuit, int *testIndexes, int count)
+ * @brief 실행된 테스트들 중 실행 시간이 가장 긴 테스트들의 번호를 느린 순서대로 반환하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndexes 테스트 번호를 저장할 배열(출력)
+ * @param count testIndexes 배열의 크기(입력)
+ * @return 성공 시 저장된 테스트 번호 개수, 실패 시 -1 반환
+ */
+int GetSlowestTests(TestSuitPtr testSuit, int *testIndexes, int count)
+{
+	// Check parameter
+	if (testSuit == NULL || testIndexes == NULL || count < 0)
+	{
+		return -1;
+	}
+	if (testSuit->testReports == NULL || testSuit->numberOfTests == 0)
+	{
+		return 0;
+	}
+
+	int *runTests = (int*)malloc(sizeof(int) * (size_t)testSuit->numberOfTests);
+	if (runTests == NULL)
+	{
+		return -1;
+	}
+
+	int numberOfRunTests = CollectRunTests(testSuit, runTests);
+	qsort_r(runTests, (size_t)numberOfRunTests, sizeof(int), CompareByElapsedTime, testSuit);
+
+	if (count > numberOfRunTests)
+	{
+		count = numberOfRunTests;
+	}
+	memcpy(testIndexes, runTests, sizeof(int) * (size_t)count);
+	free(runTests);
+
+	return count;
+}
+
+/**
+ * @fn long long GetTestSuitElapsedTime(TestSuitPtr testSuit)
+ * @brief 마지막 RunAllTests 호출의 전체 실행 시간(wall-clock)을 반환하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 전체 실행 시간(나노초), 실패 시 -1 반환
+ */
+long long GetTestSuitElapsedTime(TestSuitPtr testSuit)
+{
+	// Check parameter
+	if (testSuit == NULL)
+	{
+		return -1;
+	}
+
+	return testSuit->elapsedNanoseconds;
+}
+
+/**
+ * @fn long long GetTestSuitCpuTime(TestSuitPtr testSuit)
+ * @brief 마지막 RunAllTests 호출에서 실행된 테스트들의 CPU 사용 시간 합계를 반환하는 함수
+ * 병렬 실행 시에는 전체 실행 시간보다 클 수 있다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return CPU 사용 시간 합계(나노초), 실패 시 -1 반환
+ */
+long long GetTestSuitCpuTime(TestSuitPtr testSuit)
+{
+	// Check parameter
+	if (testSuit == NULL)
+	{
+		return -1;
+	}
+	if (testSuit->testReports == NULL)
+	{
+		return 0;
+	}
+
+	long long cpuNanoseconds = 0;
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		cpuNanoseconds += testSuit->testReports[testIndex].cpuNanoseconds;
+	}
+
+	return cpuNanoseconds;
+}
+
+/**
+ * @fn int GetTestCaseTimes(TestSuitPtr testSuit, TestCaseTimePtr testCaseTimes, int count)
+ * @brief 실행된 테스트들의 실행 시간을 테스트 케이스(testCase)별로 집계하여 실행 시간이 긴 순서대로 반환하는 함수
+ * testCaseTimes 가 NULL 이면 테스트 케이스 개수만 반환한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testCaseTimes 집계 결과를 저장할 배열(출력)
+ * @param count testCaseTimes 배열의 크기(입력)
+ * @return 성공 시 전체 테스트 케이스 개수(저장된 개수는 count 이하), 실패 시 -1 반환
+ */
+int GetTestCaseTimes(TestSuitPtr testSuit, TestCaseTimePtr testCaseTimes, int count)
+{
+	// Check parameter
+	if (testSuit == NULL || count < 0)
+	{
+		return -1;
+	}
+	if (testSuit->testReports == NULL || testSuit->numberOfTests == 0)
+	{
+		return 0;
+	}
+
+	int *runTests = (int*)malloc(sizeof(int) * (size_t)testSuit->numberOfTests);
+	TestCaseTimePtr groups = (TestCaseTimePtr)malloc(sizeof(TestCaseTime) * (size_t)testSuit->numberOfTests);
+	if (runTests == NULL || groups == NULL)
+	{
+		free(runTests);
+		free(groups);
+		return -1;
+	}
+
+	// Group run tests which have the same testCase name
+	int numberOfRunTests = CollectRunTests(testSuit, runTests);
+	qsort_r(runTests, (size_t)numberOfRunTests, sizeof(int), CompareByTestCase, testSuit);
+
+	int numberOfGroups = 0;
+	int runIndex = 0;
+	for (; runIndex < numberOfRunTests; runIndex++)
+	{
+		TestPtr test = testSuit->testPtrContainer[runTests[runIndex]];
+		TestReportPtr report = &testSuit->testReports[runTests[runIndex]];
+
+		if (numberOfGroups == 0 || strcmp(groups[numberOfGroups - 1].testCase, test->testCase) != 0)
+		{
+			groups[numberOfGroups].testCase = test->testCase;
+			groups[numberOfGroups].numberOfTests = 0;
+			groups[numberOfGroups].elapsedNanoseconds = 0;
+			groups[numberOfGroups].cpuNanoseconds = 0;
+			numberOfGroups++;
+		}
+
+		TestCaseTimePtr group = &groups[numberOfGroups - 1];
+		group->numberOfTests++;
+		group->elapsedNanoseconds += report->elapsedNanoseconds;
+		group->cpuNanoseconds += report->cpuNanoseconds;
+	}
+
+	qsort(groups, (size_t)numberOfGroups, sizeof(TestCaseTime), CompareTestCaseTimes);
+
+	if (testCaseTimes != NULL)
+	{
+		memcpy(testCaseTimes, groups, sizeof(TestCaseTime) * (size_t)((count < numberOfGroups) ? count : numberOfGroups));
+	}
+
+	free(runTests);
+	free(groups);
+
+	return numberOfGroups;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn long long GetMonotonicTime(void)
+ * @brief 단조 증가 시계의 현재 시각을 반환하는 함수
+ * @return 현재 시각(나노초)
+ */
+long long GetMonotonicTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (long long)now.tv_sec * 1000000000LL + (long long)now.tv_nsec;
+}
+
+/**
+ * @fn long long GetThreadCpuTime(void)
+ * @brief 현재 스레드의 CPU 사용 시간을 반환하는 함수
+ * @return CPU 사용 시간(나노초)
+ */
+long long GetThreadCpuTime(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+	return (long long)now.tv_sec * 1000000000LL + (long long)now.tv_nsec;
+}
+
+/**
+ * @fn unsigned long long ReadCycleCounter(void)
+ * @brief CPU 타임스탬프 카운터(TSC) 값을 반환하는 함수
+ * @return TSC 값(지원하지 않는 아키텍처이면 0)
+ */
+unsigned long long ReadCycleCounter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return (unsigned long long)__rdtsc();
+#else
+	return 0;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int CollectRunTests(TestSuitPtr testSuit, int *testIndexes)
+ * @brief 실제로 실행된 테스트들의 번호를 모으는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndexes 테스트 번호를 저장할 배열(테스트 개수 이상의 크기, 출력)
+ * @return 실행된 테스트 개수 반환
+ */
+static int CollectRunTests(TestSuitPtr testSuit, int *testIndexes)
+{
+	int numberOfRunTests = 0;
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		if (testSuit->testReports[testIndex].result != TestNotRun)
+		{
+			testIndexes[numberOfRunTests++] = testIndex;
+		}
+	}
+
+	return numberOfRunTests;
+}
+
+/**
+ * @fn static int CompareByElapsedTime(const void *left, const void *right, void *arg)
+ * @brief 테스트 번호를 실행 시간의 내림차순(같으면 테스트 번호의 오름차순)으로 정렬하기 위한 비교 함수
+ * @param left 비교할 테스트 번호(입력)
+ * @param right 비교할 테스트 번호(입력)
+ * @param arg 전체 테스트 관리 구조체(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareByElapsedTime(const void *left, const void *right, void *arg)
+{
+	TestSuitPtr testSuit = (TestSuitPtr)arg;
+	int leftIndex = *(const int*)left;
+	int rightIndex = *(const int*)right;
+	long long leftTime = testSuit->testReports[leftIndex].elapsedNanoseconds;
+	long long rightTime = testSuit->testReports[rightIndex].elapsedNanoseconds;
+
+	if (leftTime != rightTime)
+	{
+		return (leftTime > rightTime) ? -1 : 1;
+	}
+
+	return leftIndex - rightIndex;
+}
+
+/**
+ * @fn static int CompareByTestCase(const void *left, const void *right, void *arg)
+ * @brief 테스트 번호를 테스트 케이스 이름 순서(같으면 테스트 번호의 오름차순)로 정렬하기 위한 비교 함수
+ * @param left 비교할 테스트 번호(입력)
+ * @param right 비교할 테스트 번호(입력)
+ * @param arg 전체 테스트 관리 구조체(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareByTestCase(const void *left, const void *right, void *arg)
+{
+	TestSuitPtr testSuit = (TestSuitPtr)arg;
+	int leftIndex = *(const int*)left;
+	int rightIndex = *(const int*)right;
+
+	int result = strcmp(testSuit->testPtrContainer[leftIndex]->testCase, testSuit->testPtrContainer[rightIndex]->testCase);
+	if (result != 0)
+	{
+		return result;
+	}
+
+	return leftIndex - rightIndex;
+}
+
+/**
+ * @fn static int CompareTestCaseTimes(const void *left, const void *right)
+ * @brief 테스트 케이스별 집계 결과를 실행 시간의 내림차순으로 정렬하기 위한 비교 함수
+ * @param left 비교할 집계 결과(입력)
+ * @param right 비교할 집계 결과(입력)
+ * @return left 가 앞이면 음수, 뒤면 양수 반환
+ */
+static int CompareTestCaseTimes(const void *left, const void *right)
+{
+	const TestCaseTime *leftTime = (const TestCaseTime*)left;
+	const TestCaseTime *rightTime = (const TestCaseTime*)right;
+
+	if (leftTime->elapsedNanoseconds != rightTime->elapsedNanoseconds)
+	{
+		return (leftTime->elapsedNanoseconds > rightTime->elapsedNanoseconds) ? -1 : 1;
+	}
+
+	return strcmp(leftTime->testCase, rightTime->testCase);
+}
+
@@ -0,0 +1,565 @@
+#include "ttlib_internal.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 파일 변경 이벤트가 이 시간(밀리초) 동안 더 없으면 저장이 끝난 것으로 보고 빌드를 시작한다
+#define TEST_WATCH_QUIET_MILLISECONDS 100
+
+// 감시하는 파일 변경 이벤트(편집기가 임시 파일을 rename 하여 저장하는 경우 포함)
+#define TEST_WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE)
+
+// 감시 모드가 다시 실행하는 테스트 프로그램에 바뀐 소스 파일 이름 목록을 전달하는 환경 변수
+#define TEST_WATCH_SOURCES_VARIABLE "TTLIB_WATCH_SOURCES"
+
+// 소스 파일 종류
+typedef enum _test_source_kind_t
+{
+	// 소스 파일이 아님(목적 파일, 실행 파일, 편집기 임시 파일 등)
+	TestSourceNone = 0,
+	// 번역 단위(.c, .cc, .cpp)
+	TestSourceUnit,
+	// 헤더 파일(.h, .hh, .hpp)
+	TestSourceHeader
+} TestSourceKind;
+
+// 한 번의 저장(디바운스 구간)에서 바뀐 소스 파일 정보
+typedef struct _test_watch_changes_t
+{
+	// 바뀐 소스 파일 이름 목록(':' 로 구분)
+	char *fileNames;
+	// 바뀐 소스 파일 이름 목록의 길이
+	size_t length;
+	// 바뀐 소스 파일 이름 목록의 할당 크기
+	size_t capacity;
+	// 헤더 파일이 바뀌었는지 여부
+	int headerChanged;
+	// 테스트가 정의되지 않은 번역 단위(구현 파일)가 바뀌었는지 여부
+	int untestedChanged;
+	// 테스트가 정의된 번역 단위 이름 목록(':' 로 구분, 그 파일의 테스트만 다시 실행할 때 사용)
+	char *testSources;
+	// 테스트가 정의된 번역 단위 이름 목록의 길이
+	size_t testSourcesLength;
+	// 테스트가 정의된 번역 단위 이름 목록의 할당 크기
+	size_t testSourcesCapacity;
+} TestWatchChanges, *TestWatchChangesPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int AddWatchDirectories(int inotifyFd, const char *paths);
+static int WaitForChanges(TestSuitPtr testSuit, int inotifyFd, TestWatchChangesPtr changes);
+static int ReadWatchEvents(TestSuitPtr testSuit, int inotifyFd, TestWatchChangesPtr changes);
+static int AppendFileName(char **list, size_t *length, size_t *capacity, const char *fileName);
+static int HasFileName(const char *list, const char *fileName, size_t fileNameLength);
+static TestSourceKind GetSourceKind(const char *fileName);
+static int HasTestsInSource(TestSuitPtr testSuit, const char *fileName);
+static int RunBuildCommand(const char *command, int rebuildAll);
+static int RunTestProgram(TestSuitPtr testSuit, char *programPath, const char *sources);
+static const char *GetBaseName(const char *path);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int WatchTests(TestSuitPtr testSuit)
+ * @brief 감시할 디렉터리의 소스 파일이 바뀔 때마다 다시 빌드하고 영향받는 테스트만 다시 실행하는 함수(감시 모드)
+ * 처음에 모든 테스트를 한 번 실행한 뒤 inotify 로 디렉터리들을 감시한다.
+ * 파일 변경 이벤트가 TEST_WATCH_QUIET_MILLISECONDS 동안 없으면 빌드 명령을 실행하고, 빌드가 성공하면 새로 빌드된 테스트 프로그램을
+ * 같은 명령행 인자(감시 옵션 제외)로 다시 실행한다. 바뀐 파일이 모두 테스트가 정의된 번역 단위이면 그 파일들의 테스트만 실행하고,
+ * 헤더 파일이나 테스트가 없는 번역 단위(구현 파일)가 바뀌었으면 모든 테스트를 실행한다.
+ * 테스트는 항상 새 프로세스에서 실행되므로 감시하는 프로세스는 테스트 실패나 비정상 종료와 관계없이 계속 감시한다.
+ * 시그널로 종료될 때까지 반환하지 않는다.
+ * RunAllTests 함수에서 호출되기 때문에 전달받은 구조체 포인터에 대한 NULL 체크를 수행하지 않는다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @return 감시를 시작하지 못했으면 -1 반환
+ */
+int WatchTests(TestSuitPtr testSuit)
+{
+	// The rebuilt program replaces this file, so keep its path to run the new one
+	char programPath[PATH_MAX];
+	ssize_t programPathLength = readlink("/proc/self/exe", programPath, sizeof(programPath) - 1);
+	if (programPathLength <= 0)
+	{
+		puts("테스트 프로그램 경로 확인 실패");
+		return -1;
+	}
+	programPath[programPathLength] = '\0';
+
+	int inotifyFd = inotify_init1(IN_CLOEXEC);
+	if (inotifyFd < 0)
+	{
+		puts("파일 변경 감시 시작 실패");
+		return -1;
+	}
+	if (AddWatchDirectories(inotifyFd, testSuit->options.watchPaths) != 0)
+	{
+		printf("감시할 디렉터리 추가 실패 (path:%s)\n", testSuit->options.watchPaths);
+		close(inotifyFd);
+		return -1;
+	}
+
+	printf("[ 감시 모드: %s (빌드 명령: %s) ]\n", testSuit->options.watchPaths, testSuit->options.watchCommand);
+	RunTestProgram(testSuit, programPath, NULL);
+
+	while (TRUE)
+	{
+		printf("[ 파일 변경 대기 중 ]\n");
+		fflush(stdout);
+
+		TestWatchChanges changes;
+		memset(&changes, 0, sizeof(changes));
+		if (WaitForChanges(testSuit, inotifyFd, &changes) != 0)
+		{
+			free(changes.fileNames);
+			free(changes.testSources);
+			break;
+		}
+
+		printf("[ 바뀐 파일: %s ]\n", changes.fileNames);
+		fflush(stdout);
+
+		// This tree's Makefiles do not record header dependencies, so a header change rebuilds everything
+		int buildStatus = RunBuildCommand(testSuit->options.watchCommand, changes.headerChanged);
+		if (buildStatus != 0)
+		{
+			printf("[ 빌드 실패 (종료 코드: %d) ]\n", buildStatus);
+		}
+		else
+		{
+			// Only the tests defined in the changed files are affected unless shared code changed
+			const char *sources = (changes.headerChanged == FALSE && changes.untestedChanged == FALSE) ? changes.testSources : NULL;
+			printf("[ 다시 실행: %s ]\n", (sources != NULL) ? sources : "모든 테스트");
+			RunTestProgram(testSuit, programPath, sources);
+		}
+
+		free(changes.fileNames);
+		free(changes.testSources);
+	}
+
+	close(inotifyFd);
+
+	return -1;
+}
+
+/**
+ * @fn int IsWatchedTestSource(TestSuitPtr testSuit, int testIndex)
+ * @brief 감시 모드가 지정한 바뀐 소스 파일에 정의된 테스트인지 검사하는 함수
+ * 소스 파일은 디렉터리를 제외한 파일 이름으로 비교한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 지정한 소스 파일이 없거나 그 파일에 정의된 테스트이면 TRUE, 아니면 FALSE 반환
+ */
+int IsWatchedTestSource(TestSuitPtr testSuit, int testIndex)
+{
+	const char *sources = testSuit->options.watchSources;
+	if (sources == NULL)
+	{
+		return TRUE;
+	}
+
+	const char *fileName = testSuit->testPtrContainer[testIndex]->fileName;
+	if (fileName == NULL)
+	{
+		return FALSE;
+	}
+
+	fileName = GetBaseName(fileName);
+
+	return HasFileName(sources, fileName, strlen(fileName));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int AddWatchDirectories(int inotifyFd, const char *paths)
+ * @brief ':' 로 구분한 디렉터리들을 inotify 감시 대상으로 추가하는 함수(하위 디렉터리는 감시하지 않는다)
+ * @param inotifyFd inotify 파일 디스크립터(입력)
+ * @param paths 감시할 디렉터리 목록(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int AddWatchDirectories(int inotifyFd, const char *paths)
+{
+	char *pathList = strdup(paths);
+	if (pathList == NULL)
+	{
+		return -1;
+	}
+
+	int result = 0;
+	char *next = pathList;
+	while (next != NULL && result == 0)
+	{
+		char *path = next;
+		next = strchr(path, ':');
+		if (next != NULL)
+		{
+			*next++ = '\0';
+		}
+		if (*path == '\0')
+		{
+			continue;
+		}
+
+		if (inotify_add_watch(inotifyFd, path, TEST_WATCH_EVENTS | IN_ONLYDIR) < 0)
+		{
+			result = -1;
+		}
+	}
+	free(pathList);
+
+	return result;
+}
+
+/**
+ * @fn static int WaitForChanges(TestSuitPtr testSuit, int inotifyFd, TestWatchChangesPtr changes)
+ * @brief 소스 파일이 바뀔 때까지 기다린 뒤 변경 이벤트가 잠잠해질 때까지 바뀐 파일들을 모으는 함수
+ * 편집기는 저장 한 번에 여러 이벤트를 만들고 여러 파일을 함께 저장하기도 하므로,
+ * 마지막 이벤트 후 TEST_WATCH_QUIET_MILLISECONDS 동안 이벤트가 없을 때까지 모은 변경을 한 번에 처리한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param inotifyFd inotify 파일 디스크립터(입력)
+ * @param changes 바뀐 소스 파일 정보(출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int WaitForChanges(TestSuitPtr testSuit, int inotifyFd, TestWatchChangesPtr changes)
+{
+	int timeout = -1;
+	while (TRUE)
+	{
+		struct pollfd pollFd;
+		pollFd.fd = inotifyFd;
+		pollFd.events = POLLIN;
+		pollFd.revents = 0;
+
+		int ready = poll(&pollFd, 1, timeout);
+		if (ready < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return -1;
+		}
+		if (ready == 0)
+		{
+			// Quiet for a while after a source change
+			return 0;
+		}
+
+		if (ReadWatchEvents(testSuit, inotifyFd, changes) != 0)
+		{
+			return -1;
+		}
+		if (changes->fileNames != NULL)
+		{
+			timeout = TEST_WATCH_QUIET_MILLISECONDS;
+		}
+	}
+}
+
+/**
+ * @fn static int ReadWatchEvents(TestSuitPtr testSuit, int inotifyFd, TestWatchChangesPtr changes)
+ * @brief inotify 이벤트들을 읽어 소스 파일의 변경만 바뀐 파일 정보에 추가하는 함수
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param inotifyFd inotify 파일 디스크립터(입력)
+ * @param changes 바뀐 소스 파일 정보(입력, 출력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int ReadWatchEvents(TestSuitPtr testSuit, int inotifyFd, TestWatchChangesPtr changes)
+{
+	char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+	ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+	if (length < 0)
+	{
+		return (errno == EINTR || errno == EAGAIN) ? 0 : -1;
+	}
+
+	ssize_t offset = 0;
+	while (offset < length)
+	{
+		const struct inotify_event *event = (const struct inotify_event*)(buffer + offset);
+		offset += (ssize_t)(sizeof(struct inotify_event) + event->len);
+
+		if (event->len == 0 || (event->mask & IN_ISDIR) != 0)
+		{
+			continue;
+		}
+
+		TestSourceKind kind = GetSourceKind(event->name);
+		if (kind == TestSourceNone || HasFileName(changes->fileNames, event->name, strlen(event->name)) == TRUE)
+		{
+			continue;
+		}
+
+		if (AppendFileName(&changes->fileNames, &changes->length, &changes->capacity, event->name) != 0)
+		{
+			return -1;
+		}
+
+		if (kind == TestSourceHeader)
+		{
+			changes->headerChanged = TRUE;
+		}
+		else if (HasTestsInSource(testSuit, event->name) == TRUE)
+		{
+			if (AppendFileName(&changes->testSources, &changes->testSourcesLength, &changes->testSourcesCapacity, event->name) != 0)
+			{
+				return -1;
+			}
+		}
+		else
+		{
+			changes->untestedChanged = TRUE;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @fn static int AppendFileName(char **list, size_t *length, size_t *capacity, const char *fileName)
+ * @brief ':' 로 구분한 파일 이름 목록에 파일 이름을 추가하는 함수
+ * @param list 파일 이름 목록(입력, 출력, 필요하면 다시 할당된다)
+ * @param length 파일 이름 목록의 길이(입력, 출력)
+ * @param capacity 파일 이름 목록의 할당 크기(입력, 출력)
+ * @param fileName 추가할 파일 이름(입력)
+ * @return 성공 시 0, 실패 시 -1 반환
+ */
+static int AppendFileName(char **list, size_t *length, size_t *capacity, const char *fileName)
+{
+	size_t fileNameLength = strlen(fileName);
+	size_t requiredLength = *length + fileNameLength + 2;
+	if (requiredLength > *capacity)
+	{
+		size_t newCapacity = (*capacity > 0) ? *capacity * 2 : 256;
+		while (newCapacity < requiredLength)
+		{
+			newCapacity *= 2;
+		}
+
+		char *newList = (char*)realloc(*list, newCapacity);
+		if (newList == NULL)
+		{
+			return -1;
+		}
+		*list = newList;
+		*capacity = newCapacity;
+	}
+
+	if (*length > 0)
+	{
+		(*list)[(*length)++] = ':';
+	}
+	memcpy(*list + *length, fileName, fileNameLength + 1);
+	*length += fileNameLength;
+
+	return 0;
+}
+
+/**
+ * @fn static int HasFileName(const char *list, const char *fileName, size_t fileNameLength)
+ * @brief ':' 로 구분한 파일 이름 목록에 파일 이름이 있는지 검사하는 함수
+ * @param list 파일 이름 목록(입력, NULL 이면 빈 목록)
+ * @param fileName 찾을 파일 이름(입력)
+ * @param fileNameLength 찾을 파일 이름의 길이(입력)
+ * @return 있으면 TRUE, 없으면 FALSE 반환
+ */
+static int HasFileName(const char *list, const char *fileName, size_t fileNameLength)
+{
+	const char *next = list;
+	while (next != NULL && *next != '\0')
+	{
+		const char *end = strchr(next, ':');
+		size_t length = (end != NULL) ? (size_t)(end - next) : strlen(next);
+		if (length == fileNameLength && strncmp(next, fileName, length) == 0)
+		{
+			return TRUE;
+		}
+		next = (end != NULL) ? end + 1 : NULL;
+	}
+
+	return FALSE;
+}
+
+/**
+ * @fn static TestSourceKind GetSourceKind(const char *fileName)
+ * @brief 파일 이름의 확장자로 소스 파일 종류를 구하는 함수('.' 으로 시작하는 편집기 잠금 파일과 숨김 파일은 소스 파일이 아니다)
+ * @param fileName 파일 이름(입력)
+ * @return 소스 파일 종류 반환
+ */
+static TestSourceKind GetSourceKind(const char *fileName)
+{
+	const char *extension = strrchr(fileName, '.');
+	if (fileName[0] == '.' || extension == NULL)
+	{
+		return TestSourceNone;
+	}
+
+	if (strcmp(extension, ".c") == 0 || strcmp(extension, ".cc") == 0 || strcmp(extension, ".cpp") == 0)
+	{
+		return TestSourceUnit;
+	}
+	if (strcmp(extension, ".h") == 0 || strcmp(extension, ".hh") == 0 || strcmp(extension, ".hpp") == 0)
+	{
+		return TestSourceHeader;
+	}
+
+	return TestSourceNone;
+}
+
+/**
+ * @fn static int HasTestsInSource(TestSuitPtr testSuit, const char *fileName)
+ * @brief 지정한 소스 파일에 정의된 테스트가 있는지 검사하는 함수(디렉터리를 제외한 파일 이름으로 비교)
+ * 감시하는 프로세스는 처음 빌드된 테스트 프로그램이므로, 나중에 테스트를 처음 추가한 소스 파일은 테스트가 없는 파일로 본다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param fileName 소스 파일 이름(입력)
+ * @return 있으면 TRUE, 없으면 FALSE 반환
+ */
+static int HasTestsInSource(TestSuitPtr testSuit, const char *fileName)
+{
+	int testIndex = 0;
+	for (; testIndex < testSuit->numberOfTests; testIndex++)
+	{
+		const char *testFileName = testSuit->testPtrContainer[testIndex]->fileName;
+		if (testFileName != NULL && strcmp(GetBaseName(testFileName), fileName) == 0)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/**
+ * @fn static int RunBuildCommand(const char *command, int rebuildAll)
+ * @brief 빌드 명령을 셸로 실행하고 끝날 때까지 기다리는 함수
+ * 헤더 파일이 바뀌었고 기본 빌드 명령(make)이면 헤더 의존성을 기록하지 않는 Makefile 에서도 다시 컴파일되도록 make -B 로 실행한다.
+ * @param command 빌드 명령(입력)
+ * @param rebuildAll 모두 다시 빌드할지 여부(입력)
+ * @return 빌드 명령의 종료 코드(시그널로 종료되었거나 실행하지 못했으면 -1) 반환
+ */
+static int RunBuildCommand(const char *command, int rebuildAll)
+{
+	if (rebuildAll == TRUE && strcmp(command, "make") == 0)
+	{
+		command = "make -B";
+	}
+
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		return -1;
+	}
+	if (pid == 0)
+	{
+		execl("/bin/sh", "sh", "-c", command, (char*)NULL);
+		_exit(127);
+	}
+
+	int status = 0;
+	while (waitpid(pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+		{
+			return -1;
+		}
+	}
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/**
+ * @fn static int RunTestProgram(TestSuitPtr testSuit, char *programPath, const char *sources)
+ * @brief 테스트 프로그램을 감시 옵션을 제외한 같은 명령행 인자로 새 프로세스에서 실행하고 끝날 때까지 기다리는 함수
+ * 바뀐 소스 파일 이름 목록은 TTLIB_WATCH_SOURCES 환경 변수로 전달하여 그 파일들에 정의된 테스트만 선택하게 한다.
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param programPath 테스트 프로그램 경로(입력, 새 프로세스의 argv[0] 으로 그대로 전달)
+ * @param sources 바뀐 소스 파일 이름 목록(입력, NULL 이면 모든 테스트 실행)
+ * @return 테스트 프로그램의 종료 코드(시그널로 종료되었거나 실행하지 못했으면 -1) 반환
+ */
+static int RunTestProgram(TestSuitPtr testSuit, char *programPath, const char *sources)
+{
+	int numberOfArguments = testSuit->options.numberOfArguments;
+	char **arguments = (char**)malloc(sizeof(char*) * (size_t)(numberOfArguments + 2));
+	if (arguments == NULL)
+	{
+		return -1;
+	}
+
+	// Drop the watch options so that the test program runs the tests itself
+	int numberOfProgramArguments = 0;
+	arguments[numberOfProgramArguments++] = programPath;
+	int argIndex = 1;
+	for (; argIndex < numberOfArguments; argIndex++)
+	{
+		const char *arg = testSuit->options.arguments[argIndex];
+		if (strcmp(arg, "--watch") == 0 || strncmp(arg, "--watch=", 8) == 0 || strncmp(arg, "--watch-command=", 16) == 0)
+		{
+			continue;
+		}
+		arguments[numberOfProgramArguments++] = testSuit->options.arguments[argIndex];
+	}
+	arguments[numberOfProgramArguments] = NULL;
+
+	fflush(stdout);
+
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		free(arguments);
+		return -1;
+	}
+	if (pid == 0)
+	{
+		unsetenv("TTLIB_WATCH");
+		if (sources != NULL)
+		{
+			setenv(TEST_WATCH_SOURCES_VARIABLE, sources, 1);
+		}
+		else
+		{
+			unsetenv(TEST_WATCH_SOURCES_VARIABLE);
+		}
+		execv(programPath, arguments);
+		_exit(127);
+	}
+	free(arguments);
+
+	int status = 0;
+	while (waitpid(pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+		{
+			return -1;
+		}
+	}
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/**
+ * @fn static const char *GetBaseName(const char *path)
+ * @brief 경로에서 디렉터리를 제외한 파일 이름을 구하는 함수
+ * @param path 경로(입력)
+ * @return 파일 이름 반환
+ */
+static const char *GetBaseName(const char *path)
+{
+	const char *slash = strrchr(path, '/');
+
+	return (slash != NULL) ? slash + 1 : path;
+}
@@ -0,0 +1,226 @@
+#include "ttlib_internal.h"
+
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 제한 시간 감시 타이머가 보내는 시그널
+#define TEST_WATCHDOG_SIGNAL (SIGRTMIN)
+
+// 오래된 glibc 헤더에는 SIGEV_THREAD_ID 대상 스레드 필드 이름이 정의되어 있지 않다.
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Global Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// 제한 시간 시그널 처리 함수를 한 번만 설치하기 위한 변수
+static pthread_once_t _watchdogHandlerOnce = PTHREAD_ONCE_INIT;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static void InstallWatchdogHandler(void);
+static void HandleTestTimeout(int signalNumber);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int GetTestTimeout(TestSuitPtr testSuit, int testIndex)
+ * @brief 테스트 하나에 적용할 제한 시간을 반환하는 함수(TEST_TIMEOUT 으로 지정한 값이 실행 옵션의 기본값보다 우선한다)
+ * @param testSuit 전체 테스트 관리 구조체(입력)
+ * @param testIndex 테스트 번호(입력)
+ * @return 제한 시간(밀리초, 0 이면 제한 없음) 반환
+ */
+int GetTestTimeout(TestSuitPtr testSuit, int testIndex)
+{
+	int timeoutMilliseconds = testSuit->testPtrContainer[testIndex]->timeoutMilliseconds;
+
+	return (timeoutMilliseconds > 0) ? timeoutMilliseconds : testSuit->options.timeoutMilliseconds;
+}
+
+/**
+ * @fn TestWatchdogPtr GetTestWatchdog(TestContextPtr context)
+ * @brief TestContext 객체의 제한 시간 감시 정보를 반환하는 함수(처음 호출될 때 현재 스레드로 시그널을 보내는 타이머를 생성한다)
+ * TestContext 객체는 생성한 작업자 스레드에서만 사용되므로 타이머는 항상 테스트를 실행하는 스레드로 시그널을 보낸다.
+ * @param context 테스트를 실행할 TestContext 객체(입력, 출력)
+ * @return 성공 시 제한 시간 감시 정보, 실패 시 NULL 반환(제한 시간 없이 실행된다)
+ */
+TestWatchdogPtr GetTestWatchdog(TestContextPtr context)
+{
+	if (context->watchdog != NULL)
+	{
+		return context->watchdog;
+	}
+
+	pthread_once(&_watchdogHandlerOnce, InstallWatchdogHandler);
+
+	TestWatchdogPtr watchdog = (TestWatchdogPtr)calloc(1, sizeof(TestWatchdog));
+	if (watchdog == NULL)
+	{
+		return NULL;
+	}
+
+	struct sigevent event;
+	memset(&event, 0, sizeof(event));
+	event.sigev_notify = SIGEV_THREAD_ID;
+	event.sigev_signo = TEST_WATCHDOG_SIGNAL;
+	event.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+	if (timer_create(CLOCK_MONOTONIC, &event, &watchdog->timer) != 0)
+	{
+		free(watchdog);
+		return NULL;
+	}
+
+	context->watchdog = watchdog;
+
+	return watchdog;
+}
+
+/**
+ * @fn void ArmTestWatchdog(TestWatchdogPtr watchdog, int timeoutMilliseconds)
+ * @brief 제한 시간 감시 타이머를 시작하는 함수(호출 전에 sigsetjmp 로 중단 지점을 저장해야 한다)
+ * @param watchdog 제한 시간 감시 정보(입력, 출력)
+ * @param timeoutMilliseconds 제한 시간(밀리초, 입력)
+ * @return 반환값 없음
+ */
+void ArmTestWatchdog(TestWatchdogPtr watchdog, int timeoutMilliseconds)
+{
+	struct itimerspec interval;
+	memset(&interval, 0, sizeof(interval));
+	interval.it_value.tv_sec = timeoutMilliseconds / 1000;
+	interval.it_value.tv_nsec = (long)(timeoutMilliseconds % 1000) * 1000000L;
+
+	watchdog->held = 0;
+	watchdog->expired = FALSE;
+	watchdog->armed = TRUE;
+	timer_settime(watchdog->timer, 0, &interval, NULL);
+}
+
+/**
+ * @fn void DisarmTestWatchdog(TestWatchdogPtr watchdog)
+ * @brief 제한 시간 감시 타이머를 멈추는 함수
+ * 타이머를 멈추기 전에 보내진 시그널은 armed 가 FALSE 이므로 무시된다.
+ * @param watchdog 제한 시간 감시 정보(입력, 출력)
+ * @return 반환값 없음
+ */
+void DisarmTestWatchdog(TestWatchdogPtr watchdog)
+{
+	struct itimerspec interval;
+	memset(&interval, 0, sizeof(interval));
+
+	watchdog->armed = FALSE;
+	timer_settime(watchdog->timer, 0, &interval, NULL);
+}
+
+/**
+ * @fn void HoldTestWatchdog(void)
+ * @brief 현재 스레드의 테스트가 제한 시간을 넘겨도 ReleaseTestWatchdog 호출 전까지 중단되지 않게 하는 함수
+ * 잠금이나 메모리 할당 중에 테스트가 중단되어 다음 테스트가 교착 상태에 빠지는 것을 막기 위해 라이브러리 내부 작업을 감싸는 데 사용한다.
+ * @return 반환값 없음
+ */
+void HoldTestWatchdog(void)
+{
+	TestContextPtr context = _testContext;
+	if (context != NULL && context->watchdog != NULL)
+	{
+		context->watchdog->held++;
+	}
+}
+
+/**
+ * @fn void ReleaseTestWatchdog(void)
+ * @brief HoldTestWatchdog 로 미뤄 둔 제한 시간 중단을 허용하는 함수(그 사이에 제한 시간이 지났으면 바로 테스트를 중단한다)
+ * @return 반환값 없음
+ */
+void ReleaseTestWatchdog(void)
+{
+	TestContextPtr context = _testContext;
+	if (context == NULL || context->watchdog == NULL)
+	{
+		return;
+	}
+
+	TestWatchdogPtr watchdog = context->watchdog;
+	if (--watchdog->held == 0 && watchdog->expired == TRUE && watchdog->armed == TRUE)
+	{
+		watchdog->armed = FALSE;
+		siglongjmp(watchdog->jumpBuffer, 1);
+	}
+}
+
+/**
+ * @fn void DeleteTestWatchdog(TestContextPtr context)
+ * @brief TestContext 객체의 제한 시간 감시 타이머를 삭제하는 함수
+ * @param context TestContext 객체(입력, 출력)
+ * @return 반환값 없음
+ */
+void DeleteTestWatchdog(TestContextPtr context)
+{
+	if (context->watchdog == NULL)
+	{
+		return;
+	}
+
+	timer_delete(context->watchdog->timer);
+	free(context->watchdog);
+	context->watchdog = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void InstallWatchdogHandler(void)
+ * @brief 제한 시간 시그널 처리 함수를 설치하는 함수
+ * 처리 함수가 siglongjmp 로 빠져나가도 시그널이 막힌 채로 남지 않도록 SA_NODEFER 를 사용하므로 sigsetjmp 에서 시그널 마스크를 저장할 필요가 없다.
+ * @return 반환값 없음
+ */
+static void InstallWatchdogHandler(void)
+{
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = HandleTestTimeout;
+	action.sa_flags = SA_NODEFER;
+	sigemptyset(&action.sa_mask);
+	sigaction(TEST_WATCHDOG_SIGNAL, &action, NULL);
+}
+
+/**
+ * @fn static void HandleTestTimeout(int signalNumber)
+ * @brief 제한 시간이 지나면 현재 스레드에서 실행 중인 테스트를 RunTest 함수의 중단 지점으로 빠져나가게 하는 시그널 처리 함수
+ * 라이브러리 내부 작업 중(HoldTestWatchdog)이면 중단을 ReleaseTestWatchdog 호출 시점으로 미룬다.
+ * @param signalNumber 시그널 번호(입력)
+ * @return 반환값 없음
+ */
+static void HandleTestTimeout(int signalNumber)
+{
+	(void)signalNumber;
+
+	TestContextPtr context = _testContext;
+	if (context == NULL || context->watchdog == NULL || context->watchdog->armed == FALSE)
+	{
+		return;
+	}
+
+	TestWatchdogPtr watchdog = context->watchdog;
+	if (watchdog->held > 0)
+	{
+		watchdog->expired = TRUE;
+		return;
+	}
+
+	watchdog->armed = FALSE;
+	siglongjmp(watchdog->jumpBuffer, 1);
+}
+
@@ -0,0 +1,40 @@
+#include "ttlib.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int main(int argc, char **argv)
+ * @brief --failure-log 로 저장한 바이너리 실패 기록 파일을 읽어 실패 메시지를 출력하는 도구(ttdecode)
+ * 사용법 : ttdecode 기록파일 [기록파일...]
+ * 기록을 만든 테스트 프로그램과 같은 아키텍처에서 실행해야 한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 리스트(입력)
+ * @return 모든 파일을 읽었으면 0, 읽지 못한 파일이 있으면 1, 사용법이 잘못되었으면 255 반환
+ */
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		printf("사용법: %s 기록파일 [기록파일...]\n", argv[0]);
+		return 255;
+	}
+
+	int result = 0;
+	int argIndex = 1;
+	for (; argIndex < argc; argIndex++)
+	{
+		long long numberOfFailures = DecodeTestFailureLog(argv[argIndex], stdout);
+		if (numberOfFailures < 0)
+		{
+			fflush(stdout);
+			fprintf(stderr, "실패 기록 파일 읽기 실패 (path:%s)\n", argv[argIndex]);
+			result = 1;
+			continue;
+		}
+		printf("\n실패 %lld 개 (path:%s)\n", numberOfFailures, argv[argIndex]);
+	}
+
+	return result;
+}
@@ -0,0 +1,107 @@
+#include "ttlib.h"
+
+#include <dlfcn.h>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Predefitions of Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+static int IsTestPluginPath(const char *arg);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn int main(int argc, char **argv)
+ * @brief 여러 테스트 스위트 공유 라이브러리를 읽어 한 TestSuit 객체로 함께 실행하는 테스트 실행기(ttrun)
+ * 사용법 : ttrun [옵션...] 스위트.so [스위트.so...]
+ * '.so' 로 끝나는(또는 '.so.' 를 포함하는) 인자는 테스트 스위트 공유 라이브러리로 읽고, 나머지 인자는 테스트 실행 옵션으로 해석한다.
+ * @param argc 명령행 인자 개수(입력)
+ * @param argv 명령행 인자 리스트(입력)
+ * @return 모든 테스트가 성공하면 0, 실패한 테스트가 있으면 1, 테스트를 실행하지 못했으면 255 반환
+ */
+int main(int argc, char **argv)
+{
+	TestSuitPtr testSuit = NewTestSuit();
+	if (testSuit == NULL)
+	{
+		printf("failed to create a test suit instance!\n");
+		return 255;
+	}
+
+	char **optionArguments = (char**)malloc(sizeof(char*) * (size_t)(argc + 1));
+	if (optionArguments == NULL)
+	{
+		DeleteTestSuit(&testSuit);
+		return 255;
+	}
+
+	// Load the suites in the given order and keep the rest as test options
+	int numberOfOptionArguments = 0;
+	int argIndex = 0;
+	for (; argIndex < argc; argIndex++)
+	{
+		if (argIndex > 0 && IsTestPluginPath(argv[argIndex]) == TRUE)
+		{
+			if (LoadTestPlugin(testSuit, argv[argIndex]) == TestInitializationResultFail)
+			{
+				const char *error = dlerror();
+				printf("테스트 스위트 읽기 실패 (path:%s, error:%s)\n", argv[argIndex], (error != NULL) ? error : "잘못된 레코드 범위");
+				free(optionArguments);
+				DeleteTestSuit(&testSuit);
+				return 255;
+			}
+			continue;
+		}
+		optionArguments[numberOfOptionArguments++] = argv[argIndex];
+	}
+	optionArguments[numberOfOptionArguments] = NULL;
+
+	if (testSuit->numberOfPlugins == 0)
+	{
+		printf("사용법: %s [옵션...] 스위트.so [스위트.so...]\n", argv[0]);
+		free(optionArguments);
+		DeleteTestSuit(&testSuit);
+		return 255;
+	}
+
+	if (ParseTestOptions(testSuit, numberOfOptionArguments, optionArguments) == TestInitializationResultFail)
+	{
+		free(optionArguments);
+		DeleteTestSuit(&testSuit);
+		return 255;
+	}
+
+	// Watch mode reruns this program with the suites as well
+	testSuit->options.numberOfArguments = argc;
+	testSuit->options.arguments = argv;
+
+	int result = RunAllTests(testSuit);
+
+	DeleteTestSuit(&testSuit);
+	free(optionArguments);
+
+	return (result < 0) ? 255 : result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int IsTestPluginPath(const char *arg)
+ * @brief 명령행 인자가 테스트 스위트 공유 라이브러리 경로인지 검사하는 함수
+ * @param arg 명령행 인자(입력)
+ * @return 옵션이 아니고 '.so' 로 끝나거나 '.so.' 를 포함하면 TRUE, 아니면 FALSE 반환
+ */
+static int IsTestPluginPath(const char *arg)
+{
+	size_t length = strlen(arg);
+	if (arg[0] == '-')
+	{
+		return FALSE;
+	}
+
+	return ((length >= 3 && strcmp(arg + length - 3, ".so") == 0) || strstr(arg, ".so.") != NULL) ? TRUE : FALSE;
+}